@@ -1,9 +1,17 @@
 #include "app/app.h"
 
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <ranges>
+#include <utility>
+#include <vector>
+
 #include <GLFW/glfw3.h>
 #include <glm/glm.hpp>
 
-#include "geometry/mesh_simplifier.h"
+#include "geometry/lod_chain.h"
 #include "graphics/obj_loader.h"
 
 namespace {
@@ -26,7 +34,7 @@ gfx::ArcCamera CreateCamera(const float aspect_ratio) {
 }
 
 gfx::Mesh CreateMesh(const gfx::Device& device) {
-  auto mesh = gfx::obj_loader::LoadMesh(device, "assets/models/bunny.obj");
+  auto mesh = gfx::obj_loader::LoadMesh(device, "assets/models/bunny.obj", {.use_cache = true});
 
   // NOLINTBEGIN(*-magic-numbers)
   mesh.Translate(glm::vec3{0.2f, -0.3f, 0.0f});
@@ -34,9 +42,58 @@ gfx::Mesh CreateMesh(const gfx::Device& device) {
   mesh.Scale(glm::vec3{0.35f});
   // NOLINTEND(*-magic-numbers)
 
+  mesh.BuildMeshlets();
   return mesh;
 }
 
+gfx::LodGroup CreateLodGroup(const gfx::Device& device, const gfx::Mesh& mesh) {
+  // NOLINTBEGIN(*-magic-numbers)
+  static constexpr std::size_t kLodCount = 8;
+  static constexpr std::size_t kMinFaceCount = 64;
+  // NOLINTEND(*-magic-numbers)
+
+  // halve the face count of each successive level of detail
+  std::vector<gfx::mesh::LodTarget> lod_targets;
+  for (auto face_count = mesh.indices().size() / 3 / 2; face_count >= kMinFaceCount && lod_targets.size() < kLodCount;
+       face_count /= 2) {
+    lod_targets.push_back(gfx::mesh::LodTarget{.face_count = face_count});
+  }
+
+  auto lod_chain = gfx::mesh::CreateLodChain(device, mesh, lod_targets);
+
+  // quadric errors are sums of squared distances to the original surface so their square root bounds the distance
+  auto lods = lod_chain.lods | std::views::transform([](const gfx::mesh::Lod& lod) {
+                return gfx::LodLevel{
+                    .index_range = gfx::IndexRange{.first_index = lod.first_index, .index_count = lod.index_count},
+                    .geometric_error = std::sqrt(lod.max_error)};
+              })
+              | std::ranges::to<std::vector>();
+
+  return gfx::LodGroup{std::move(lod_chain.mesh), std::move(lods)};
+}
+
+gfx::Scene CreateScene(const gfx::Device& device, const gfx::Mesh& mesh) {
+  // NOLINTBEGIN(*-magic-numbers)
+  static constexpr std::uint32_t kGridSize = 32;
+  static constexpr auto kGridSpacing = 0.5f;
+  // NOLINTEND(*-magic-numbers)
+
+  std::vector<gfx::SceneInstance> instances;
+  instances.reserve(kGridSize * kGridSize);
+  for (std::uint32_t i = 0; i < kGridSize; ++i) {
+    for (std::uint32_t j = 0; j < kGridSize; ++j) {
+      const glm::vec3 translation{kGridSpacing * (static_cast<float>(i) - kGridSize / 2.0f),
+                                  0.0f,
+                                  -kGridSpacing * static_cast<float>(j)};
+      const auto transform = glm::translate(glm::mat4{1.0f}, translation) * mesh.transform();
+      instances.push_back(gfx::SceneInstance{.transform = transform});
+    }
+  }
+
+  const std::array scene_meshes{gfx::SceneMesh{.vertices = mesh.vertices(), .indices = mesh.indices()}};
+  return gfx::Scene{device, scene_meshes, instances};
+}
+
 }  // namespace
 
 namespace gfx {
@@ -54,7 +111,21 @@ App::App()
 void App::Run() {
   while (!window_.IsClosed()) {
     Window::Update();
-    engine_.Render(camera_, mesh_);
+    if (pending_mesh_.has_value() && pending_mesh_->IsUploaded()) {
+      // frames in flight may still read the current mesh which must not be destroyed until they complete
+      engine_.device().graphics_queue().waitIdle();
+      mesh_ = std::move(*pending_mesh_);
+      pending_mesh_.reset();
+    }
+    if (scene_.has_value()) {
+      engine_.Render(camera_, *scene_);
+    } else if (lod_group_.has_value()) {
+      const auto [_, framebuffer_height] = window_.GetFramebufferSize();
+      lod_group_->Update(camera_, static_cast<float>(framebuffer_height));
+      engine_.Render(camera_, *lod_group_);
+    } else {
+      engine_.Render(camera_, mesh_);
+    }
   }
   engine_.device()->waitIdle();
 }
@@ -67,10 +138,32 @@ void App::OnKeyEvent(const int key, const int action) {
       window_.Close();
       break;
     case GLFW_KEY_S: {
-      static constexpr auto kSimplificationRate = 0.5f;
-      mesh_ = mesh::Simplify(engine_.device(), mesh_, kSimplificationRate);
+      // resume simplification from the previous level of detail to retain accumulated vertex quadrics
+      if (!simplification_session_.has_value()) simplification_session_.emplace(mesh_);
+      simplification_session_->SimplifyTo(simplification_session_->face_count() / 2);
+      // keep rendering the current mesh while the simplified mesh is uploaded
+      pending_mesh_ = simplification_session_->ToMesh(engine_.device());
+      pending_mesh_->BuildMeshlets();
       break;
     }
+    case GLFW_KEY_L:
+      if (lod_group_.has_value()) {
+        // frames in flight may still read the level of detail group which must not be destroyed until they complete
+        engine_.device().graphics_queue().waitIdle();
+        lod_group_.reset();
+      } else {
+        lod_group_.emplace(CreateLodGroup(engine_.device(), mesh_));
+      }
+      break;
+    case GLFW_KEY_I:
+      if (scene_.has_value()) {
+        // frames in flight may still read the scene which must not be destroyed until they complete
+        engine_.device().graphics_queue().waitIdle();
+        scene_.reset();
+      } else {
+        scene_.emplace(CreateScene(engine_.device(), mesh_));
+      }
+      break;
     default:
       break;
   }
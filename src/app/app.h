@@ -1,9 +1,14 @@
 #ifndef APP_APP_H_
 #define APP_APP_H_
 
+#include <optional>
+
+#include "geometry/simplification_session.h"
 #include "graphics/arc_camera.h"
 #include "graphics/engine.h"
+#include "graphics/lod_group.h"
 #include "graphics/mesh.h"
+#include "graphics/scene.h"
 #include "graphics/window.h"
 
 namespace gfx {
@@ -23,6 +28,14 @@ private:
   Engine engine_;
   ArcCamera camera_;
   Mesh mesh_;
+  std::optional<Mesh> pending_mesh_;
+
+  /** \brief Levels of detail of the current mesh selected by screen-space error which are rendered when present. */
+  std::optional<LodGroup> lod_group_;
+
+  /** \brief A scene of many instances of the current mesh which is rendered instead of the mesh when present. */
+  std::optional<Scene> scene_;
+  std::optional<mesh::SimplificationSession> simplification_session_;
 };
 
 }  // namespace gfx
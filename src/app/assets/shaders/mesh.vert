@@ -1,23 +1,30 @@
 #version 460
 
 layout(push_constant) uniform VertexTransforms {
-  mat4 model_view_transform; // model-view transform assumed to be an orthogonal matrix
+  mat4 model_view_transform; // includes position dequantization and is assumed to be orthogonal up to uniform scale
   mat4 projection_transform;
 } vertex_transforms;
 
-layout(location = 0) in vec3 position;
+layout(location = 0) in vec4 quantized_position; // unsigned normalized coordinates in the mesh bounds
 layout(location = 1) in vec2 texture_coordinates;
-layout(location = 2) in vec3 normal;
+layout(location = 2) in vec2 encoded_normal; // octahedral coordinates
 
 layout(location = 0) out Vertex {
   vec3 position;
   vec3 normal;
 } vertex;
 
+vec3 DecodeOctahedral(const vec2 encoded_normal) {
+  vec3 normal = vec3(encoded_normal, 1.0 - abs(encoded_normal.x) - abs(encoded_normal.y));
+  const float t = max(-normal.z, 0.0);
+  normal.xy -= t * mix(vec2(-1.0), vec2(1.0), greaterThanEqual(normal.xy, vec2(0.0)));
+  return normalize(normal);
+}
+
 void main() {
-  const vec4 model_view_position = vertex_transforms.model_view_transform * vec4(position, 1.0);
+  const vec4 model_view_position = vertex_transforms.model_view_transform * vec4(quantized_position.xyz, 1.0);
   const mat3 normal_transform = mat3(vertex_transforms.model_view_transform);
   vertex.position = model_view_position.xyz;
-  vertex.normal = normalize(normal_transform * normal);
+  vertex.normal = normalize(normal_transform * DecodeOctahedral(encoded_normal));
   gl_Position = vertex_transforms.projection_transform * model_view_position;
 }
@@ -0,0 +1,40 @@
+#version 460
+
+layout(push_constant) uniform ViewTransforms {
+  mat4 view_transform;
+  mat4 projection_transform;
+} view_transforms;
+
+struct Instance {
+  mat4 model_transform; // includes position dequantization and is assumed to be orthogonal up to uniform scale
+};
+
+layout(std430, set = 0, binding = 0) readonly buffer Instances {
+  Instance instances[];
+};
+
+layout(location = 0) in vec4 quantized_position; // unsigned normalized coordinates in the mesh bounds
+layout(location = 1) in vec2 texture_coordinates;
+layout(location = 2) in vec2 encoded_normal; // octahedral coordinates
+
+layout(location = 0) out Vertex {
+  vec3 position;
+  vec3 normal;
+} vertex;
+
+vec3 DecodeOctahedral(const vec2 encoded_normal) {
+  vec3 normal = vec3(encoded_normal, 1.0 - abs(encoded_normal.x) - abs(encoded_normal.y));
+  const float t = max(-normal.z, 0.0);
+  normal.xy -= t * mix(vec2(-1.0), vec2(1.0), greaterThanEqual(normal.xy, vec2(0.0)));
+  return normalize(normal);
+}
+
+void main() {
+  // the instance index includes the first instance of the indirect draw command which locates its instance group
+  const mat4 model_view_transform = view_transforms.view_transform * instances[gl_InstanceIndex].model_transform;
+  const vec4 model_view_position = model_view_transform * vec4(quantized_position.xyz, 1.0);
+  const mat3 normal_transform = mat3(model_view_transform);
+  vertex.position = model_view_position.xyz;
+  vertex.normal = normalize(normal_transform * DecodeOctahedral(encoded_normal));
+  gl_Position = view_transforms.projection_transform * model_view_position;
+}
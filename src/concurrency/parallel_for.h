@@ -0,0 +1,71 @@
+#ifndef CONCURRENCY_PARALLEL_FOR_H_
+#define CONCURRENCY_PARALLEL_FOR_H_
+
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <exception>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace gfx {
+namespace internal {
+
+/** \brief Indicates if the current thread is processing a subrange of a \c ParallelFor invocation. */
+inline thread_local bool is_parallel_for_thread = false;
+
+}  // namespace internal
+
+/**
+ * \brief Invokes a function over contiguous subranges of [0, size) in parallel across all available hardware threads.
+ * \details The range is split into at most one subrange per hardware thread where each subrange contains at least
+ *          \p min_chunk_size elements. The calling thread processes the first subrange and blocks until all other
+ *          subranges have been processed. If any invocation throws, the first exception is rethrown on the calling
+ *          thread. Nested invocations process the entire range on the calling thread to avoid oversubscribing the
+ *          processor.
+ * \param size The number of elements to process.
+ * \param fn The function to invoke with the half-open subrange [begin, end) to process.
+ * \param min_chunk_size The minimum number of elements processed by a thread to amortize the cost of thread creation.
+ */
+void ParallelFor(const std::size_t size,
+                 std::invocable<std::size_t, std::size_t> auto&& fn,
+                 const std::size_t min_chunk_size = 1024) {
+  const auto max_thread_count = static_cast<std::size_t>(std::max(std::thread::hardware_concurrency(), 1u));
+  const auto thread_count = std::clamp((size + min_chunk_size - 1) / std::max(min_chunk_size, std::size_t{1}),
+                                       std::size_t{1},
+                                       max_thread_count);
+  if (thread_count == 1 || internal::is_parallel_for_thread) {
+    fn(std::size_t{0}, size);
+    return;
+  }
+
+  const auto get_chunk_begin = [=](const std::size_t thread_index) { return size * thread_index / thread_count; };
+  std::vector<std::exception_ptr> exceptions(thread_count);
+  const auto process_chunk = [&](const std::size_t thread_index) {
+    const auto was_parallel_for_thread = std::exchange(internal::is_parallel_for_thread, true);
+    try {
+      fn(get_chunk_begin(thread_index), get_chunk_begin(thread_index + 1));
+    } catch (...) {
+      exceptions[thread_index] = std::current_exception();
+    }
+    internal::is_parallel_for_thread = was_parallel_for_thread;
+  };
+
+  {
+    std::vector<std::jthread> threads;
+    threads.reserve(thread_count - 1);
+    for (std::size_t thread_index = 1; thread_index < thread_count; ++thread_index) {
+      threads.emplace_back(process_chunk, thread_index);
+    }
+    process_chunk(0);
+  }  // join worker threads
+
+  for (const auto& exception : exceptions) {
+    if (exception != nullptr) std::rethrow_exception(exception);
+  }
+}
+
+}  // namespace gfx
+
+#endif  // CONCURRENCY_PARALLEL_FOR_H_
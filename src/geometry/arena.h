@@ -0,0 +1,88 @@
+#ifndef GEOMETRY_ARENA_H_
+#define GEOMETRY_ARENA_H_
+
+#include <cassert>
+#include <cstdint>
+#include <limits>
+#include <ranges>
+#include <utility>
+#include <vector>
+
+namespace gfx {
+
+/** \brief A sentinel index used to represent a missing or unset element in an arena. */
+inline constexpr auto kInvalidIndex = std::numeric_limits<std::uint32_t>::max();
+
+/**
+ * \brief A contiguous array of mesh elements addressed by 32-bit indices.
+ * \details Elements are never moved once inserted. Deleting an element marks its slot with a tombstone so that the
+ *          indices of the remaining elements stay stable for the lifetime of the arena.
+ * \tparam T The element type.
+ */
+template <typename T>
+class Arena {
+public:
+  /** \brief Gets the number of live elements in the arena. */
+  [[nodiscard]] std::size_t size() const noexcept { return size_; }
+
+  /** \brief Gets the number of element slots in the arena including deleted elements. */
+  [[nodiscard]] std::uint32_t slot_count() const noexcept { return static_cast<std::uint32_t>(elements_.size()); }
+
+  /** \brief Determines if the arena contains a live element at the given index. */
+  [[nodiscard]] bool contains(const std::uint32_t index) const noexcept {
+    return index < elements_.size() && tombstones_[index] == 0;
+  }
+
+  /** \brief Gets the indices of all live elements in ascending order. */
+  [[nodiscard]] auto indices() const {
+    return std::views::iota(0u, slot_count())
+           | std::views::filter([this](const auto index) { return tombstones_[index] == 0; });
+  }
+
+  /** \brief Gets the live element at the given index. */
+  [[nodiscard]] T& operator[](const std::uint32_t index) noexcept {
+    assert(contains(index));
+    return elements_[index];
+  }
+
+  /** \brief Gets the live element at the given index. */
+  [[nodiscard]] const T& operator[](const std::uint32_t index) const noexcept {
+    assert(contains(index));
+    return elements_[index];
+  }
+
+  /** \brief Reserves storage for at least \p capacity element slots. */
+  void reserve(const std::size_t capacity) {
+    elements_.reserve(capacity);
+    tombstones_.reserve(capacity);
+  }
+
+  /**
+   * \brief Inserts an element at the end of the arena.
+   * \param element The element to insert.
+   * \return The index of the inserted element.
+   */
+  std::uint32_t Insert(T element) {
+    assert(elements_.size() < kInvalidIndex);
+    elements_.push_back(std::move(element));
+    tombstones_.push_back(0);
+    ++size_;
+    return slot_count() - 1;
+  }
+
+  /** \brief Marks the element at the given index as deleted. */
+  void Erase(const std::uint32_t index) noexcept {
+    assert(contains(index));
+    tombstones_[index] = 1;
+    --size_;
+  }
+
+private:
+  std::vector<T> elements_;
+  std::vector<std::uint8_t> tombstones_;
+  std::size_t size_ = 0;
+};
+
+}  // namespace gfx
+
+#endif  // GEOMETRY_ARENA_H_
@@ -0,0 +1,1066 @@
+#include "geometry/edge_contraction.h"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <ranges>
+#include <span>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include "concurrency/parallel_for.h"
+#include "geometry/quadric.h"
+
+namespace {
+
+/** \brief The cost of an edge contraction which must not be performed. */
+constexpr auto kInvalidCost = std::numeric_limits<float>::infinity();
+
+struct EdgeContraction {
+  glm::vec3 position;
+  gfx::PositionQuadric quadric;
+  float cost;
+};
+
+std::uint32_t GetMinEdge(const gfx::Arena<gfx::HalfEdge>& edges, const std::uint32_t edge01) {
+  const auto edge10 = edges[edge01].flip();
+  return edges[edge01].vertex() < edges[edge10].vertex() ? edge01 : edge10;
+}
+
+gfx::PositionQuadric::Vector ToVector(const glm::vec3& position) noexcept {
+  return {position.x, position.y, position.z};
+}
+
+glm::vec3 ToPosition(const gfx::PositionQuadric::Vector& vector) noexcept {
+  return glm::vec3{vector[0], vector[1], vector[2]};
+}
+
+gfx::PositionQuadric CreateErrorQuadric(const gfx::HalfEdgeMesh& half_edge_mesh, const std::uint32_t v0) {
+  const auto& edges = half_edge_mesh.edges();
+  const auto& vertex = half_edge_mesh.vertices()[v0];
+
+  // accumulate face planes in double precision and round the sum once
+  gfx::Quadric<3, double> quadric;
+  auto edgei0 = vertex.edge();
+
+  do {
+    const auto& position = vertex.position();
+    const auto& normal = half_edge_mesh.faces()[edges[edgei0].face()].normal();
+    quadric += gfx::Quadric<3, double>::FromPlane(ToVector(normal), -glm::dot(position, normal));
+    edgei0 = edges[edges[edgei0].next()].flip();
+  } while (edgei0 != vertex.edge());
+
+  return gfx::PositionQuadric{quadric};
+}
+
+EdgeContraction CreateEdgeContraction(const gfx::HalfEdgeMesh& half_edge_mesh,
+                                      const std::uint32_t edge01,
+                                      const std::vector<gfx::PositionQuadric>& quadrics,
+                                      const gfx::VertexPlacement placement) {
+  const auto& edges = half_edge_mesh.edges();
+  const auto& vertices = half_edge_mesh.vertices();
+
+  const auto v0 = edges[edges[edge01].flip()].vertex();
+  const auto v1 = edges[edge01].vertex();
+  assert(v0 < quadrics.size() && v1 < quadrics.size());
+
+  const auto q01 = quadrics[v0] + quadrics[v1];
+  const auto& position0 = vertices[v0].position();
+  const auto& position1 = vertices[v1].position();
+
+  const auto evaluate = [&](const glm::vec3& position) {
+    return EdgeContraction{.position = position, .quadric = q01, .cost = q01.Error(ToVector(position))};
+  };
+  const auto min_cost = [](const EdgeContraction& lhs, const EdgeContraction& rhs) {
+    return rhs.cost < lhs.cost ? rhs : lhs;
+  };
+
+  switch (placement) {
+    case gfx::VertexPlacement::kOptimal:
+    case gfx::VertexPlacement::kOptimalLineSearch:
+      if (const auto position = q01.Minimize()) {
+        return EdgeContraction{.position = ToPosition(*position), .quadric = q01, .cost = q01.Error(*position)};
+      }
+      if (placement == gfx::VertexPlacement::kOptimalLineSearch) {
+        // the minimum along the edge is at least as good as both edge vertices and the edge midpoint
+        const auto t = q01.MinimizeOnSegment(ToVector(position0), ToVector(position1));
+        return evaluate(glm::mix(position0, position1, t));
+      }
+      // if the quadric is singular or ill-conditioned, choose the edge vertex or edge midpoint with the lowest error
+      return min_cost(min_cost(evaluate(position0), evaluate(position1)), evaluate((position0 + position1) / 2.0f));
+    case gfx::VertexPlacement::kMidpoint:
+      return evaluate((position0 + position1) / 2.0f);
+    case gfx::VertexPlacement::kEndpoint:
+      // keep the edge vertex with the lowest error so the contracted mesh only references existing vertex positions
+      return min_cost(evaluate(position0), evaluate(position1));
+  }
+  std::unreachable();
+}
+
+/**
+ * \brief Computes the cost of contracting each edge in a list.
+ * \details With optimal vertex placement, the combined quadrics of the edges are minimized in batches which vectorizes
+ *          the closed-form solve across edges. Edges whose combined quadric is singular and edges evaluated with other
+ *          vertex placements are evaluated individually.
+ */
+void ComputeEdgeContractionCosts(const gfx::HalfEdgeMesh& half_edge_mesh,
+                                 const std::span<const std::uint32_t> edge_ids,
+                                 const std::vector<gfx::PositionQuadric>& quadrics,
+                                 const gfx::VertexPlacement placement,
+                                 const std::span<float> costs) {
+  assert(edge_ids.size() == costs.size());
+  const auto get_cost = [&](const std::uint32_t edge01) {
+    return CreateEdgeContraction(half_edge_mesh, edge01, quadrics, placement).cost;
+  };
+  if (placement != gfx::VertexPlacement::kOptimal && placement != gfx::VertexPlacement::kOptimalLineSearch) {
+    std::ranges::transform(edge_ids, costs.begin(), get_cost);
+    return;
+  }
+
+  const auto& edges = half_edge_mesh.edges();
+  std::array<gfx::PositionQuadric, gfx::PositionQuadric::kMaxBatchSize> batch;
+  for (std::size_t begin = 0; begin < edge_ids.size(); begin += batch.size()) {
+    const auto batch_size = std::min(batch.size(), edge_ids.size() - begin);
+    const auto batch_edges = edge_ids.subspan(begin, batch_size);
+    const auto batch_costs = costs.subspan(begin, batch_size);
+    for (std::size_t i = 0; i < batch_size; ++i) {
+      batch[i] = quadrics[edges[edges[batch_edges[i]].flip()].vertex()] + quadrics[edges[batch_edges[i]].vertex()];
+    }
+
+    gfx::PositionQuadric::MinimizeErrors(std::span{batch}.first(batch_size), batch_costs);
+    for (std::size_t i = 0; i < batch_size; ++i) {
+      if (std::isnan(batch_costs[i])) batch_costs[i] = get_cost(batch_edges[i]);
+    }
+  }
+}
+
+/** \brief Determines if an edge is the min edge of its half-edge pair and both of its vertices are unlocked. */
+bool IsCandidate(const gfx::Arena<gfx::HalfEdge>& edges,
+                 const std::span<const std::uint8_t> locked_vertices,
+                 const std::uint32_t edge) {
+  const auto is_locked = [&](const std::uint32_t v) { return v < locked_vertices.size() && locked_vertices[v] != 0; };
+  return GetMinEdge(edges, edge) == edge && !is_locked(edges[edge].vertex())
+         && !is_locked(edges[edges[edge].flip()].vertex());
+}
+
+/**
+ * \brief A set of element indices that can be cleared in constant time.
+ * \details Each element stores the generation in which it was last inserted so clearing the set only increments the
+ *          current generation. This allows the set to be reused for every edge contraction without allocating.
+ */
+class VisitedSet {
+public:
+  explicit VisitedSet(const std::size_t capacity) : generations_(capacity, 0) {}
+
+  [[nodiscard]] bool contains(const std::uint32_t index) const noexcept {
+    assert(index < generations_.size());
+    return generations_[index] == generation_;
+  }
+
+  /** \brief Inserts an index into the set and returns \c true if it was not already present. */
+  bool Insert(const std::uint32_t index) noexcept {
+    assert(index < generations_.size());
+    return std::exchange(generations_[index], generation_) != generation_;
+  }
+
+  void Clear() noexcept {
+    // reset stale generations when the generation counter wraps around so they cannot alias the new generation
+    if (++generation_ == 0) {
+      std::ranges::fill(generations_, 0);
+      generation_ = 1;
+    }
+  }
+
+private:
+  std::vector<std::uint32_t> generations_;
+  std::uint32_t generation_ = 1;
+};
+
+bool WillDegenerate(const gfx::Arena<gfx::HalfEdge>& edges, const std::uint32_t edge01, VisitedSet& neighborhood) {
+  const auto edge10 = edges[edge01].flip();
+  const auto v0 = edges[edge10].vertex();
+  const auto v1_next = edges[edges[edge01].next()].vertex();
+  const auto v0_next = edges[edges[edge10].next()].vertex();
+  neighborhood.Clear();
+
+  for (auto iterator = edges[edge01].next(); iterator != edge10; iterator = edges[edges[iterator].flip()].next()) {
+    if (const auto vertex = edges[iterator].vertex(); vertex != v0 && vertex != v1_next && vertex != v0_next) {
+      neighborhood.Insert(vertex);
+    }
+  }
+
+  for (auto iterator = edges[edge10].next(); iterator != edge01; iterator = edges[edges[iterator].flip()].next()) {
+    if (neighborhood.contains(edges[iterator].vertex())) {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+/** \brief Evaluates edge contractions with the error quadric of vertex positions. */
+class PositionMetric {
+public:
+  PositionMetric(std::vector<gfx::PositionQuadric>& quadrics, const gfx::VertexPlacement placement) noexcept
+      : quadrics_{&quadrics}, placement_{placement} {}
+
+  [[nodiscard]] EdgeContraction Evaluate(const gfx::HalfEdgeMesh& half_edge_mesh, const std::uint32_t edge01) const {
+    return CreateEdgeContraction(half_edge_mesh, edge01, *quadrics_, placement_);
+  }
+
+  void EvaluateCosts(const gfx::HalfEdgeMesh& half_edge_mesh,
+                     const std::span<const std::uint32_t> edges,
+                     const std::span<float> costs) const {
+    ComputeEdgeContractionCosts(half_edge_mesh, edges, *quadrics_, placement_, costs);
+  }
+
+  void Apply(const std::uint32_t v_new, const EdgeContraction& edge_contraction) const {
+    assert(v_new == quadrics_->size());
+    quadrics_->push_back(edge_contraction.quadric);
+  }
+
+private:
+  std::vector<gfx::PositionQuadric>* quadrics_;
+  gfx::VertexPlacement placement_;
+};
+
+/** \brief Maps the vertex attributes of an error metric to and from a point in the quadric space. */
+template <gfx::VertexAttributes Attributes>
+struct AttributeLayout {
+  static constexpr auto kHasNormal = Attributes == gfx::VertexAttributes::kPositionNormal
+                                     || Attributes == gfx::VertexAttributes::kPositionNormalTextureCoordinates;
+  static constexpr auto kHasTextureCoordinates =
+      Attributes == gfx::VertexAttributes::kPositionTextureCoordinates
+      || Attributes == gfx::VertexAttributes::kPositionNormalTextureCoordinates;
+  static constexpr std::size_t kDimension = 3 + (kHasNormal ? 3 : 0) + (kHasTextureCoordinates ? 2 : 0);
+
+  using Quadric = gfx::Quadric<kDimension>;
+  using Vector = Quadric::Vector;
+
+  static Vector ToVector(const gfx::Mesh::Vertex& vertex, const float position_scale) noexcept {
+    Vector vector{};
+    std::size_t i = 0;
+    for (glm::length_t j = 0; j < 3; ++j) vector[i++] = vertex.position[j] * position_scale;
+    if constexpr (kHasNormal) {
+      for (glm::length_t j = 0; j < 3; ++j) vector[i++] = vertex.normal[j];
+    }
+    if constexpr (kHasTextureCoordinates) {
+      for (glm::length_t j = 0; j < 2; ++j) vector[i++] = vertex.texture_coordinates[j];
+    }
+    return vector;
+  }
+
+  static void FromVector(const Vector& vector, const float position_scale, gfx::Mesh::Vertex& vertex) noexcept {
+    std::size_t i = 0;
+    for (glm::length_t j = 0; j < 3; ++j) vertex.position[j] = vector[i++] / position_scale;
+    if constexpr (kHasNormal) {
+      for (glm::length_t j = 0; j < 3; ++j) vertex.normal[j] = vector[i++];
+    }
+    if constexpr (kHasTextureCoordinates) {
+      for (glm::length_t j = 0; j < 2; ++j) vertex.texture_coordinates[j] = vector[i++];
+    }
+  }
+};
+
+/** \brief A face corner which references the vertex at the corner and the wedge of attributes used by the face. */
+struct FaceCorner {
+  std::uint32_t vertex;
+  std::uint32_t wedge;
+};
+
+/**
+ * \brief Evaluates edge contractions with generalized error quadrics of vertex positions and attributes.
+ * \details Each wedge of attributes belongs to a single vertex and is shared by the faces around that vertex on the
+ *          same side of any attribute seams. Positions are uniformly scaled to the unit cube so that position and
+ *          attribute errors are comparable regardless of the size of the mesh.
+ */
+template <gfx::VertexAttributes Attributes>
+class AttributeMetric {
+  using Layout = AttributeLayout<Attributes>;
+  using Quadric = Layout::Quadric;
+  using Vector = Layout::Vector;
+
+public:
+  struct EdgeContraction {
+    std::array<std::uint32_t, 2> vertices;
+    glm::vec3 position;
+    std::array<std::array<std::uint32_t, 2>, 2> merged_wedges;  // the wedges of v0 and v1 on each side of the edge
+    std::size_t merged_wedge_count;
+    std::array<Vector, 2> points;
+    std::array<Quadric, 2> quadrics;
+    float cost;
+  };
+
+  AttributeMetric(const gfx::HalfEdgeMesh& half_edge_mesh,
+                  const std::span<const gfx::Mesh::Vertex> wedges,
+                  std::vector<std::array<FaceCorner, 3>> corners)
+      : half_edge_mesh_{&half_edge_mesh},
+        wedges_{wedges.begin(), wedges.end()},
+        wedge_quadrics_(wedges.size()),
+        corners_{std::move(corners)} {
+    const auto& vertices = half_edge_mesh.vertices();
+    const auto& edges = half_edge_mesh.edges();
+    const auto& faces = half_edge_mesh.faces();
+
+    glm::vec3 min{std::numeric_limits<float>::max()};
+    glm::vec3 max{std::numeric_limits<float>::lowest()};
+    for (const auto id : vertices.indices()) {
+      min = glm::min(min, vertices[id].position());
+      max = glm::max(max, vertices[id].position());
+    }
+    const auto extent = max - min;
+    if (const auto max_extent = std::max({extent.x, extent.y, extent.z}); max_extent > 0.0f) {
+      position_scale_ = 1.0f / max_extent;
+    }
+
+    // each edge contraction creates at most two wedges and removes two faces
+    wedges_.reserve(wedges.size() + faces.size());
+    wedge_quadrics_.reserve(wedges_.capacity());
+
+    // each wedge belongs to a single vertex so the quadrics of different vertices can be accumulated concurrently
+    gfx::ParallelFor(vertices.slot_count(), [&](const std::size_t begin, const std::size_t end) {
+      for (auto id = static_cast<std::uint32_t>(begin); id < end; ++id) {
+        if (!vertices.contains(id)) continue;
+        const auto edge_start = vertices[id].edge();
+        auto edgei0 = edge_start;
+        do {
+          const auto face = edges[edgei0].face();
+          const auto& [corner0, corner1, corner2] = corners_[face];
+          auto& quadric = wedge_quadrics_[GetWedge(face, id)];
+          quadric += Quadric{GetPoint(corner0), GetPoint(corner1), GetPoint(corner2)};
+
+          // seam edges incident to the vertex constrain it to remain on the seam
+          const auto edge0k = edges[edgei0].next();
+          for (const auto edge : {edgei0, edge0k}) {
+            if (IsSeam(edge)) quadric += CreateSeamQuadric(edge);
+          }
+          edgei0 = edges[edge0k].flip();
+        } while (edgei0 != edge_start);
+      }
+    });
+  }
+
+  /** \brief Gets the wedges of attributes indexed by wedge ID including wedges removed by edge contraction. */
+  [[nodiscard]] const std::vector<gfx::Mesh::Vertex>& wedges() const noexcept { return wedges_; }
+
+  /** \brief Gets the ID of the wedge referenced by a face at one of its vertices. */
+  [[nodiscard]] std::uint32_t GetWedge(const std::uint32_t face, const std::uint32_t vertex) const noexcept {
+    const auto& corners = corners_[face];
+    const auto iterator = std::ranges::find(corners, vertex, &FaceCorner::vertex);
+    assert(iterator != corners.end());
+    return iterator->wedge;
+  }
+
+  [[nodiscard]] EdgeContraction Evaluate(const gfx::HalfEdgeMesh& half_edge_mesh, const std::uint32_t edge01) const {
+    const auto& vertices = half_edge_mesh.vertices();
+    const auto& edges = half_edge_mesh.edges();
+    const auto edge10 = edges[edge01].flip();
+    const auto v0 = edges[edge10].vertex();
+    const auto v1 = edges[edge01].vertex();
+    const auto face01 = edges[edge01].face();
+    const auto face10 = edges[edge10].face();
+
+    EdgeContraction edge_contraction{
+        .vertices = {v0, v1},
+        .merged_wedges = {{{GetWedge(face01, v0), GetWedge(face01, v1)}, {GetWedge(face10, v0), GetWedge(face10, v1)}}},
+        .cost = kInvalidCost};
+    const auto& merged_wedges = edge_contraction.merged_wedges;
+
+    // a seam which ends at an edge vertex would merge a single wedge of one vertex with two wedges of the other
+    const auto is_seam0 = merged_wedges[0][0] != merged_wedges[1][0];
+    const auto is_seam1 = merged_wedges[0][1] != merged_wedges[1][1];
+    if (is_seam0 != is_seam1) return edge_contraction;
+
+    // a vertex with wedges on other seams stays fixed so that those seams are not moved by the edge contraction
+    const auto is_fixed0 = HasOtherWedges(v0, merged_wedges[0][0], merged_wedges[1][0]);
+    const auto is_fixed1 = HasOtherWedges(v1, merged_wedges[0][1], merged_wedges[1][1]);
+    if (is_fixed0 && is_fixed1) return edge_contraction;
+
+    edge_contraction.merged_wedge_count = is_seam0 ? 2 : 1;
+    for (std::size_t i = 0; i < edge_contraction.merged_wedge_count; ++i) {
+      edge_contraction.quadrics[i] = wedge_quadrics_[merged_wedges[i][0]] + wedge_quadrics_[merged_wedges[i][1]];
+    }
+
+    const auto& position0 = vertices[v0].position();
+    const auto& position1 = vertices[v1].position();
+    const auto evaluate = [&](const glm::vec3& position) { return Place(edge_contraction, position); };
+    const auto min_cost = [](const EdgeContraction& lhs, const EdgeContraction& rhs) {
+      return rhs.cost < lhs.cost ? rhs : lhs;
+    };
+
+    auto min_edge_contraction = [&] {
+      if (is_fixed0) return evaluate(position0);
+      if (is_fixed1) return evaluate(position1);
+
+      // the combined quadric is exact for a single wedge and approximates the position shared by wedges on either
+      // side of a seam in which case the edge vertices and midpoint remain candidates
+      auto quadric = edge_contraction.quadrics[0];
+      if (edge_contraction.merged_wedge_count == 2) quadric += edge_contraction.quadrics[1];
+      const auto point = quadric.Minimize();
+      if (point.has_value() && edge_contraction.merged_wedge_count == 1) return evaluate(GetPosition(*point));
+
+      const auto candidate =
+          min_cost(min_cost(evaluate(position0), evaluate(position1)), evaluate((position0 + position1) / 2.0f));
+      return point.has_value() ? min_cost(candidate, evaluate(GetPosition(*point))) : candidate;
+    }();
+
+    if (WillFlip(half_edge_mesh, edge01, min_edge_contraction.position)) min_edge_contraction.cost = kInvalidCost;
+    return min_edge_contraction;
+  }
+
+  void EvaluateCosts(const gfx::HalfEdgeMesh& half_edge_mesh,
+                     const std::span<const std::uint32_t> edges,
+                     const std::span<float> costs) const {
+    std::ranges::transform(edges, costs.begin(), [&](const std::uint32_t edge01) {
+      return Evaluate(half_edge_mesh, edge01).cost;
+    });
+  }
+
+  void Apply(const std::uint32_t v_new, const EdgeContraction& edge_contraction) {
+    assert(edge_contraction.cost != kInvalidCost);
+
+    // create a wedge for each pair of merged wedges while wedges on other seams of a fixed vertex are kept as is
+    std::array<std::uint32_t, 2> new_wedges{};
+    for (std::size_t i = 0; i < edge_contraction.merged_wedge_count; ++i) {
+      const auto& [w0, w1] = edge_contraction.merged_wedges[i];
+      gfx::Mesh::Vertex wedge{.position = edge_contraction.position,
+                              .texture_coordinates = (wedges_[w0].texture_coordinates + wedges_[w1].texture_coordinates)
+                                                     / 2.0f,
+                              .normal = wedges_[w0].normal + wedges_[w1].normal};
+      Layout::FromVector(edge_contraction.points[i], position_scale_, wedge);
+      if (const auto length = glm::length(wedge.normal); length > 0.0f) wedge.normal /= length;
+
+      new_wedges[i] = static_cast<std::uint32_t>(wedges_.size());
+      wedges_.push_back(wedge);
+      wedge_quadrics_.push_back(edge_contraction.quadrics[i]);
+    }
+    const auto get_new_wedge = [&](const std::uint32_t wedge) {
+      for (std::size_t i = 0; i < edge_contraction.merged_wedge_count; ++i) {
+        if (const auto& [w0, w1] = edge_contraction.merged_wedges[i]; wedge == w0 || wedge == w1) return new_wedges[i];
+      }
+      return wedge;
+    };
+
+    // faces which referenced an edge vertex now reference the new vertex
+    const auto& [v0, v1] = edge_contraction.vertices;
+    const auto& edges = half_edge_mesh_->edges();
+    const auto edge_start = half_edge_mesh_->vertices()[v_new].edge();
+    auto edgei0 = edge_start;
+    do {
+      for (auto& corner : corners_[edges[edgei0].face()]) {
+        if (corner.vertex == v0 || corner.vertex == v1) corner = FaceCorner{v_new, get_new_wedge(corner.wedge)};
+      }
+      edgei0 = edges[edges[edgei0].next()].flip();
+    } while (edgei0 != edge_start);
+  }
+
+private:
+  /** \brief Scales the unit normal of seam constraint planes which weights their error by its square. */
+  static constexpr auto kSeamNormalScale = 4.0f;
+
+  /** \brief The minimum cosine between the normal of a face before and after an edge contraction. */
+  static constexpr auto kMinNormalCosine = 0.25f;
+
+  /** \brief Places the vertex created by an edge contraction and the attributes of each merged wedge. */
+  [[nodiscard]] EdgeContraction Place(EdgeContraction edge_contraction, const glm::vec3& position) const noexcept {
+    edge_contraction.position = position;
+    edge_contraction.cost = 0.0f;
+    for (std::size_t i = 0; i < edge_contraction.merged_wedge_count; ++i) {
+      const auto& quadric = edge_contraction.quadrics[i];
+      const auto& [w0, w1] = edge_contraction.merged_wedges[i];
+      auto point = GetPoint(position, w0);
+      if constexpr (Layout::kDimension > 3) {
+        // attributes minimize the quadric error at the vertex position or otherwise keep the wedge with lower error
+        if (const auto minimum = quadric.template Minimize<3>(point)) {
+          point = *minimum;
+        } else if (const auto point1 = GetPoint(position, w1); quadric.Error(point1) < quadric.Error(point)) {
+          point = point1;
+        }
+      }
+      edge_contraction.points[i] = point;
+      edge_contraction.cost += quadric.Error(point);
+    }
+    return edge_contraction;
+  }
+
+  /** \brief Determines if a vertex has a wedge other than the two wedges merged by an edge contraction. */
+  [[nodiscard]] bool HasOtherWedges(const std::uint32_t v, const std::uint32_t w0, const std::uint32_t w1) const {
+    const auto& edges = half_edge_mesh_->edges();
+    const auto edge_start = half_edge_mesh_->vertices()[v].edge();
+    auto edgei0 = edge_start;
+    do {
+      if (const auto wedge = GetWedge(edges[edgei0].face(), v); wedge != w0 && wedge != w1) return true;
+      edgei0 = edges[edges[edgei0].next()].flip();
+    } while (edgei0 != edge_start);
+    return false;
+  }
+
+  /** \brief Determines if the faces on either side of an edge reference different wedges at either edge vertex. */
+  [[nodiscard]] bool IsSeam(const std::uint32_t edge01) const {
+    const auto& edges = half_edge_mesh_->edges();
+    const auto edge10 = edges[edge01].flip();
+    const auto face01 = edges[edge01].face();
+    const auto face10 = edges[edge10].face();
+    return std::ranges::any_of(std::array{edges[edge01].vertex(), edges[edge10].vertex()}, [&](const auto v) {
+      return GetWedge(face01, v) != GetWedge(face10, v);
+    });
+  }
+
+  /** \brief Creates the quadric of the plane through a seam edge perpendicular to the face of the half-edge. */
+  [[nodiscard]] Quadric CreateSeamQuadric(const std::uint32_t edge01) const {
+    const auto& vertices = half_edge_mesh_->vertices();
+    const auto& edges = half_edge_mesh_->edges();
+    const auto position0 = vertices[edges[edges[edge01].flip()].vertex()].position() * position_scale_;
+    const auto position1 = vertices[edges[edge01].vertex()].position() * position_scale_;
+    const auto& face_normal = half_edge_mesh_->faces()[edges[edge01].face()].normal();
+    const auto normal = glm::normalize(glm::cross(position1 - position0, face_normal)) * kSeamNormalScale;
+
+    Vector plane_normal{};
+    for (glm::length_t i = 0; i < 3; ++i) plane_normal[static_cast<std::size_t>(i)] = normal[i];
+    return Quadric::FromPlane(plane_normal, -glm::dot(normal, position0));
+  }
+
+  /** \brief Determines if moving the edge vertices to a position flips or degenerates any remaining face. */
+  [[nodiscard]] static bool WillFlip(const gfx::HalfEdgeMesh& half_edge_mesh,
+                                     const std::uint32_t edge01,
+                                     const glm::vec3& position) {
+    const auto& vertices = half_edge_mesh.vertices();
+    const auto& edges = half_edge_mesh.edges();
+    const auto& faces = half_edge_mesh.faces();
+    const auto edge10 = edges[edge01].flip();
+    const std::array removed_faces{edges[edge01].face(), edges[edge10].face()};
+
+    for (const auto vi : {edges[edge10].vertex(), edges[edge01].vertex()}) {
+      const auto edge_start = vertices[vi].edge();
+      auto edgeji = edge_start;
+      do {
+        const auto face = edges[edgeji].face();
+        const auto edgeik = edges[edgeji].next();
+        if (face != removed_faces[0] && face != removed_faces[1]) {
+          // faces incident to both edge vertices are removed so the other face vertices are never moved
+          const auto& position_k = vertices[edges[edgeik].vertex()].position();
+          const auto& position_j = vertices[edges[edges[edgeik].next()].vertex()].position();
+          const auto normal = glm::cross(position_k - position, position_j - position);
+          if (glm::dot(normal, faces[face].normal()) <= kMinNormalCosine * glm::length(normal)) return true;
+        }
+        edgeji = edges[edgeik].flip();
+      } while (edgeji != edge_start);
+    }
+    return false;
+  }
+
+  [[nodiscard]] Vector GetPoint(const FaceCorner& corner) const noexcept {
+    return GetPoint(half_edge_mesh_->vertices()[corner.vertex].position(), corner.wedge);
+  }
+
+  [[nodiscard]] Vector GetPoint(const glm::vec3& position, const std::uint32_t wedge) const noexcept {
+    auto vertex = wedges_[wedge];
+    vertex.position = position;
+    return Layout::ToVector(vertex, position_scale_);
+  }
+
+  [[nodiscard]] glm::vec3 GetPosition(const Vector& point) const noexcept {
+    return glm::vec3{point[0], point[1], point[2]} / position_scale_;
+  }
+
+  const gfx::HalfEdgeMesh* half_edge_mesh_;
+  std::vector<gfx::Mesh::Vertex> wedges_;
+  std::vector<Quadric> wedge_quadrics_;
+  std::vector<std::array<FaceCorner, 3>> corners_;  // indexed by face ID
+  float position_scale_ = 1.0f;
+};
+
+/**
+ * \brief Creates a queue of edge contraction candidates sorted by the cost of contracting each edge.
+ * \param get_cost A function that computes the cost of contracting an edge which is invoked concurrently.
+ */
+template <typename GetCost>
+gfx::IndexedMinHeap CreateEdgeContractions(const gfx::HalfEdgeMesh& half_edge_mesh,
+                                           const std::span<const std::uint8_t> locked_vertices,
+                                           const GetCost& get_cost) {
+  const auto& edges = half_edge_mesh.edges();
+  const auto is_candidate = [&](const std::uint32_t edge) { return IsCandidate(edges, locked_vertices, edge); };
+
+  // compute the cost of contracting each edge in parallel
+  std::vector<float> edge_costs(edges.slot_count());
+  gfx::ParallelFor(edge_costs.size(), [&](const std::size_t begin, const std::size_t end) {
+    for (auto edge = static_cast<std::uint32_t>(begin); edge < end; ++edge) {
+      if (edges.contains(edge) && is_candidate(edge)) {
+        edge_costs[edge] = get_cost(edge);
+      }
+    }
+  });
+
+  // use an indexed min-heap keyed by edge index to sort edge contraction candidates by the cost of removing each edge
+  gfx::IndexedMinHeap edge_contractions{edges.slot_count()};
+  edge_contractions.Heapify(edges.indices() | std::views::filter(is_candidate)
+                            | std::views::transform([&](const std::uint32_t edge) {
+                                return std::pair{edge, edge_costs[edge]};
+                              }));
+  return edge_contractions;
+}
+
+/**
+ * \brief Contracts edges in order of increasing cost.
+ * \param metric The error metric which evaluates the cost of each edge contraction individually or for a list of
+ *               edges at once and updates its per-vertex state when an edge contraction is performed.
+ */
+template <typename Metric>
+float ContractEdges(gfx::HalfEdgeMesh& half_edge_mesh,
+                    Metric& metric,
+                    gfx::IndexedMinHeap& edge_contractions,
+                    const std::span<const std::uint8_t> locked_vertices,
+                    const float target_face_count,
+                    const float max_cost,
+                    std::vector<gfx::EdgeContractionRecord>* const records) {
+  const auto& vertices = half_edge_mesh.vertices();
+  const auto& edges = half_edge_mesh.edges();
+  const auto is_candidate = [&](const std::uint32_t edge) { return IsCandidate(edges, locked_vertices, edge); };
+
+  // stop mesh simplification if the number of triangles has been sufficiently reduced or no remaining edge can be
+  // contracted
+  const auto is_simplified = [&] {
+    const auto face_count = static_cast<float>(half_edge_mesh.faces().size());
+    return edge_contractions.empty() || face_count < target_face_count || edge_contractions.top_priority() > max_cost
+           || edge_contractions.top_priority() == kInvalidCost;
+  };
+
+  // scratch sets are allocated once so that contracting an edge does not allocate where vertex IDs are bounded by the
+  // initial vertex count plus one new vertex for every two faces removed
+  VisitedSet neighborhood{vertices.slot_count() + half_edge_mesh.faces().size() / 2};
+  VisitedSet visited_edges{edges.slot_count()};
+  std::vector<std::uint32_t> affected_edges;
+  std::vector<float> affected_costs;
+  affected_edges.reserve(edges.slot_count());
+  affected_costs.reserve(edges.slot_count());
+
+  auto max_contracted_cost = 0.0f;
+  while (!is_simplified()) {
+    const auto cost = edge_contractions.top_priority();
+    const auto edge01 = edge_contractions.Pop();
+    if (WillDegenerate(edges, edge01, neighborhood)) continue;
+    max_contracted_cost = std::max(max_contracted_cost, cost);
+
+    // remove entries from the heap for edges that will be removed or updated during the edge contraction
+    for (const auto vi : {edges[edges[edge01].flip()].vertex(), edges[edge01].vertex()}) {
+      const auto edge_start = vertices[vi].edge();
+      auto edgeji = edge_start;
+      do {
+        if (const auto min_edge = GetMinEdge(edges, edgeji); edge_contractions.contains(min_edge)) {
+          edge_contractions.Erase(min_edge);
+        }
+        edgeji = edges[edges[edgeji].next()].flip();
+      } while (edgeji != edge_start);
+    }
+
+    // candidates are not stored in the heap so the contraction is recomputed from the current vertex quadrics
+    const auto edge_contraction = metric.Evaluate(half_edge_mesh, edge01);
+
+    // faces adjacent to the edge are removed by the edge contraction and must be recorded beforehand
+    if (records != nullptr) {
+      const auto edge10 = edges[edge01].flip();
+      records->push_back(gfx::EdgeContractionRecord{.vertices = {edges[edge10].vertex(), edges[edge01].vertex()},
+                                                    .position = edge_contraction.position,
+                                                    .faces = {edges[edge01].face(), edges[edge10].face()}});
+    }
+
+    // remove the edge from the mesh and attach incident edges to the new vertex
+    const auto v_new = half_edge_mesh.Contract(edge01, edge_contraction.position);
+    metric.Apply(v_new, edge_contraction);
+    if (records != nullptr) records->back().new_vertex = v_new;
+
+    // collect edge contraction candidates affected by the edge contraction
+    affected_edges.clear();
+    visited_edges.Clear();
+    const auto vi_edge = vertices[v_new].edge();
+    auto edgeji = vi_edge;
+    do {
+      const auto vj_edge = vertices[edges[edges[edgeji].flip()].vertex()].edge();
+      auto edgekj = vj_edge;
+      do {
+        if (const auto min_edge = GetMinEdge(edges, edgekj);
+            visited_edges.Insert(min_edge) && is_candidate(min_edge)) {
+          affected_edges.push_back(min_edge);
+        }
+        edgekj = edges[edges[edgekj].next()].flip();
+      } while (edgekj != vj_edge);
+      edgeji = edges[edges[edgeji].next()].flip();
+    } while (edgeji != vi_edge);
+
+    // re-evaluate the affected candidates at once and add or update them in the heap
+    affected_costs.resize(affected_edges.size());
+    metric.EvaluateCosts(half_edge_mesh, affected_edges, affected_costs);
+    for (std::size_t i = 0; i < affected_edges.size(); ++i) {
+      edge_contractions.Push(affected_edges[i], affected_costs[i]);
+    }
+  }
+
+  return max_contracted_cost;
+}
+
+/**
+ * \brief Welds mesh vertices referenced by faces which have the same position.
+ * \return The welded vertex positions and the welded vertex ID of each mesh vertex or \c kInvalidIndex if the vertex
+ *         is not referenced by any face.
+ */
+std::pair<std::vector<glm::vec3>, std::vector<std::uint32_t>> WeldVertices(
+    const std::span<const gfx::Mesh::Vertex> vertices,
+    const std::span<const std::uint32_t> indices) {
+  std::vector<std::uint32_t> vertex_ids(vertices.size(), gfx::kInvalidIndex);
+  for (const auto index : indices) vertex_ids[index] = 0;
+
+  // sort referenced vertices by position so that vertices with the same position are adjacent
+  auto sorted_ids = std::views::iota(0u, static_cast<std::uint32_t>(vertices.size()))
+                    | std::views::filter([&](const auto id) { return vertex_ids[id] != gfx::kInvalidIndex; })
+                    | std::ranges::to<std::vector>();
+  std::ranges::sort(sorted_ids, {}, [&](const auto id) {
+    const auto& position = vertices[id].position;
+    return std::array{position.x, position.y, position.z};
+  });
+
+  std::vector<glm::vec3> positions;
+  for (const auto id : sorted_ids) {
+    if (positions.empty() || positions.back() != vertices[id].position) positions.push_back(vertices[id].position);
+    vertex_ids[id] = static_cast<std::uint32_t>(positions.size() - 1);
+  }
+  return {std::move(positions), std::move(vertex_ids)};
+}
+
+/** \brief Determines if each edge of a mesh is shared by exactly two faces with opposite orientations. */
+bool IsClosedManifold(const std::span<const std::uint32_t> indices) {
+  std::vector<std::uint64_t> directed_edges;
+  directed_edges.reserve(indices.size());
+  for (std::size_t i = 0; i < indices.size(); i += 3) {
+    for (std::size_t j = 0; j < 3; ++j) {
+      const auto v0 = indices[i + j];
+      const auto v1 = indices[i + (j + 1) % 3];
+      if (v0 == v1) return false;
+      directed_edges.push_back(static_cast<std::uint64_t>(v0) << 32u | v1);
+    }
+  }
+
+  std::ranges::sort(directed_edges);
+  return std::ranges::adjacent_find(directed_edges) == directed_edges.end()
+         && std::ranges::all_of(directed_edges, [&](const auto directed_edge) {
+              return std::ranges::binary_search(directed_edges, std::rotl(directed_edge, 32));
+            });
+}
+
+/** \brief Marks the closed one-ring of an edge and returns \c false if any of its vertices were already marked. */
+bool InsertNeighborhood(const gfx::HalfEdgeMesh& half_edge_mesh, const std::uint32_t edge01, VisitedSet& marked) {
+  const auto& vertices = half_edge_mesh.vertices();
+  const auto& edges = half_edge_mesh.edges();
+  const auto edge10 = edges[edge01].flip();
+
+  // check every vertex before marking so a rejected edge does not block later edges
+  for (const auto vi : {edges[edge10].vertex(), edges[edge01].vertex()}) {
+    if (marked.contains(vi)) return false;
+    const auto edge_start = vertices[vi].edge();
+    auto edgeji = edge_start;
+    do {
+      if (marked.contains(edges[edges[edgeji].flip()].vertex())) return false;
+      edgeji = edges[edges[edgeji].next()].flip();
+    } while (edgeji != edge_start);
+  }
+
+  for (const auto vi : {edges[edge10].vertex(), edges[edge01].vertex()}) {
+    marked.Insert(vi);
+    const auto edge_start = vertices[vi].edge();
+    auto edgeji = edge_start;
+    do {
+      marked.Insert(edges[edges[edgeji].flip()].vertex());
+      edgeji = edges[edges[edgeji].next()].flip();
+    } while (edgeji != edge_start);
+  }
+
+  return true;
+}
+
+}  // namespace
+
+namespace gfx {
+
+std::vector<PositionQuadric> CreateErrorQuadrics(const HalfEdgeMesh& half_edge_mesh,
+                                                 const std::uint32_t vertex_count) {
+  const auto& vertices = half_edge_mesh.vertices();
+
+  // each edge contraction appends the quadric of the new vertex it creates which removes at least two faces
+  std::vector<PositionQuadric> quadrics(vertices.slot_count());
+  quadrics.reserve(vertices.slot_count() + half_edge_mesh.faces().size() / 2);
+
+  ParallelFor(vertex_count, [&](const std::size_t begin, const std::size_t end) {
+    for (auto id = static_cast<std::uint32_t>(begin); id < end; ++id) {
+      if (vertices.contains(id)) quadrics[id] = CreateErrorQuadric(half_edge_mesh, id);
+    }
+  });
+
+  return quadrics;
+}
+
+IndexedMinHeap CreateEdgeContractions(const HalfEdgeMesh& half_edge_mesh,
+                                      const std::vector<PositionQuadric>& quadrics,
+                                      const std::span<const std::uint8_t> locked_vertices,
+                                      const VertexPlacement placement) {
+  return ::CreateEdgeContractions(half_edge_mesh, locked_vertices, [&](const std::uint32_t edge) {
+    return CreateEdgeContraction(half_edge_mesh, edge, quadrics, placement).cost;
+  });
+}
+
+void ContractEdges(HalfEdgeMesh& half_edge_mesh,
+                   std::vector<PositionQuadric>& quadrics,
+                   const std::span<const std::uint8_t> locked_vertices,
+                   const float target_face_count,
+                   const VertexPlacement placement) {
+  auto edge_contractions = CreateEdgeContractions(half_edge_mesh, quadrics, locked_vertices, placement);
+  ContractEdges(half_edge_mesh, quadrics, edge_contractions, locked_vertices, placement, target_face_count);
+}
+
+void ContractIndependentEdges(HalfEdgeMesh& half_edge_mesh,
+                              std::vector<PositionQuadric>& quadrics,
+                              const std::span<const std::uint8_t> locked_vertices,
+                              const float target_face_count,
+                              const VertexPlacement placement) {
+  static constexpr std::size_t kRoundCandidateFraction = 8;
+
+  const auto& vertices = half_edge_mesh.vertices();
+  const auto& edges = half_edge_mesh.edges();
+  const auto& faces = half_edge_mesh.faces();
+  const auto is_candidate = [&](const std::uint32_t edge) { return IsCandidate(edges, locked_vertices, edge); };
+  const auto evaluate = [&](const std::uint32_t edge) {
+    return CreateEdgeContraction(half_edge_mesh, edge, quadrics, placement);
+  };
+
+  auto edge_contractions = CreateEdgeContractions(half_edge_mesh, quadrics, locked_vertices, placement);
+  VisitedSet neighborhood{vertices.slot_count() + faces.size() / 2};
+  VisitedSet marked_vertices{vertices.slot_count() + faces.size() / 2};
+  VisitedSet visited_edges{edges.slot_count()};
+
+  std::vector<std::pair<std::uint32_t, float>> deferred_edges;
+  std::vector<std::uint32_t> selected_edges;
+  std::vector<EdgeContraction> selected_contractions;
+  std::vector<glm::vec3> positions;
+  std::vector<std::uint32_t> affected_edges;
+  std::vector<float> affected_costs;
+
+  while (!edge_contractions.empty() && static_cast<float>(faces.size()) >= target_face_count) {
+    // each edge contraction removes two faces so select no more edges than required to reach the target face count
+    const auto remaining_contraction_count =
+        static_cast<std::size_t>((static_cast<float>(faces.size()) - target_face_count) / 2.0f) + 1;
+    const auto max_candidate_count = edge_contractions.size() / kRoundCandidateFraction + 1;
+
+    // greedily select the lowest cost edges whose closed one-rings do not overlap those of previously selected edges
+    deferred_edges.clear();
+    selected_edges.clear();
+    marked_vertices.Clear();
+    for (std::size_t i = 0; i < max_candidate_count && selected_edges.size() < remaining_contraction_count
+                            && !edge_contractions.empty();
+         ++i) {
+      const auto cost = edge_contractions.top_priority();
+      const auto edge01 = edge_contractions.Pop();
+      if (WillDegenerate(edges, edge01, neighborhood)) continue;
+      if (InsertNeighborhood(half_edge_mesh, edge01, marked_vertices)) {
+        selected_edges.push_back(edge01);
+      } else {
+        deferred_edges.emplace_back(edge01, cost);
+      }
+    }
+    for (const auto& [edge, cost] : deferred_edges) edge_contractions.Push(edge, cost);
+
+    // remove entries from the heap for edges that will be removed or updated during edge contraction
+    for (const auto edge01 : selected_edges) {
+      for (const auto vi : {edges[edges[edge01].flip()].vertex(), edges[edge01].vertex()}) {
+        const auto edge_start = vertices[vi].edge();
+        auto edgeji = edge_start;
+        do {
+          if (const auto min_edge = GetMinEdge(edges, edgeji); edge_contractions.contains(min_edge)) {
+            edge_contractions.Erase(min_edge);
+          }
+          edgeji = edges[edges[edgeji].next()].flip();
+        } while (edgeji != edge_start);
+      }
+    }
+
+    // evaluate and perform the selected edge contractions concurrently
+    selected_contractions.resize(selected_edges.size());
+    positions.resize(selected_edges.size());
+    ParallelFor(selected_edges.size(), [&](const std::size_t begin, const std::size_t end) {
+      for (auto i = begin; i < end; ++i) {
+        selected_contractions[i] = evaluate(selected_edges[i]);
+        positions[i] = selected_contractions[i].position;
+      }
+    });
+
+    const auto v_first = half_edge_mesh.Contract(selected_edges, positions);
+    assert(v_first == quadrics.size());
+    for (const auto& edge_contraction : selected_contractions) quadrics.push_back(edge_contraction.quadric);
+
+    // collect edge contraction candidates affected by any edge contraction in the round
+    affected_edges.clear();
+    visited_edges.Clear();
+    for (auto v_new = v_first; v_new < vertices.slot_count(); ++v_new) {
+      const auto vi_edge = vertices[v_new].edge();
+      auto edgeji = vi_edge;
+      do {
+        const auto vj_edge = vertices[edges[edges[edgeji].flip()].vertex()].edge();
+        auto edgekj = vj_edge;
+        do {
+          if (const auto min_edge = GetMinEdge(edges, edgekj);
+              visited_edges.Insert(min_edge) && is_candidate(min_edge)) {
+            affected_edges.push_back(min_edge);
+          }
+          edgekj = edges[edges[edgekj].next()].flip();
+        } while (edgekj != vj_edge);
+        edgeji = edges[edges[edgeji].next()].flip();
+      } while (edgeji != vi_edge);
+    }
+
+    // re-evaluate affected candidates concurrently and update the heap serially
+    affected_costs.resize(affected_edges.size());
+    ParallelFor(affected_edges.size(), [&](const std::size_t begin, const std::size_t end) {
+      ComputeEdgeContractionCosts(half_edge_mesh,
+                                  std::span{affected_edges}.subspan(begin, end - begin),
+                                  quadrics,
+                                  placement,
+                                  std::span{affected_costs}.subspan(begin, end - begin));
+    });
+    for (std::size_t i = 0; i < affected_edges.size(); ++i) {
+      edge_contractions.Push(affected_edges[i], affected_costs[i]);
+    }
+  }
+}
+
+float ContractEdges(HalfEdgeMesh& half_edge_mesh,
+                    std::vector<PositionQuadric>& quadrics,
+                    IndexedMinHeap& edge_contractions,
+                    const std::span<const std::uint8_t> locked_vertices,
+                    const VertexPlacement placement,
+                    const float target_face_count,
+                    const float max_cost,
+                    std::vector<EdgeContractionRecord>* const records) {
+  PositionMetric metric{quadrics, placement};
+  return ::ContractEdges(
+      half_edge_mesh, metric, edge_contractions, locked_vertices, target_face_count, max_cost, records);
+}
+
+AttributeMesh SimplifyWithAttributes(const std::span<const Mesh::Vertex> vertices,
+                                     const std::span<const std::uint32_t> indices,
+                                     const VertexAttributes attributes,
+                                     const float target_face_count) {
+  // vertices split at attribute seams are welded so that the faces on either side of a seam are connected
+  const auto [positions, vertex_ids] = WeldVertices(vertices, indices);
+  const auto welded_indices = indices | std::views::transform([&](const auto index) { return vertex_ids[index]; })
+                              | std::ranges::to<std::vector>();
+  if (!IsClosedManifold(welded_indices)) {
+    throw std::invalid_argument{"Mesh simplification with vertex attributes requires a closed manifold mesh"};
+  }
+  HalfEdgeMesh half_edge_mesh{positions, welded_indices};
+
+  // face IDs follow the order of faces in the index buffer where each face corner references a mesh vertex as its wedge
+  std::vector<std::array<FaceCorner, 3>> corners(indices.size() / 3);
+  for (std::size_t i = 0; i < indices.size(); ++i) {
+    corners[i / 3][i % 3] = FaceCorner{.vertex = welded_indices[i], .wedge = indices[i]};
+  }
+
+  AttributeMesh simplified_mesh;
+  const auto contract_edges = [&]<VertexAttributes Attributes>() {
+    AttributeMetric<Attributes> metric{half_edge_mesh, vertices, std::move(corners)};
+    auto edge_contractions = ::CreateEdgeContractions(half_edge_mesh, {}, [&](const std::uint32_t edge) {
+      return metric.Evaluate(half_edge_mesh, edge).cost;
+    });
+    ::ContractEdges(half_edge_mesh,
+                    metric,
+                    edge_contractions,
+                    {},
+                    target_face_count,
+                    std::numeric_limits<float>::infinity(),
+                    nullptr);
+
+    // emit each wedge referenced by the remaining faces once with the position of its vertex
+    const auto& mesh_vertices = half_edge_mesh.vertices();
+    const auto& faces = half_edge_mesh.faces();
+    std::vector<std::uint32_t> index_map(metric.wedges().size(), kInvalidIndex);
+    simplified_mesh.indices.reserve(3 * faces.size());
+    for (const auto id : faces.indices()) {
+      const auto& face = faces[id];
+      for (const auto v : {face.v0(), face.v1(), face.v2()}) {
+        const auto wedge = metric.GetWedge(id, v);
+        if (index_map[wedge] == kInvalidIndex) {
+          index_map[wedge] = static_cast<std::uint32_t>(simplified_mesh.vertices.size());
+          auto& vertex = simplified_mesh.vertices.emplace_back(metric.wedges()[wedge]);
+          vertex.position = mesh_vertices[v].position();
+        }
+        simplified_mesh.indices.push_back(index_map[wedge]);
+      }
+    }
+  };
+
+  // dispatch to an error metric specialized for the dimension of the vertex attribute layout
+  switch (attributes) {
+    case VertexAttributes::kPosition:
+      contract_edges.operator()<VertexAttributes::kPosition>();
+      break;
+    case VertexAttributes::kPositionNormal:
+      contract_edges.operator()<VertexAttributes::kPositionNormal>();
+      break;
+    case VertexAttributes::kPositionTextureCoordinates:
+      contract_edges.operator()<VertexAttributes::kPositionTextureCoordinates>();
+      break;
+    case VertexAttributes::kPositionNormalTextureCoordinates:
+      contract_edges.operator()<VertexAttributes::kPositionNormalTextureCoordinates>();
+      break;
+  }
+
+  return simplified_mesh;
+}
+
+SimplifiedRegion SimplifyRegion(const MeshRegion& region, const float rate, const VertexPlacement placement) {
+  const auto is_locked = [&](const std::uint32_t v) { return region.locked_vertices[v] != 0; };
+  const auto initial_vertex_count = static_cast<std::uint32_t>(region.positions.size());
+
+  // faces incident to a locked vertex cannot be removed so only the remaining faces count toward the reduction rate
+  const auto locked_face_count = static_cast<std::size_t>(
+      std::ranges::count_if(region.indices | std::views::take(3 * region.face_count) | std::views::chunk(3),
+                            [&](const auto& index_group) { return std::ranges::any_of(index_group, is_locked); }));
+  const auto interior_face_count = region.face_count - locked_face_count;
+  const auto fixed_face_count = region.indices.size() / 3 - interior_face_count;
+
+  HalfEdgeMesh half_edge_mesh{region.positions, region.indices};
+  auto quadrics = CreateErrorQuadrics(half_edge_mesh, region.closed_vertex_count);
+  ContractEdges(half_edge_mesh,
+                quadrics,
+                region.locked_vertices,
+                (1.0f - rate) * static_cast<float>(interior_face_count) + static_cast<float>(fixed_face_count),
+                placement);
+
+  // collect faces owned by the region and the vertices they reference in order of first use
+  const auto& vertices = half_edge_mesh.vertices();
+  const auto& faces = half_edge_mesh.faces();
+  std::vector<std::uint32_t> output_ids(vertices.slot_count(), kInvalidIndex);
+  SimplifiedRegion simplified_region;
+
+  for (const auto id : faces.indices()) {
+    if (id >= region.face_count) break;
+    const auto& face = faces[id];
+    for (const auto v : {face.v0(), face.v1(), face.v2()}) {
+      if (output_ids[v] == kInvalidIndex) {
+        output_ids[v] = static_cast<std::uint32_t>(simplified_region.positions.size());
+        simplified_region.positions.push_back(vertices[v].position());
+        simplified_region.quadrics.push_back(quadrics[v]);
+        simplified_region.locked_vertex_ids.push_back(v < initial_vertex_count && is_locked(v) ? v : kInvalidIndex);
+      }
+      simplified_region.indices.push_back(output_ids[v]);
+    }
+  }
+
+  return simplified_region;
+}
+
+}  // namespace gfx
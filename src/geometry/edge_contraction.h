@@ -0,0 +1,193 @@
+#ifndef GEOMETRY_EDGE_CONTRACTION_H_
+#define GEOMETRY_EDGE_CONTRACTION_H_
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <vector>
+
+#include <glm/vec3.hpp>
+
+#include "geometry/half_edge_mesh.h"
+#include "geometry/indexed_min_heap.h"
+#include "geometry/quadric.h"
+#include "geometry/vertex_attributes.h"
+#include "geometry/vertex_placement.h"
+#include "graphics/mesh.h"
+
+namespace gfx {
+
+/** \brief The error quadric of a vertex position which measures the squared distance to a set of planes. */
+using PositionQuadric = Quadric<3>;
+
+/**
+ * \brief Computes the error quadric of each vertex in a mesh in parallel.
+ * \param half_edge_mesh The mesh to compute vertex quadrics for.
+ * \param vertex_count The number of vertices starting from ID 0 to compute quadrics for. Each of these vertices must
+ *                     have a closed one-ring.
+ * \return The error quadric of each vertex indexed by vertex ID.
+ */
+std::vector<PositionQuadric> CreateErrorQuadrics(const HalfEdgeMesh& half_edge_mesh, std::uint32_t vertex_count);
+
+/** \brief An edge contraction performed during mesh simplification which can be reversed by a vertex split. */
+struct EdgeContractionRecord {
+  /** \brief The IDs of the vertices merged by the edge contraction. */
+  std::array<std::uint32_t, 2> vertices{};
+
+  /** \brief The ID of the vertex created by the edge contraction. */
+  std::uint32_t new_vertex = 0;
+
+  /** \brief The position of the vertex created by the edge contraction. */
+  glm::vec3 position{0.0f};
+
+  /** \brief The IDs of the faces removed by the edge contraction. */
+  std::array<std::uint32_t, 2> faces{};
+};
+
+/**
+ * \brief Creates a queue of edge contraction candidates sorted by the cost of contracting each edge.
+ * \param half_edge_mesh The mesh to simplify.
+ * \param quadrics The error quadric of each vertex indexed by vertex ID.
+ * \param locked_vertices Flags indexed by vertex ID indicating which vertices must not be removed from the mesh.
+ * \param placement Determines where the vertex created by each edge contraction is placed.
+ * \return An indexed min-heap of edge IDs keyed by edge contraction cost.
+ */
+IndexedMinHeap CreateEdgeContractions(const HalfEdgeMesh& half_edge_mesh,
+                                      const std::vector<PositionQuadric>& quadrics,
+                                      std::span<const std::uint8_t> locked_vertices,
+                                      VertexPlacement placement = VertexPlacement::kOptimal);
+
+/**
+ * \brief Contracts edges in order of increasing cost until the mesh has fewer than a target number of faces.
+ * \param half_edge_mesh The mesh to simplify.
+ * \param quadrics The error quadric of each vertex indexed by vertex ID.
+ * \param locked_vertices Flags indexed by vertex ID indicating which vertices must not be removed from the mesh. Only
+ *                        vertices with a closed one-ring may be adjacent to an unlocked vertex.
+ * \param target_face_count The number of faces to reduce the mesh to.
+ * \param placement Determines where the vertex created by each edge contraction is placed.
+ */
+void ContractEdges(HalfEdgeMesh& half_edge_mesh,
+                   std::vector<PositionQuadric>& quadrics,
+                   std::span<const std::uint8_t> locked_vertices,
+                   float target_face_count,
+                   VertexPlacement placement = VertexPlacement::kOptimal);
+
+/**
+ * \brief Contracts edges in rounds of independent edge contractions performed concurrently until the mesh has fewer
+ *        than a target number of faces.
+ * \details Each round greedily selects low cost edges whose closed one-rings do not overlap, contracts them in
+ *          parallel, and re-evaluates the affected edge contraction candidates in parallel. Candidate selection and
+ *          heap updates remain serial. Edges selected in the same round do not observe cost updates caused by one
+ *          another so the simplified mesh may differ slightly from the mesh produced by ContractEdges.
+ * \param half_edge_mesh The mesh to simplify.
+ * \param quadrics The error quadric of each vertex indexed by vertex ID.
+ * \param locked_vertices Flags indexed by vertex ID indicating which vertices must not be removed from the mesh. Only
+ *                        vertices with a closed one-ring may be adjacent to an unlocked vertex.
+ * \param target_face_count The number of faces to reduce the mesh to.
+ * \param placement Determines where the vertex created by each edge contraction is placed.
+ */
+void ContractIndependentEdges(HalfEdgeMesh& half_edge_mesh,
+                              std::vector<PositionQuadric>& quadrics,
+                              std::span<const std::uint8_t> locked_vertices,
+                              float target_face_count,
+                              VertexPlacement placement = VertexPlacement::kOptimal);
+
+/**
+ * \brief Contracts edges from an existing queue of edge contraction candidates.
+ * \details The queue is kept consistent with the mesh so edge contraction can be resumed with a lower target face
+ *          count without recomputing vertex quadrics or edge contraction costs. Scratch storage is allocated once per
+ *          call so contracting each edge performs no heap allocations provided \p records has sufficient capacity.
+ * \param half_edge_mesh The mesh to simplify.
+ * \param quadrics The error quadric of each vertex indexed by vertex ID.
+ * \param edge_contractions The edge contraction candidates created by CreateEdgeContractions for \p half_edge_mesh.
+ * \param locked_vertices The flags used to create \p edge_contractions.
+ * \param placement The vertex placement used to create \p edge_contractions.
+ * \param target_face_count The number of faces to reduce the mesh to.
+ * \param max_cost The maximum cost of an edge contraction after which edge contraction stops.
+ * \param records An optional list to append a record of each edge contraction to in the order they are performed.
+ * \return The maximum cost of an edge contraction performed or 0 if no edges were contracted.
+ */
+float ContractEdges(HalfEdgeMesh& half_edge_mesh,
+                    std::vector<PositionQuadric>& quadrics,
+                    IndexedMinHeap& edge_contractions,
+                    std::span<const std::uint8_t> locked_vertices,
+                    VertexPlacement placement,
+                    float target_face_count,
+                    float max_cost = std::numeric_limits<float>::infinity(),
+                    std::vector<EdgeContractionRecord>* records = nullptr);
+
+/** \brief An indexed triangle mesh whose vertices may be split at attribute seams. */
+struct AttributeMesh {
+  std::vector<Mesh::Vertex> vertices;
+  std::vector<std::uint32_t> indices;
+};
+
+/**
+ * \brief Simplifies an indexed triangle mesh with an error metric over vertex positions and attributes.
+ * \details Vertices split at attribute seams are welded by position into a single half-edge mesh vertex while each face
+ *          corner keeps referencing its own wedge of attributes. Each wedge has a generalized quadric over the position
+ *          and attributes in \p attributes whose dimension is fixed at compile time for each attribute layout, and the
+ *          wedges on either side of a seam edge add constraint quadrics which penalize moving the seam. An edge
+ *          contraction merges the wedges on each side of the edge and places the new vertex at the minimum of their
+ *          combined quadrics. A vertex with wedges that are not merged by the edge contraction stays fixed so that
+ *          seams are only shortened along their own edges. Attributes excluded from the metric are averaged.
+ * \param vertices The mesh vertices.
+ * \param indices The vertex indices of each triangle in counter-clockwise order. Welding vertices by position must
+ *                produce a closed manifold mesh.
+ * \param attributes The vertex attributes included in the error metric.
+ * \param target_face_count The number of faces to reduce the mesh to.
+ * \return The simplified mesh.
+ * \throw std::invalid_argument Thrown if the welded mesh is not a closed manifold.
+ * \see Garland, M., & Heckbert, P. S. (1998). Simplifying surfaces with color and texture using quadric error metrics.
+ * \see Hoppe, H. (1999). New quadric metric for simplifying meshes with appearance attributes.
+ */
+AttributeMesh SimplifyWithAttributes(std::span<const Mesh::Vertex> vertices,
+                                     std::span<const std::uint32_t> indices,
+                                     VertexAttributes attributes,
+                                     float target_face_count);
+
+/** \brief A region of a mesh that can be simplified independently of adjacent regions. */
+struct MeshRegion {
+  /** \brief The vertex positions where vertices with a closed one-ring precede all other vertices. */
+  std::vector<glm::vec3> positions;
+
+  /** \brief The vertex indices of faces owned by the region followed by halo faces from adjacent regions. */
+  std::vector<std::uint32_t> indices;
+
+  /** \brief Flags indexed by vertex ID indicating which vertices must not be removed from the region. */
+  std::vector<std::uint8_t> locked_vertices;
+
+  /** \brief The number of vertices with a closed one-ring. */
+  std::uint32_t closed_vertex_count = 0;
+
+  /** \brief The number of faces owned by the region. */
+  std::size_t face_count = 0;
+};
+
+/** \brief The faces owned by a simplified mesh region and the vertices they reference. */
+struct SimplifiedRegion {
+  std::vector<glm::vec3> positions;
+  std::vector<PositionQuadric> quadrics;
+  std::vector<std::uint32_t> locked_vertex_ids;  // the region vertex ID of each locked vertex or kInvalidIndex
+  std::vector<std::uint32_t> indices;
+};
+
+/**
+ * \brief Simplifies a mesh region while keeping its locked vertices fixed.
+ * \details Halo faces from adjacent regions complete the one-ring of locked vertices so that quadrics and edge
+ *          contractions adjacent to those vertices are computed exactly. Halo faces are never modified and are
+ *          excluded from the simplified region.
+ * \param region The mesh region to simplify.
+ * \param rate The percentage of faces not incident to a locked vertex to remove.
+ * \param placement Determines where the vertex created by each edge contraction is placed.
+ * \return The simplified region.
+ */
+SimplifiedRegion SimplifyRegion(const MeshRegion& region,
+                                float rate,
+                                VertexPlacement placement = VertexPlacement::kOptimal);
+
+}  // namespace gfx
+
+#endif  // GEOMETRY_EDGE_CONTRACTION_H_
@@ -2,31 +2,34 @@
 
 #include <algorithm>
 #include <array>
+#include <cassert>
+#include <functional>
 
 #include <glm/geometric.hpp>
 
 namespace {
 
-std::array<std::shared_ptr<gfx::Vertex>, 3> GetMinVertexOrder(const std::shared_ptr<gfx::Vertex>& v0,
-                                                              const std::shared_ptr<gfx::Vertex>& v1,
-                                                              const std::shared_ptr<gfx::Vertex>& v2) {
-  const auto min_id = std::min({v0->id(), v1->id(), v2->id()});
-  if (min_id == v0->id()) return std::array{v0, v1, v2};
-  if (min_id == v1->id()) return std::array{v1, v2, v0};
-  return std::array{v2, v0, v1};
+std::array<std::reference_wrapper<const gfx::Vertex>, 3> GetMinVertexOrder(const gfx::Vertex& v0,
+                                                                           const gfx::Vertex& v1,
+                                                                           const gfx::Vertex& v2) {
+  const auto min_id = std::min({v0.id(), v1.id(), v2.id()});
+  if (min_id == v0.id()) return std::array{std::cref(v0), std::cref(v1), std::cref(v2)};
+  if (min_id == v1.id()) return std::array{std::cref(v1), std::cref(v2), std::cref(v0)};
+  return std::array{std::cref(v2), std::cref(v0), std::cref(v1)};
 }
 
 }  // namespace
 
 namespace gfx {
 
-Face::Face(const std::shared_ptr<Vertex>& v0,  // NOLINT(*-member-init)
-           const std::shared_ptr<Vertex>& v1,
-           const std::shared_ptr<Vertex>& v2) noexcept {
-  tie(v0_, v1_, v2_) = GetMinVertexOrder(v0, v1, v2);
+Face::Face(const Vertex& v0, const Vertex& v1, const Vertex& v2) noexcept {  // NOLINT(*-member-init)
+  const auto& [u0, u1, u2] = GetMinVertexOrder(v0, v1, v2);
+  v0_ = u0.get().id();
+  v1_ = u1.get().id();
+  v2_ = u2.get().id();
 
-  const auto edge01 = v1_.lock()->position() - v0_.lock()->position();
-  const auto edge02 = v2_.lock()->position() - v0_.lock()->position();
+  const auto edge01 = u1.get().position() - u0.get().position();
+  const auto edge02 = u2.get().position() - u0.get().position();
   const auto normal = glm::cross(edge01, edge02);
 
   const auto normal_magnitude = glm::length(normal);
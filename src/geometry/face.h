@@ -1,8 +1,7 @@
 #ifndef GEOMETRY_FACE_H_
 #define GEOMETRY_FACE_H_
 
-#include <cassert>
-#include <memory>
+#include <cstdint>
 
 #include <glm/vec3.hpp>
 
@@ -17,27 +16,16 @@ public:
    * \brief Initializes a face.
    * \param v0,v1,v2 The face vertices in counter-clockwise order.
    */
-  Face(const std::shared_ptr<Vertex>& v0,
-       const std::shared_ptr<Vertex>& v1,
-       const std::shared_ptr<Vertex>& v2) noexcept;
+  Face(const Vertex& v0, const Vertex& v1, const Vertex& v2) noexcept;
 
-  /** \brief Gets the first face vertex. */
-  [[nodiscard]] std::shared_ptr<Vertex> v0() const noexcept {
-    assert(!v0_.expired());
-    return v0_.lock();
-  }
+  /** \brief Gets the index of the first face vertex. */
+  [[nodiscard]] std::uint32_t v0() const noexcept { return v0_; }
 
-  /** \brief Gets the second face vertex. */
-  [[nodiscard]] std::shared_ptr<Vertex> v1() const noexcept {
-    assert(!v1_.expired());
-    return v1_.lock();
-  }
+  /** \brief Gets the index of the second face vertex. */
+  [[nodiscard]] std::uint32_t v1() const noexcept { return v1_; }
 
-  /** \brief Gets the third face vertex. */
-  [[nodiscard]] std::shared_ptr<Vertex> v2() const noexcept {
-    assert(!v2_.expired());
-    return v2_.lock();
-  }
+  /** \brief Gets the index of the third face vertex. */
+  [[nodiscard]] std::uint32_t v2() const noexcept { return v2_; }
 
   /** \brief Gets the face normal. */
   [[nodiscard]] const glm::vec3& normal() const noexcept { return normal_; }
@@ -47,14 +35,11 @@ public:
 
   /** \brief Defines the face equality operator. */
   friend bool operator==(const Face& lhs, const Face& rhs) noexcept {
-    return lhs.v0() == rhs.v0() && lhs.v1() == rhs.v1() && lhs.v2() == rhs.v2();
+    return lhs.v0_ == rhs.v0_ && lhs.v1_ == rhs.v1_ && lhs.v2_ == rhs.v2_;
   }
 
-  /** \brief Gets the face hash value. */
-  friend std::size_t hash_value(const Face& face) noexcept { return hash_value(*face.v0(), *face.v1(), *face.v2()); }
-
 private:
-  std::weak_ptr<Vertex> v0_, v1_, v2_;
+  std::uint32_t v0_, v1_, v2_;
   glm::vec3 normal_;
   float area_;
 };
@@ -2,10 +2,9 @@
 #define GEOMETRY_HALF_EDGE_H_
 
 #include <cassert>
-#include <memory>
+#include <cstdint>
 
-#include "geometry/face.h"
-#include "geometry/vertex.h"
+#include "geometry/arena.h"
 
 namespace gfx {
 
@@ -14,57 +13,51 @@ class HalfEdge {
 public:
   /**
    * \brief Initializes a half-edge.
-   * \param vertex The vertex the half-edge will point to.
+   * \param vertex The index of the vertex the half-edge will point to.
    */
-  explicit HalfEdge(const std::shared_ptr<Vertex>& vertex) noexcept : vertex_{vertex} {}
+  explicit HalfEdge(const std::uint32_t vertex) noexcept : vertex_{vertex} {}
 
-  /** \brief Gets the vertex at the head of this half-edge. */
-  [[nodiscard]] std::shared_ptr<Vertex> vertex() const noexcept {
-    assert(!vertex_.expired());
-    return vertex_.lock();
+  /** \brief Gets the index of the vertex at the head of this half-edge. */
+  [[nodiscard]] std::uint32_t vertex() const noexcept {
+    assert(vertex_ != kInvalidIndex);
+    return vertex_;
   }
 
-  /** \brief Gets the half-edge that shares this edge's vertices in the opposite direction. */
-  [[nodiscard]] std::shared_ptr<HalfEdge> flip() const noexcept {
-    assert(!flip_.expired());
-    return flip_.lock();
-  }
-
-  /** \brief Sets the flip half-edge. */
-  void set_flip(const std::shared_ptr<HalfEdge>& flip) noexcept { flip_ = flip; }
+  /** \brief Sets the index of the vertex at the head of this half-edge. */
+  void set_vertex(const std::uint32_t vertex) noexcept { vertex_ = vertex; }
 
-  /** \brief Gets the next half-edge of a triangle in counter-clockwise order. */
-  [[nodiscard]] std::shared_ptr<HalfEdge> next() const noexcept {
-    assert(!next_.expired());
-    return next_.lock();
+  /** \brief Gets the index of the half-edge that shares this edge's vertices in the opposite direction. */
+  [[nodiscard]] std::uint32_t flip() const noexcept {
+    assert(flip_ != kInvalidIndex);
+    return flip_;
   }
 
-  /** \brief Sets the next half-edge. */
-  void set_next(const std::shared_ptr<HalfEdge>& next) noexcept { next_ = next; }
+  /** \brief Sets the flip half-edge index. */
+  void set_flip(const std::uint32_t flip) noexcept { flip_ = flip; }
 
-  /** \brief Gets the face created by three counter-clockwise \c next iterations starting from this half-edge. */
-  [[nodiscard]] std::shared_ptr<Face> face() const noexcept {
-    assert(!face_.expired());
-    return face_.lock();
+  /** \brief Gets the index of the next half-edge of a triangle in counter-clockwise order. */
+  [[nodiscard]] std::uint32_t next() const noexcept {
+    assert(next_ != kInvalidIndex);
+    return next_;
   }
 
-  /** \brief Sets the half-edge face. */
-  void set_face(const std::shared_ptr<Face>& face) noexcept { face_ = face; }
+  /** \brief Sets the next half-edge index. */
+  void set_next(const std::uint32_t next) noexcept { next_ = next; }
 
-  /** \brief Defines the half-edge equality operator. */
-  friend bool operator==(const HalfEdge& lhs, const HalfEdge& rhs) noexcept {
-    return lhs.vertex() == rhs.vertex() && lhs.flip()->vertex() == rhs.flip()->vertex();
+  /** \brief Gets the index of the face created by three counter-clockwise \c next iterations from this half-edge. */
+  [[nodiscard]] std::uint32_t face() const noexcept {
+    assert(face_ != kInvalidIndex);
+    return face_;
   }
 
-  /** \brief Gets the half-edge hash value. */
-  friend std::size_t hash_value(const HalfEdge& edge) noexcept {
-    return hash_value(*edge.flip()->vertex(), *edge.vertex());
-  }
+  /** \brief Sets the half-edge face index. */
+  void set_face(const std::uint32_t face) noexcept { face_ = face; }
 
 private:
-  std::weak_ptr<Vertex> vertex_;
-  std::weak_ptr<HalfEdge> next_, flip_;
-  std::weak_ptr<Face> face_;
+  std::uint32_t vertex_;
+  std::uint32_t next_ = kInvalidIndex;
+  std::uint32_t flip_ = kInvalidIndex;
+  std::uint32_t face_ = kInvalidIndex;
 };
 
 }  // namespace gfx
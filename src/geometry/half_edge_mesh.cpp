@@ -1,138 +1,229 @@
 #include "geometry/half_edge_mesh.h"
 
 #include <algorithm>
+#include <array>
+#include <bit>
 #include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
 #include <ranges>
+#include <span>
 #include <utility>
 #include <vector>
 
 #include <glm/glm.hpp>
 
-#include "geometry/face.h"
-#include "geometry/half_edge.h"
-#include "geometry/vertex.h"
+#include "concurrency/parallel_for.h"
 #include "graphics/device.h"
 #include "graphics/mesh.h"
 
 namespace {
 
-template <typename Key, typename MapKey, typename MapValue>
-typename std::unordered_map<MapKey, MapValue>::const_iterator Find(const Key& key,
-                                                                   const std::unordered_map<MapKey, MapValue>& map) {
-  if constexpr (std::is_same_v<Key, MapKey>) {
-    return map.find(key);
-  } else {
-    return map.find(hash_value(key));
+/** \brief The minimum number of independent edge contractions assigned to each worker thread. */
+constexpr std::size_t kMinContractionChunkSize = 64;
+
+/**
+ * \brief An open-addressing hash table used to find edges by their vertex indices during mesh construction.
+ * \details Keys are formed by packing the minimum and maximum vertex index of an edge into a single 64-bit integer so
+ *          that distinct edges can never alias one another. Each entry stores the half-edge directed from the minimum
+ *          to the maximum vertex index. Collisions between hash values are resolved with linear probing over a flat
+ *          power-of-two sized array which is kept at most half full.
+ */
+class EdgeTable {
+public:
+  explicit EdgeTable(const std::size_t edge_count) : entries_(std::bit_ceil(std::max(2 * edge_count, kMinCapacity))) {}
+
+  /** \brief Gets the half-edge directed from min(v0, v1) to max(v0, v1) or \c kInvalidIndex if it does not exist. */
+  [[nodiscard]] std::uint32_t Find(const std::uint32_t v0, const std::uint32_t v1) const noexcept {
+    const auto key = GetKey(v0, v1);
+    for (auto i = GetHash(key);; i = (i + 1) & (entries_.size() - 1)) {
+      const auto& entry = entries_[i];
+      if (entry.key == key) return entry.edge;
+      if (entry.key == kEmptyKey) return gfx::kInvalidIndex;
+    }
   }
-}
-
-template <typename Key, typename MapKey, typename MapValue>
-const MapValue& Get(const Key& key, const std::unordered_map<MapKey, MapValue>& map) {
-  const auto iterator = Find(key, map);
-  assert(iterator != map.cend());
-  return iterator->second;
-}
 
-template <typename Key, typename MapKey, typename MapValue>
-void Delete(const Key& key, std::unordered_map<MapKey, MapValue>& map) {
-  if constexpr (std::is_same_v<Key, gfx::HalfEdge>) {
-    // hash values depend on both edges so they must be calculated first before deleting
-    const auto edge_key = hash_value(key);
-    const auto edge_flip_key = hash_value(*key.flip());
-    Delete(edge_key, map);
-    Delete(edge_flip_key, map);
-  } else {
-    const auto iterator = Find(key, map);
-    assert(iterator != map.cend());
-    map.erase(iterator);
+  /** \brief Inserts the half-edge directed from min(v0, v1) to max(v0, v1). */
+  void Insert(const std::uint32_t v0, const std::uint32_t v1, const std::uint32_t edge) {
+    if (2 * (size_ + 1) > entries_.size()) {
+      Rehash(2 * entries_.size());
+    }
+    Insert(Entry{.key = GetKey(v0, v1), .edge = edge});
+    ++size_;
   }
-}
 
-std::shared_ptr<gfx::HalfEdge> CreateHalfEdge(const std::shared_ptr<gfx::Vertex>& v0,
-                                              const std::shared_ptr<gfx::Vertex>& v1,
-                                              std::unordered_map<std::size_t, std::shared_ptr<gfx::HalfEdge>>& edges) {
-  const auto edge01_key = hash_value(*v0, *v1);
-  const auto edge10_key = hash_value(*v1, *v0);
+private:
+  static constexpr std::size_t kMinCapacity = 16;
+  static constexpr auto kEmptyKey = std::numeric_limits<std::uint64_t>::max();
 
-  // prevent the creation of duplicate edges
-  if (const auto iterator = edges.find(edge01_key); iterator != edges.cend()) {
-    assert(edges.contains(edge10_key));
-    return iterator->second;
+  struct Entry {
+    std::uint64_t key = kEmptyKey;
+    std::uint32_t edge = gfx::kInvalidIndex;
+  };
+
+  static std::uint64_t GetKey(const std::uint32_t v0, const std::uint32_t v1) noexcept {
+    const auto [v_min, v_max] = std::minmax(v0, v1);
+    return static_cast<std::uint64_t>(v_min) << 32u | v_max;
   }
-  assert(!edges.contains(edge10_key));
 
-  auto edge01 = std::make_shared<gfx::HalfEdge>(v1);
-  auto edge10 = std::make_shared<gfx::HalfEdge>(v0);
+  [[nodiscard]] std::size_t GetHash(const std::uint64_t key) const noexcept {
+    // Fibonacci hashing uses the high bits of the product which depend on every bit of the key
+    static constexpr std::uint64_t kGoldenRatio = 0x9e3779b97f4a7c15;
+    const auto shift = std::numeric_limits<std::uint64_t>::digits - std::countr_zero(entries_.size());
+    return static_cast<std::size_t>((key * kGoldenRatio) >> shift);
+  }
 
-  edge01->set_flip(edge10);
-  edge10->set_flip(edge01);
+  void Insert(const Entry& entry) noexcept {
+    auto i = GetHash(entry.key);
+    while (entries_[i].key != kEmptyKey) {
+      assert(entries_[i].key != entry.key);  // ensure edges are not inserted more than once
+      i = (i + 1) & (entries_.size() - 1);
+    }
+    entries_[i] = entry;
+  }
 
-  edges.emplace(edge01_key, edge01);
-  edges.emplace(edge10_key, std::move(edge10));
+  void Rehash(const std::size_t capacity) {
+    auto entries = std::exchange(entries_, std::vector<Entry>(capacity));
+    for (const auto& entry : entries) {
+      if (entry.key != kEmptyKey) Insert(entry);
+    }
+  }
 
-  return edge01;
-}
+  std::vector<Entry> entries_;
+  std::size_t size_ = 0;
+};
 
-std::shared_ptr<gfx::Face> CreateTriangle(const std::shared_ptr<gfx::Vertex>& v0,
-                                          const std::shared_ptr<gfx::Vertex>& v1,
-                                          const std::shared_ptr<gfx::Vertex>& v2,
-                                          std::unordered_map<std::size_t, std::shared_ptr<gfx::HalfEdge>>& edges) {
-  const auto edge01 = CreateHalfEdge(v0, v1, edges);
-  const auto edge12 = CreateHalfEdge(v1, v2, edges);
-  const auto edge20 = CreateHalfEdge(v2, v0, edges);
+std::uint32_t CreateHalfEdge(const std::uint32_t v0,
+                             const std::uint32_t v1,
+                             gfx::Arena<gfx::HalfEdge>& edges,
+                             EdgeTable& edge_table) {
+  // prevent the creation of duplicate edges
+  if (const auto edge = edge_table.Find(v0, v1); edge != gfx::kInvalidIndex) {
+    return v0 < v1 ? edge : edges[edge].flip();
+  }
 
-  v0->set_edge(edge20);
-  v1->set_edge(edge01);
-  v2->set_edge(edge12);
+  const auto edge01 = edges.Insert(gfx::HalfEdge{v1});
+  const auto edge10 = edges.Insert(gfx::HalfEdge{v0});
 
-  edge01->set_next(edge12);
-  edge12->set_next(edge20);
-  edge20->set_next(edge01);
+  edges[edge01].set_flip(edge10);
+  edges[edge10].set_flip(edge01);
 
-  auto face012 = std::make_shared<gfx::Face>(v0, v1, v2);
-  edge01->set_face(face012);
-  edge12->set_face(face012);
-  edge20->set_face(face012);
+  edge_table.Insert(v0, v1, v0 < v1 ? edge01 : edge10);
 
-  return face012;
+  return edge01;
 }
 
-void AttachIncidentEdges(const gfx::Vertex& v_target,
-                         const gfx::Vertex& v_start,
-                         const gfx::Vertex& v_end,
-                         const std::shared_ptr<gfx::Vertex>& v_new,
-                         std::unordered_map<std::size_t, std::shared_ptr<gfx::HalfEdge>>& edges,
-                         std::unordered_map<std::size_t, std::shared_ptr<gfx::Face>>& faces) {
-  const auto& edge_start = Get(hash_value(v_target, v_start), edges);
-  const auto& edge_end = Get(hash_value(v_target, v_end), edges);
-
-  for (auto edge0i = edge_start; edge0i != edge_end;) {
-    const auto edgeij = edge0i->next();
-    const auto edgej0 = edgeij->next();
+void CreateTriangle(const std::uint32_t v0,
+                    const std::uint32_t v1,
+                    const std::uint32_t v2,
+                    gfx::Arena<gfx::Vertex>& vertices,
+                    gfx::Arena<gfx::HalfEdge>& edges,
+                    gfx::Arena<gfx::Face>& faces,
+                    EdgeTable& edge_table) {
+  const auto edge01 = CreateHalfEdge(v0, v1, edges, edge_table);
+  const auto edge12 = CreateHalfEdge(v1, v2, edges, edge_table);
+  const auto edge20 = CreateHalfEdge(v2, v0, edges, edge_table);
+
+  vertices[v0].set_edge(edge20);
+  vertices[v1].set_edge(edge01);
+  vertices[v2].set_edge(edge12);
+
+  edges[edge01].set_next(edge12);
+  edges[edge12].set_next(edge20);
+  edges[edge20].set_next(edge01);
+
+  const auto face012 = faces.Insert(gfx::Face{vertices[v0], vertices[v1], vertices[v2]});
+  edges[edge01].set_face(face012);
+  edges[edge12].set_face(face012);
+  edges[edge20].set_face(face012);
+}
 
-    const auto vi = edge0i->vertex();
-    const auto vj = edgeij->vertex();
+std::uint32_t CreateVertex(const glm::vec3& position, gfx::Arena<gfx::Vertex>& vertices) {
+  return vertices.Insert(gfx::Vertex{vertices.slot_count(), position});
+}
 
-    auto face_new = CreateTriangle(v_new, vi, vj, edges);
-    faces.emplace(hash_value(*face_new), std::move(face_new));
+void DetachTriangle(const std::uint32_t edge01, gfx::Arena<gfx::Vertex>& vertices, gfx::Arena<gfx::HalfEdge>& edges) {
+  // the vertices of edge01 have already been merged into a single vertex which collapses the triangle into a line
+  const auto edge12 = edges[edge01].next();
+  const auto edge20 = edges[edge12].next();
+  const auto edge21 = edges[edge12].flip();
+  const auto edge02 = edges[edge20].flip();
+  const auto v0 = edges[edge20].vertex();
+  const auto v2 = edges[edge12].vertex();
+
+  // the remaining edges of adjacent triangles now share the same vertices and become flip edges of each other
+  edges[edge21].set_flip(edge02);
+  edges[edge02].set_flip(edge21);
+
+  vertices[v0].set_edge(edge21);
+  if (vertices[v2].edge() == edge12) {
+    vertices[v2].set_edge(edge02);
+  }
+}
 
-    Delete(*edge0i->face(), faces);
-    Delete(*edge0i, edges);
+void EraseTriangle(const std::uint32_t edge01, gfx::Arena<gfx::HalfEdge>& edges, gfx::Arena<gfx::Face>& faces) {
+  const auto edge12 = edges[edge01].next();
+  const auto edge20 = edges[edge12].next();
+  faces.Erase(edges[edge01].face());
+  edges.Erase(edge01);
+  edges.Erase(edge12);
+  edges.Erase(edge20);
+}
 
-    edge0i = edgej0->flip();
+/**
+ * \brief Merges the vertices of an edge into a new vertex without erasing the removed elements.
+ * \details Only elements in the closed one-ring of the edge vertices are modified.
+ * \return The IDs of the vertices merged into \p v_new.
+ */
+std::array<std::uint32_t, 2> MergeEdgeVertices(const std::uint32_t edge01,
+                                               const std::uint32_t v_new,
+                                               gfx::Arena<gfx::Vertex>& vertices,
+                                               gfx::Arena<gfx::HalfEdge>& edges,
+                                               gfx::Arena<gfx::Face>& faces) {
+  const auto edge10 = edges[edge01].flip();
+  const auto v0 = edges[edge10].vertex();
+  const auto v1 = edges[edge01].vertex();
+
+  // attach edges incident to v0 and v1 to the new vertex
+  for (const auto vi : {v0, v1}) {
+    const auto edge_start = vertices[vi].edge();
+    auto edgeji = edge_start;
+    do {
+      edges[edgeji].set_vertex(v_new);
+      edgeji = edges[edges[edgeji].next()].flip();
+    } while (edgeji != edge_start);
   }
 
-  Delete(*edge_end, edges);
+  DetachTriangle(edge01, vertices, edges);
+  DetachTriangle(edge10, vertices, edges);
+
+  // recompute the normal and area of each face incident to the new vertex
+  const auto edge_start = vertices[v_new].edge();
+  auto edgei0 = edge_start;
+  do {
+    const auto edge0j = edges[edgei0].next();
+    const auto vj = edges[edge0j].vertex();
+    const auto vk = edges[edges[edge0j].next()].vertex();
+    faces[edges[edgei0].face()] = gfx::Face{vertices[v_new], vertices[vj], vertices[vk]};
+    edgei0 = edges[edge0j].flip();
+  } while (edgei0 != edge_start);
+
+  return {v0, v1};
 }
 
-glm::vec3 AverageVertexNormals(const gfx::Vertex& v0) {
+glm::vec3 AverageVertexNormals(const gfx::HalfEdgeMesh& half_edge_mesh, const std::uint32_t v0) {
+  const auto& edges = half_edge_mesh.edges();
+  const auto& faces = half_edge_mesh.faces();
+  const auto edge_start = half_edge_mesh.vertices()[v0].edge();
+
   glm::vec3 normal{0.0f};
-  auto edgei0 = v0.edge();
+  auto edgei0 = edge_start;
   do {
-    const auto& face = edgei0->face();
-    normal += face->normal() * face->area();
-    edgei0 = edgei0->next()->flip();
-  } while (edgei0 != v0.edge());
+    const auto& face = faces[edges[edgei0].face()];
+    normal += face.normal() * face.area();
+    edgei0 = edges[edges[edgei0].next()].flip();
+  } while (edgei0 != edge_start);
   return glm::normalize(normal);
 }
 
@@ -141,70 +232,106 @@ glm::vec3 AverageVertexNormals(const gfx::Vertex& v0) {
 namespace gfx {
 
 HalfEdgeMesh::HalfEdgeMesh(const Mesh& mesh)
-    : vertices_{mesh.vertices()  //
-                | std::views::transform([id = 0u](const auto& mesh_vertex) mutable {
-                    auto vertex = std::make_shared<Vertex>(id, mesh_vertex.position);
-                    return std::pair{id++, std::move(vertex)};
-                  })
-                | std::ranges::to<std::unordered_map>()},
-      faces_{mesh.indices()          //
-             | std::views::chunk(3)  //
-             | std::views::transform([this](const auto& index_group) {
-                 const auto& v0 = Get(index_group[0], vertices_);
-                 const auto& v1 = Get(index_group[1], vertices_);
-                 const auto& v2 = Get(index_group[2], vertices_);
-                 auto face012 = CreateTriangle(v0, v1, v2, edges_);
-                 return std::pair{hash_value(*face012), std::move(face012)};
-               })
-             | std::ranges::to<std::unordered_map>()},
-      transform_{mesh.transform()} {}
-
-void HalfEdgeMesh::Contract(const HalfEdge& edge01, const std::shared_ptr<Vertex>& v_new) {
-  assert(Find(edge01, edges_) != edges_.cend());
-  assert(Find(v_new->id(), vertices_) == vertices_.cend());
-
-  const auto edge10 = edge01.flip();
-  const auto v0 = edge10->vertex();
-  const auto v1 = edge01.vertex();
-  const auto v0_next = edge10->next()->vertex();
-  const auto v1_next = edge01.next()->vertex();
-
-  AttachIncidentEdges(*v0, *v1_next, *v0_next, v_new, edges_, faces_);
-  AttachIncidentEdges(*v1, *v0_next, *v1_next, v_new, edges_, faces_);
-
-  Delete(*edge01.face(), faces_);
-  Delete(*edge10->face(), faces_);
-
-  Delete(edge01, edges_);
-
-  Delete(v0->id(), vertices_);
-  Delete(v1->id(), vertices_);
-
-  vertices_.emplace(v_new->id(), v_new);
+    : HalfEdgeMesh{mesh.vertices() | std::views::transform(&Mesh::Vertex::position) | std::ranges::to<std::vector>(),
+                   mesh.indices(),
+                   mesh.transform()} {}
+
+HalfEdgeMesh::HalfEdgeMesh(const std::span<const glm::vec3> positions,
+                           const std::span<const std::uint32_t> indices,
+                           const glm::mat4& transform)
+    : transform_{transform} {
+  // each triangle contributes three half-edges which are shared with adjacent triangles as flip edges and each edge
+  // contraction appends one vertex while removing two faces which reserves enough vertices to never reallocate
+  vertices_.reserve(positions.size() + indices.size() / 6);
+  edges_.reserve(indices.size());
+  faces_.reserve(indices.size() / 3);
+
+  for (const auto& position : positions) {
+    CreateVertex(position, vertices_);
+  }
+
+  // the edge table is only needed to connect flip edges while triangles are added to the mesh and is sized for a
+  // closed mesh in which each edge is shared by two triangles
+  EdgeTable edge_table{indices.size() / 2};
+  for (const auto& index_group : indices | std::views::chunk(3)) {
+    CreateTriangle(index_group[0], index_group[1], index_group[2], vertices_, edges_, faces_, edge_table);
+  }
+}
+
+std::uint32_t HalfEdgeMesh::Contract(const std::uint32_t edge01, const glm::vec3& position) {
+  assert(edges_.contains(edge01));
+
+  const auto edge10 = edges_[edge01].flip();
+  const auto v_new = CreateVertex(position, vertices_);
+  const auto [v0, v1] = MergeEdgeVertices(edge01, v_new, vertices_, edges_, faces_);
+
+  EraseTriangle(edge01, edges_, faces_);
+  EraseTriangle(edge10, edges_, faces_);
+  vertices_.Erase(v0);
+  vertices_.Erase(v1);
+
+  return v_new;
+}
+
+std::uint32_t HalfEdgeMesh::Contract(const std::span<const std::uint32_t> edges,
+                                     const std::span<const glm::vec3> positions) {
+  assert(edges.size() == positions.size());
+
+  // inserting and erasing arena elements is not thread-safe so only merging edge vertices is performed concurrently
+  const auto v_first = vertices_.slot_count();
+  for (const auto& position : positions) CreateVertex(position, vertices_);
+
+  std::vector<std::array<std::uint32_t, 2>> merged_vertices(edges.size());
+  ParallelFor(
+      edges.size(),
+      [&](const std::size_t begin, const std::size_t end) {
+        for (auto i = begin; i < end; ++i) {
+          assert(edges_.contains(edges[i]));
+          merged_vertices[i] =
+              MergeEdgeVertices(edges[i], v_first + static_cast<std::uint32_t>(i), vertices_, edges_, faces_);
+        }
+      },
+      kMinContractionChunkSize);
+
+  for (std::size_t i = 0; i < edges.size(); ++i) {
+    const auto edge10 = edges_[edges[i]].flip();
+    EraseTriangle(edges[i], edges_, faces_);
+    EraseTriangle(edge10, edges_, faces_);
+    for (const auto v : merged_vertices[i]) vertices_.Erase(v);
+  }
+
+  return v_first;
 }
 
 Mesh HalfEdgeMesh::ToMesh(const Device& device) const {
   std::vector<Mesh::Vertex> vertices;
+  std::vector<std::uint32_t> indices;
+  ToIndexedMesh(vertices, indices);
+  return Mesh{device, std::move(vertices), std::move(indices), transform_};
+}
+
+void HalfEdgeMesh::ToIndexedMesh(std::vector<Mesh::Vertex>& vertices, std::vector<std::uint32_t>& indices) const {
+  vertices.clear();
   vertices.reserve(vertices_.size());
 
-  std::vector<std::uint32_t> indices;
+  indices.clear();
   indices.reserve(3 * faces_.size());
 
-  std::unordered_map<std::uint32_t, std::uint32_t> index_map;
-  index_map.reserve(vertices_.size());
+  // map vertex IDs to new index positions
+  std::vector<std::uint32_t> index_map(vertices_.slot_count(), kInvalidIndex);
 
-  for (std::uint32_t index = 0; const auto& vertex : vertices_ | std::views::values) {
-    vertices.emplace_back(Mesh::Vertex{.position = vertex->position(), .normal = AverageVertexNormals(*vertex)});
-    index_map.emplace(vertex->id(), index++);  // map original vertex IDs to new index positions
+  for (std::uint32_t index = 0; const auto id : vertices_.indices()) {
+    const auto& vertex = vertices_[id];
+    vertices.emplace_back(Mesh::Vertex{.position = vertex.position(), .normal = AverageVertexNormals(*this, id)});
+    index_map[id] = index++;
   }
 
-  for (const auto& face : faces_ | std::views::values) {
-    indices.push_back(Get(face->v0()->id(), index_map));
-    indices.push_back(Get(face->v1()->id(), index_map));
-    indices.push_back(Get(face->v2()->id(), index_map));
+  for (const auto id : faces_.indices()) {
+    const auto& face = faces_[id];
+    indices.push_back(index_map[face.v0()]);
+    indices.push_back(index_map[face.v1()]);
+    indices.push_back(index_map[face.v2()]);
   }
-
-  return Mesh{device, vertices, indices, transform_};
 }
 
 }  // namespace gfx
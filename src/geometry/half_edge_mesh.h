@@ -1,24 +1,30 @@
 #ifndef GEOMETRY_HALF_EDGE_MESH_H_
 #define GEOMETRY_HALF_EDGE_MESH_H_
 
-#include <memory>
-#include <unordered_map>
+#include <cstdint>
+#include <span>
+#include <vector>
 
 #include <glm/mat4x4.hpp>
+#include <glm/vec3.hpp>
+
+#include "geometry/arena.h"
+#include "geometry/face.h"
+#include "geometry/half_edge.h"
+#include "geometry/vertex.h"
+#include "graphics/mesh.h"
 
 namespace gfx {
 class Device;
-class Face;
-class HalfEdge;
-class Mesh;
-class Vertex;
 
 /**
  * \brief An edge centric data structure used to represent a triangle mesh.
  * \details A half-edge mesh is comprised of directional half-edges that refer to the next edge in the triangle in
- *          counter-clockwise order. Each half-edge also provides pointers to the vertex at the head of the edge, its
+ *          counter-clockwise order. Each half-edge also provides indices to the vertex at the head of the edge, its
  *          associated triangle face, and its flip edge which represents the same edge in the opposite direction. Using
- *          just these four pointers, one can effectively traverse and modify edges in a triangle mesh.
+ *          just these four indices, one can effectively traverse and modify edges in a triangle mesh. Vertices,
+ *          half-edges, and faces are stored contiguously in arenas and deleted elements are left behind as tombstones
+ *          so that element indices remain stable while the mesh is modified.
  */
 class HalfEdgeMesh {
 public:
@@ -28,23 +34,48 @@ public:
    */
   explicit HalfEdgeMesh(const Mesh& mesh);
 
+  /**
+   * \brief Initializes a half-edge mesh.
+   * \param positions The vertex positions where the index of each position is used as its vertex ID.
+   * \param indices The vertex indices of each triangle in counter-clockwise order.
+   * \param transform The model transform of the mesh.
+   */
+  HalfEdgeMesh(std::span<const glm::vec3> positions,
+               std::span<const std::uint32_t> indices,
+               const glm::mat4& transform = glm::mat4{1.0f});
+
   /** \brief Gets the mesh vertices by ID. */
-  [[nodiscard]] const auto& vertices() const noexcept { return vertices_; }
+  [[nodiscard]] const Arena<Vertex>& vertices() const noexcept { return vertices_; }
 
-  /** \brief Gets the mesh half-edges by hash value. */
-  [[nodiscard]] const auto& edges() const noexcept { return edges_; }
+  /** \brief Gets the mesh half-edges by index. */
+  [[nodiscard]] const Arena<HalfEdge>& edges() const noexcept { return edges_; }
 
-  /** \brief Gets the mesh faces by hash value. */
-  [[nodiscard]] const auto& faces() const noexcept { return faces_; }
+  /** \brief Gets the mesh faces by index. */
+  [[nodiscard]] const Arena<Face>& faces() const noexcept { return faces_; }
 
   /**
    * \brief Performs edge contraction.
    * \details Edge contraction consists of removing an edge from the mesh by merging its two vertices into a single
-   *          vertex and updating edges incident to each endpoint to connect to that new vertex.
-   * \param edge01 The edge from vertex \c v0 to \c v1 to remove.
-   * \param v_new The new vertex to attach edges incident to \c v0 and \c v1 to.
+   *          vertex and updating edges incident to each endpoint to connect to that new vertex. The two triangles
+   *          adjacent to the edge are removed and their remaining edges are reconnected directly through flip indices
+   *          so no edge lookups are required.
+   * \param edge01 The index of the edge from vertex \c v0 to \c v1 to remove.
+   * \param position The position of the new vertex to attach edges incident to \c v0 and \c v1 to.
+   * \return The ID of the new vertex.
    */
-  void Contract(const HalfEdge& edge01, const std::shared_ptr<Vertex>& v_new);
+  std::uint32_t Contract(std::uint32_t edge01, const glm::vec3& position);
+
+  /**
+   * \brief Performs a batch of independent edge contractions concurrently.
+   * \details Each contraction only modifies elements in the closed one-ring of its edge vertices so contractions whose
+   *          closed one-rings are pairwise disjoint can merge their vertices in parallel. New vertices are created and
+   *          removed elements are erased serially since arena insertion and deletion are not thread-safe.
+   * \param edges The indices of the edges to remove. The closed one-rings of their vertices must not overlap.
+   * \param positions The position of the new vertex for each edge.
+   * \return The ID of the new vertex for the first edge. The new vertex for the edge at index \c i has ID
+   *         <tt>v_first + i</tt>.
+   */
+  std::uint32_t Contract(std::span<const std::uint32_t> edges, std::span<const glm::vec3> positions);
 
   /**
    * \brief Converts the half-edge mesh back to an indexed triangle mesh.
@@ -53,10 +84,18 @@ public:
    */
   [[nodiscard]] Mesh ToMesh(const Device& device) const;
 
+  /**
+   * \brief Converts the half-edge mesh back to the vertices and indices of an indexed triangle mesh.
+   * \details Unlike \ref ToMesh, the mesh data is not copied to device memory which allows it to be processed further.
+   * \param vertices The vertices of the indexed triangle mesh.
+   * \param indices The vertex indices of each triangle in counter-clockwise order.
+   */
+  void ToIndexedMesh(std::vector<Mesh::Vertex>& vertices, std::vector<std::uint32_t>& indices) const;
+
 private:
-  std::unordered_map<std::uint32_t, std::shared_ptr<Vertex>> vertices_;
-  std::unordered_map<std::size_t, std::shared_ptr<HalfEdge>> edges_;
-  std::unordered_map<std::size_t, std::shared_ptr<Face>> faces_;
+  Arena<Vertex> vertices_;
+  Arena<HalfEdge> edges_;
+  Arena<Face> faces_;
   glm::mat4 transform_;
 };
 
@@ -0,0 +1,170 @@
+#ifndef GEOMETRY_INDEXED_MIN_HEAP_H_
+#define GEOMETRY_INDEXED_MIN_HEAP_H_
+
+#include <cassert>
+#include <concepts>
+#include <cstdint>
+#include <ranges>
+#include <utility>
+#include <vector>
+
+#include "geometry/arena.h"
+
+namespace gfx {
+
+/**
+ * \brief An addressable binary min-heap of 32-bit keys sorted by priority.
+ * \details Each key maps to its current position in the heap which allows the priority of a key to be updated or the
+ *          key to be removed in place in logarithmic time. Unlike a lazy-deletion priority queue, stale entries are
+ *          never left behind so the size of the heap is bounded by the number of distinct keys it contains.
+ */
+class IndexedMinHeap {
+public:
+  /**
+   * \brief Initializes an indexed min-heap.
+   * \param key_count The number of keys that can be stored in the heap where each key must be less than this value.
+   */
+  explicit IndexedMinHeap(const std::uint32_t key_count) : positions_(key_count, kInvalidIndex) {
+    // keys are distinct so the heap never holds more than key_count nodes and inserting a key never allocates
+    nodes_.reserve(key_count);
+  }
+
+  /** \brief Gets the number of keys in the heap. */
+  [[nodiscard]] std::size_t size() const noexcept { return nodes_.size(); }
+
+  /** \brief Determines if the heap is empty. */
+  [[nodiscard]] bool empty() const noexcept { return nodes_.empty(); }
+
+  /** \brief Determines if the heap contains a key. */
+  [[nodiscard]] bool contains(const std::uint32_t key) const noexcept {
+    assert(key < positions_.size());
+    return positions_[key] != kInvalidIndex;
+  }
+
+  /** \brief Gets the key with the minimum priority. */
+  [[nodiscard]] std::uint32_t top() const noexcept {
+    assert(!empty());
+    return nodes_.front().key;
+  }
+
+  /** \brief Gets the minimum priority. */
+  [[nodiscard]] float top_priority() const noexcept {
+    assert(!empty());
+    return nodes_.front().priority;
+  }
+
+  /**
+   * \brief Inserts a key into the heap or updates its priority if the key is already in the heap.
+   * \param key The key to insert or update.
+   * \param priority The new key priority.
+   */
+  void Push(const std::uint32_t key, const float priority) {
+    if (contains(key)) {
+      auto& node = nodes_[positions_[key]];
+      const auto previous_priority = std::exchange(node.priority, priority);
+      if (priority < previous_priority) {
+        SiftUp(positions_[key]);
+      } else {
+        SiftDown(positions_[key]);
+      }
+    } else {
+      positions_[key] = static_cast<std::uint32_t>(nodes_.size());
+      nodes_.push_back(Node{.priority = priority, .key = key});
+      SiftUp(positions_[key]);
+    }
+  }
+
+  /**
+   * \brief Inserts keys into an empty heap in linear time.
+   * \details Rather than sifting up each key as it is inserted, the heap property is restored once after all keys have
+   *          been added by sifting down each parent node starting from the bottom of the heap.
+   * \param entries A range of key-priority pairs where each key is distinct.
+   */
+  template <std::ranges::input_range R>
+    requires std::convertible_to<std::ranges::range_reference_t<R>, std::pair<std::uint32_t, float>>
+  void Heapify(R&& entries) {
+    assert(empty());
+    for (const std::pair<std::uint32_t, float> entry : entries) {
+      const auto [key, priority] = entry;
+      assert(!contains(key));  // ensure keys are not inserted more than once
+      positions_[key] = static_cast<std::uint32_t>(nodes_.size());
+      nodes_.push_back(Node{.priority = priority, .key = key});
+    }
+    for (auto position = static_cast<std::uint32_t>(nodes_.size() / 2); position > 0; --position) {
+      SiftDown(position - 1);
+    }
+  }
+
+  /**
+   * \brief Removes the key with the minimum priority from the heap.
+   * \return The removed key.
+   */
+  std::uint32_t Pop() noexcept {
+    const auto key = top();
+    Erase(key);
+    return key;
+  }
+
+  /** \brief Removes a key from the heap. */
+  void Erase(const std::uint32_t key) noexcept {
+    assert(contains(key));
+    const auto position = std::exchange(positions_[key], kInvalidIndex);
+    const auto last_position = static_cast<std::uint32_t>(nodes_.size()) - 1;
+
+    if (position != last_position) {
+      const auto priority = nodes_[position].priority;
+      Move(last_position, position);
+      nodes_.pop_back();
+      if (nodes_[position].priority < priority) {
+        SiftUp(position);
+      } else {
+        SiftDown(position);
+      }
+    } else {
+      nodes_.pop_back();
+    }
+  }
+
+private:
+  struct Node {
+    float priority;
+    std::uint32_t key;
+  };
+
+  void Move(const std::uint32_t from, const std::uint32_t to) noexcept {
+    nodes_[to] = nodes_[from];
+    positions_[nodes_[to].key] = to;
+  }
+
+  void SiftUp(std::uint32_t position) noexcept {
+    const auto node = nodes_[position];
+    while (position > 0) {
+      const auto parent = (position - 1) / 2;
+      if (!(node.priority < nodes_[parent].priority)) break;
+      Move(parent, position);
+      position = parent;
+    }
+    nodes_[position] = node;
+    positions_[node.key] = position;
+  }
+
+  void SiftDown(std::uint32_t position) noexcept {
+    const auto node = nodes_[position];
+    const auto size = static_cast<std::uint32_t>(nodes_.size());
+    for (auto child = 2 * position + 1; child < size; child = 2 * position + 1) {
+      if (child + 1 < size && nodes_[child + 1].priority < nodes_[child].priority) ++child;
+      if (!(nodes_[child].priority < node.priority)) break;
+      Move(child, position);
+      position = child;
+    }
+    nodes_[position] = node;
+    positions_[node.key] = position;
+  }
+
+  std::vector<Node> nodes_;
+  std::vector<std::uint32_t> positions_;
+};
+
+}  // namespace gfx
+
+#endif  // GEOMETRY_INDEXED_MIN_HEAP_H_
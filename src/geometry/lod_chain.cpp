@@ -0,0 +1,67 @@
+#include "geometry/lod_chain.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <ranges>
+#include <utility>
+#include <vector>
+
+#include "geometry/edge_contraction.h"
+#include "geometry/half_edge_mesh.h"
+#include "graphics/device.h"
+
+namespace gfx {
+
+mesh::LodChain mesh::CreateLodChain(const Device& device, const Mesh& mesh, const std::span<const LodTarget> targets) {
+  static constexpr auto kPlacement = VertexPlacement::kEndpoint;
+  const auto& vertices = mesh.vertices();
+
+  HalfEdgeMesh half_edge_mesh{mesh};
+  auto quadrics = CreateErrorQuadrics(half_edge_mesh, half_edge_mesh.vertices().slot_count());
+  auto edge_contractions = CreateEdgeContractions(half_edge_mesh, quadrics, {}, kPlacement);
+
+  // vertices created by edge contractions are placed at an edge vertex and alias a vertex of the original mesh
+  auto mesh_vertices =
+      std::views::iota(0u, static_cast<std::uint32_t>(vertices.size())) | std::ranges::to<std::vector>();
+  std::vector<EdgeContractionRecord> records;
+
+  auto indices = mesh.indices();
+  std::vector<Lod> lods{Lod{.first_index = 0, .index_count = static_cast<std::uint32_t>(indices.size())}};
+  auto max_error = 0.0f;
+
+  for (const auto& target : targets) {
+    records.clear();
+    max_error = std::max(max_error,
+                         ContractEdges(half_edge_mesh,
+                                       quadrics,
+                                       edge_contractions,
+                                       {},
+                                       kPlacement,
+                                       static_cast<float>(target.face_count) + 1.0f,  // stop below the target
+                                       target.max_error,
+                                       &records));
+
+    for (const auto& record : records) {
+      assert(record.new_vertex == mesh_vertices.size());
+      const auto mesh_vertex0 = mesh_vertices[record.vertices[0]];
+      const auto mesh_vertex1 = mesh_vertices[record.vertices[1]];
+      mesh_vertices.push_back(vertices[mesh_vertex0].position == record.position ? mesh_vertex0 : mesh_vertex1);
+    }
+
+    const auto first_index = static_cast<std::uint32_t>(indices.size());
+    for (const auto& faces = half_edge_mesh.faces(); const auto id : faces.indices()) {
+      const auto& face = faces[id];
+      indices.push_back(mesh_vertices[face.v0()]);
+      indices.push_back(mesh_vertices[face.v1()]);
+      indices.push_back(mesh_vertices[face.v2()]);
+    }
+    lods.push_back(Lod{.first_index = first_index,
+                       .index_count = static_cast<std::uint32_t>(indices.size()) - first_index,
+                       .max_error = max_error});
+  }
+
+  return LodChain{.mesh = Mesh{device, vertices, std::move(indices), mesh.transform()}, .lods = std::move(lods)};
+}
+
+}  // namespace gfx
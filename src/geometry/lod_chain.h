@@ -0,0 +1,60 @@
+#ifndef GEOMETRY_LOD_CHAIN_H_
+#define GEOMETRY_LOD_CHAIN_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <vector>
+
+#include "graphics/mesh.h"
+
+namespace gfx {
+class Device;
+
+namespace mesh {
+
+/** \brief The conditions at which edge contraction stops to emit a level of detail. */
+struct LodTarget {
+  /** \brief The number of faces to reduce the level of detail to. */
+  std::size_t face_count = 0;
+
+  /** \brief The maximum quadric error of an edge contraction used to create the level of detail. */
+  float max_error = std::numeric_limits<float>::infinity();
+};
+
+/** \brief A level of detail which references a range of the shared index buffer of a level of detail chain. */
+struct Lod {
+  std::uint32_t first_index = 0;
+  std::uint32_t index_count = 0;
+
+  /** \brief The maximum quadric error of any edge contraction used to create this or a finer level of detail. */
+  float max_error = 0.0f;
+};
+
+/** \brief Levels of detail that share a single vertex buffer and index buffer. */
+struct LodChain {
+  /** \brief The vertices of the original mesh and the indices of each level of detail in order of decreasing detail. */
+  Mesh mesh;
+
+  /** \brief The levels of detail where the first level of detail is the original mesh. */
+  std::vector<Lod> lods;
+};
+
+/**
+ * \brief Creates a chain of successively simplified levels of detail in a single pass of edge contraction.
+ * \details Each edge contraction keeps the edge vertex with the lowest error rather than creating a new vertex so every
+ *          level of detail references the vertex buffer of the original mesh and only index buffers are added for each
+ *          level. Edge contraction for each target resumes where the previous target stopped and stops when either the
+ *          target face count is reached or the next edge contraction would exceed the target error.
+ * \param device The graphics device used to load mesh data into GPU memory.
+ * \param mesh The mesh to create levels of detail for.
+ * \param targets The targets of each level of detail after the original mesh in order of decreasing detail.
+ * \return The original mesh followed by a level of detail for each target.
+ */
+LodChain CreateLodChain(const Device& device, const Mesh& mesh, std::span<const LodTarget> targets);
+
+}  // namespace mesh
+}  // namespace gfx
+
+#endif  // GEOMETRY_LOD_CHAIN_H_
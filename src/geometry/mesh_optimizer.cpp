@@ -0,0 +1,313 @@
+#include "geometry/mesh_optimizer.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <numeric>
+#include <print>
+#include <ranges>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include "geometry/arena.h"
+#include "graphics/device.h"
+
+namespace {
+
+/** \brief The faces incident to each vertex stored contiguously in order of vertex index. */
+struct VertexAdjacency {
+  std::vector<std::uint32_t> offsets;
+  std::vector<std::uint32_t> faces;
+};
+
+VertexAdjacency CreateVertexAdjacency(const std::span<const std::uint32_t> indices, const std::size_t vertex_count) {
+  VertexAdjacency adjacency{.offsets = std::vector<std::uint32_t>(vertex_count + 1, 0),
+                            .faces = std::vector<std::uint32_t>(indices.size())};
+
+  for (const auto index : indices) ++adjacency.offsets[index + 1];
+  std::partial_sum(adjacency.offsets.begin(), adjacency.offsets.end(), adjacency.offsets.begin());
+
+  auto next_offsets = adjacency.offsets;
+  for (std::size_t i = 0; i < indices.size(); ++i) {
+    adjacency.faces[next_offsets[indices[i]]++] = static_cast<std::uint32_t>(i / 3);
+  }
+
+  return adjacency;
+}
+
+/**
+ * \brief Simulates a FIFO post-transform vertex cache with time stamps.
+ * \details Each vertex stores the time at which it entered the cache and time only advances on a cache miss so a
+ *          vertex remains in the cache until \c cache_size vertices have entered after it.
+ */
+class VertexCache {
+public:
+  VertexCache(const std::size_t vertex_count, const std::uint32_t cache_size)
+      : cache_times_(vertex_count, 0), cache_size_{cache_size}, time_{cache_size + 1} {}
+
+  [[nodiscard]] bool contains(const std::uint32_t vertex) const noexcept {
+    assert(vertex < cache_times_.size());
+    return time_ - cache_times_[vertex] <= cache_size_;
+  }
+
+  /** \brief Gets the number of vertices that entered the cache after a vertex. */
+  [[nodiscard]] std::uint32_t age(const std::uint32_t vertex) const noexcept { return time_ - cache_times_[vertex]; }
+
+  /** \brief Transforms a vertex and returns \c true if the vertex was not in the cache. */
+  bool Insert(const std::uint32_t vertex) noexcept {
+    if (contains(vertex)) return false;
+    cache_times_[vertex] = time_++;
+    return true;
+  }
+
+  /** \brief Evicts all vertices from the cache. */
+  void Clear() noexcept { time_ += cache_size_ + 1; }
+
+private:
+  std::vector<std::uint32_t> cache_times_;
+  std::uint32_t cache_size_;
+  std::uint32_t time_;
+};
+
+/** \brief A contiguous range of triangles in an index buffer that is drawn as a unit when sorting for overdraw. */
+struct Cluster {
+  std::size_t first_face = 0;
+  std::size_t face_count = 0;
+  float sort_key = 0.0f;
+};
+
+/** \brief Gets the area-weighted normal of a triangle whose length is twice the triangle area. */
+glm::vec3 GetAreaNormal(const std::span<const std::uint32_t> indices,
+                        const std::span<const glm::vec3> positions,
+                        const std::size_t face) {
+  const auto& p0 = positions[indices[3 * face]];
+  const auto& p1 = positions[indices[3 * face + 1]];
+  const auto& p2 = positions[indices[3 * face + 2]];
+  return glm::cross(p1 - p0, p2 - p0);
+}
+
+glm::vec3 GetCentroid(const std::span<const std::uint32_t> indices,
+                      const std::span<const glm::vec3> positions,
+                      const std::size_t face) {
+  return (positions[indices[3 * face]] + positions[indices[3 * face + 1]] + positions[indices[3 * face + 2]]) / 3.0f;
+}
+
+/** \brief Splits triangles into clusters where vertex cache reuse is lost or the cluster miss ratio is low enough. */
+std::vector<Cluster> CreateClusters(const std::span<const std::uint32_t> indices,
+                                    const std::size_t vertex_count,
+                                    const std::uint32_t cache_size,
+                                    const float max_cluster_acmr) {
+  const auto face_count = indices.size() / 3;
+  VertexCache vertex_cache{vertex_count, cache_size};
+  std::vector<Cluster> clusters;
+  auto cluster = Cluster{};
+  auto cluster_miss_count = 0u;
+
+  for (std::size_t face = 0; face < face_count; ++face) {
+    // split the cluster once it reuses the cache as well as the mesh since drawing it out of order costs little
+    if (cluster.face_count > 0
+        && static_cast<float>(cluster_miss_count) <= max_cluster_acmr * static_cast<float>(cluster.face_count)) {
+      clusters.push_back(std::exchange(cluster, Cluster{.first_face = face}));
+      cluster_miss_count = 0;
+      vertex_cache.Clear();
+    }
+
+    auto miss_count = 0u;
+    for (const auto vertex : indices.subspan(3 * face, 3)) miss_count += vertex_cache.Insert(vertex) ? 1 : 0;
+
+    // a triangle that misses the cache for every vertex does not depend on the preceding triangles
+    if (miss_count == 3 && cluster.face_count > 0) {
+      clusters.push_back(std::exchange(cluster, Cluster{.first_face = face}));
+      cluster_miss_count = 0;
+    }
+
+    ++cluster.face_count;
+    cluster_miss_count += miss_count;
+  }
+
+  if (cluster.face_count > 0) clusters.push_back(cluster);
+  return clusters;
+}
+
+}  // namespace
+
+namespace gfx {
+
+VertexCacheStatistics AnalyzeVertexCache(const std::span<const std::uint32_t> indices,
+                                         const std::size_t vertex_count,
+                                         const std::uint32_t cache_size) {
+  VertexCache vertex_cache{vertex_count, cache_size};
+  std::vector<std::uint8_t> referenced_vertices(vertex_count, 0);
+  auto miss_count = 0u;
+  auto referenced_vertex_count = 0u;
+
+  for (const auto vertex : indices) {
+    if (vertex_cache.Insert(vertex)) ++miss_count;
+    if (std::exchange(referenced_vertices[vertex], 1) == 0) ++referenced_vertex_count;
+  }
+
+  if (indices.empty()) return VertexCacheStatistics{};
+  return VertexCacheStatistics{
+      .acmr = static_cast<float>(miss_count) / static_cast<float>(indices.size() / 3),
+      .atvr = static_cast<float>(miss_count) / static_cast<float>(referenced_vertex_count)};
+}
+
+std::vector<std::uint32_t> OptimizeVertexCache(const std::span<const std::uint32_t> indices,
+                                               const std::size_t vertex_count,
+                                               const std::uint32_t cache_size) {
+  const auto adjacency = CreateVertexAdjacency(indices, vertex_count);
+  std::vector<std::uint32_t> live_face_counts(vertex_count);
+  for (std::size_t vertex = 0; vertex < vertex_count; ++vertex) {
+    live_face_counts[vertex] = adjacency.offsets[vertex + 1] - adjacency.offsets[vertex];
+  }
+
+  VertexCache vertex_cache{vertex_count, cache_size};
+  std::vector<std::uint8_t> emitted_faces(indices.size() / 3, 0);
+  std::vector<std::uint32_t> dead_end_stack;
+  std::vector<std::uint32_t> candidates;
+  std::vector<std::uint32_t> optimized_indices;
+  dead_end_stack.reserve(indices.size());
+  optimized_indices.reserve(indices.size());
+
+  // when no candidate is live, continue from the most recently emitted live vertex or the next live input vertex
+  std::uint32_t cursor = 0;
+  const auto skip_dead_end = [&] {
+    while (!dead_end_stack.empty()) {
+      const auto vertex = dead_end_stack.back();
+      dead_end_stack.pop_back();
+      if (live_face_counts[vertex] > 0) return vertex;
+    }
+    for (; cursor < vertex_count; ++cursor) {
+      if (live_face_counts[cursor] > 0) return cursor;
+    }
+    return kInvalidIndex;
+  };
+
+  for (auto fanning_vertex = skip_dead_end(); fanning_vertex != kInvalidIndex;) {
+    // emit all remaining faces incident to the fanning vertex
+    candidates.clear();
+    for (auto i = adjacency.offsets[fanning_vertex]; i < adjacency.offsets[fanning_vertex + 1]; ++i) {
+      const auto face = adjacency.faces[i];
+      if (std::exchange(emitted_faces[face], 1) != 0) continue;
+      for (const auto vertex : indices.subspan(3 * static_cast<std::size_t>(face), 3)) {
+        optimized_indices.push_back(vertex);
+        dead_end_stack.push_back(vertex);
+        candidates.push_back(vertex);
+        --live_face_counts[vertex];
+        vertex_cache.Insert(vertex);
+      }
+    }
+
+    // prefer the oldest candidate that will still be in the cache after emitting all of its remaining faces
+    auto next_vertex = kInvalidIndex;
+    auto max_priority = -1;
+    for (const auto vertex : candidates) {
+      if (live_face_counts[vertex] == 0) continue;
+      auto priority = 0;
+      if (const auto age = vertex_cache.age(vertex); age + 2 * live_face_counts[vertex] <= cache_size) {
+        priority = static_cast<int>(age);
+      }
+      if (priority > max_priority) {
+        max_priority = priority;
+        next_vertex = vertex;
+      }
+    }
+    fanning_vertex = next_vertex != kInvalidIndex ? next_vertex : skip_dead_end();
+  }
+
+  assert(optimized_indices.size() == indices.size());
+  return optimized_indices;
+}
+
+std::vector<std::uint32_t> OptimizeOverdraw(const std::span<const std::uint32_t> indices,
+                                            const std::span<const glm::vec3> positions,
+                                            const std::uint32_t cache_size,
+                                            const float threshold) {
+  const auto face_count = indices.size() / 3;
+  if (face_count == 0) return {};
+
+  const auto statistics = AnalyzeVertexCache(indices, positions.size(), cache_size);
+  auto clusters = CreateClusters(indices, positions.size(), cache_size, threshold * statistics.acmr);
+
+  auto mesh_centroid = glm::vec3{0.0f};
+  auto mesh_area = 0.0f;
+  for (std::size_t face = 0; face < face_count; ++face) {
+    const auto area = glm::length(GetAreaNormal(indices, positions, face));
+    mesh_centroid += area * GetCentroid(indices, positions, face);
+    mesh_area += area;
+  }
+  if (mesh_area > 0.0f) mesh_centroid /= mesh_area;
+
+  // clusters facing away from the mesh centroid are more likely to occlude other clusters and are drawn first
+  for (auto& cluster : clusters) {
+    auto cluster_normal = glm::vec3{0.0f};
+    auto cluster_centroid = glm::vec3{0.0f};
+    auto cluster_area = 0.0f;
+    for (auto face = cluster.first_face; face < cluster.first_face + cluster.face_count; ++face) {
+      const auto area_normal = GetAreaNormal(indices, positions, face);
+      const auto area = glm::length(area_normal);
+      cluster_normal += area_normal;
+      cluster_centroid += area * GetCentroid(indices, positions, face);
+      cluster_area += area;
+    }
+    if (const auto normal_length = glm::length(cluster_normal); cluster_area > 0.0f && normal_length > 0.0f) {
+      cluster.sort_key = glm::dot(cluster_centroid / cluster_area - mesh_centroid, cluster_normal / normal_length);
+    }
+  }
+  std::ranges::stable_sort(clusters, std::ranges::greater{}, &Cluster::sort_key);
+
+  std::vector<std::uint32_t> optimized_indices;
+  optimized_indices.reserve(indices.size());
+  for (const auto& cluster : clusters) {
+    const auto cluster_indices = indices.subspan(3 * cluster.first_face, 3 * cluster.face_count);
+    optimized_indices.insert(optimized_indices.end(), cluster_indices.begin(), cluster_indices.end());
+  }
+
+  return optimized_indices;
+}
+
+void OptimizeVertexFetch(std::vector<Mesh::Vertex>& vertices, std::vector<std::uint32_t>& indices) {
+  std::vector<std::uint32_t> index_map(vertices.size(), kInvalidIndex);
+  std::vector<Mesh::Vertex> optimized_vertices;
+  optimized_vertices.reserve(vertices.size());
+
+  for (auto& index : indices) {
+    if (index_map[index] == kInvalidIndex) {
+      index_map[index] = static_cast<std::uint32_t>(optimized_vertices.size());
+      optimized_vertices.push_back(vertices[index]);
+    }
+    index = index_map[index];
+  }
+
+  vertices = std::move(optimized_vertices);
+}
+
+void Optimize(std::vector<Mesh::Vertex>& vertices, std::vector<std::uint32_t>& indices) {
+  const auto initial_statistics = AnalyzeVertexCache(indices, vertices.size());
+  const auto positions = vertices | std::views::transform(&Mesh::Vertex::position) | std::ranges::to<std::vector>();
+
+  indices = OptimizeOverdraw(OptimizeVertexCache(indices, vertices.size()), positions);
+  OptimizeVertexFetch(vertices, indices);
+
+  const auto optimized_statistics = AnalyzeVertexCache(indices, vertices.size());
+  std::println(std::clog,
+               "Mesh optimized from an ACMR of {:.3f} and ATVR of {:.3f} to an ACMR of {:.3f} and ATVR of {:.3f}",
+               initial_statistics.acmr,
+               initial_statistics.atvr,
+               optimized_statistics.acmr,
+               optimized_statistics.atvr);
+}
+
+Mesh mesh::Optimize(const Device& device, const Mesh& mesh) {
+  auto vertices = mesh.vertices();
+  auto indices = mesh.indices();
+  Optimize(vertices, indices);
+  return Mesh{device, std::move(vertices), std::move(indices), mesh.transform()};
+}
+
+}  // namespace gfx
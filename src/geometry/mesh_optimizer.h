@@ -0,0 +1,103 @@
+#ifndef GEOMETRY_MESH_OPTIMIZER_H_
+#define GEOMETRY_MESH_OPTIMIZER_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include <glm/vec3.hpp>
+
+#include "graphics/mesh.h"
+
+namespace gfx {
+class Device;
+
+/** \brief The number of entries in the simulated post-transform vertex cache. */
+inline constexpr std::uint32_t kVertexCacheSize = 16;
+
+/** \brief The efficiency of an index buffer for a simulated FIFO post-transform vertex cache. */
+struct VertexCacheStatistics {
+  /** \brief The average cache miss ratio which is the number of transformed vertices per triangle from 0.5 to 3. */
+  float acmr = 0.0f;
+
+  /** \brief The average transformed vertex ratio which is the number of transformed vertices per referenced vertex. */
+  float atvr = 0.0f;
+};
+
+/**
+ * \brief Simulates a FIFO post-transform vertex cache to measure the efficiency of an index buffer.
+ * \param indices The vertex indices of each triangle.
+ * \param vertex_count The number of vertices referenced by \p indices.
+ * \param cache_size The number of entries in the vertex cache.
+ * \return The vertex cache statistics of \p indices.
+ */
+VertexCacheStatistics AnalyzeVertexCache(std::span<const std::uint32_t> indices,
+                                         std::size_t vertex_count,
+                                         std::uint32_t cache_size = kVertexCacheSize);
+
+/**
+ * \brief Reorders triangles to improve reuse of the post-transform vertex cache.
+ * \details Triangles are emitted by fanning around vertices chosen to remain in the cache for as long as they have
+ *          triangles left to emit. When no such vertex exists, the next fanning vertex is taken from the most recently
+ *          emitted vertices with remaining triangles before falling back to a linear scan of the input.
+ * \param indices The vertex indices of each triangle.
+ * \param vertex_count The number of vertices referenced by \p indices.
+ * \param cache_size The number of entries in the vertex cache.
+ * \return The reordered vertex indices where the vertex order within each triangle is preserved.
+ * \see Sander, P. V., Nehab, D., & Barczak, J. (2007). Fast triangle reordering for vertex locality and reduced
+ *      overdraw.
+ */
+std::vector<std::uint32_t> OptimizeVertexCache(std::span<const std::uint32_t> indices,
+                                               std::size_t vertex_count,
+                                               std::uint32_t cache_size = kVertexCacheSize);
+
+/**
+ * \brief Reorders clusters of triangles to reduce overdraw while preserving most vertex cache reuse.
+ * \details Triangles are split into clusters at points where vertex cache reuse is already lost or where the cache miss
+ *          ratio of the current cluster is within \p threshold of the mesh. Clusters are then sorted such that clusters
+ *          facing away from the mesh centroid are drawn first since they are most likely to occlude other clusters.
+ * \param indices The vertex cache optimized vertex indices of each triangle.
+ * \param positions The vertex positions referenced by \p indices.
+ * \param cache_size The number of entries in the vertex cache.
+ * \param threshold The maximum permitted increase in the cache miss ratio of a cluster relative to the whole mesh.
+ * \return The reordered vertex indices.
+ * \see Sander, P. V., Nehab, D., & Barczak, J. (2007). Fast triangle reordering for vertex locality and reduced
+ *      overdraw.
+ */
+std::vector<std::uint32_t> OptimizeOverdraw(std::span<const std::uint32_t> indices,
+                                            std::span<const glm::vec3> positions,
+                                            std::uint32_t cache_size = kVertexCacheSize,
+                                            float threshold = 1.05f);
+
+/**
+ * \brief Reorders vertices in order of first use by an index buffer to improve vertex fetch locality.
+ * \details Vertices that are not referenced by \p indices are removed.
+ * \param vertices The vertices to reorder.
+ * \param indices The vertex indices of each triangle which are remapped to the reordered vertices.
+ */
+void OptimizeVertexFetch(std::vector<Mesh::Vertex>& vertices, std::vector<std::uint32_t>& indices);
+
+/**
+ * \brief Reorders triangles and vertices for the post-transform vertex cache, overdraw, and vertex fetch.
+ * \details Vertex cache statistics before and after optimization are written to the log.
+ * \param vertices The vertices to reorder.
+ * \param indices The vertex indices of each triangle which are reordered and remapped to the reordered vertices.
+ */
+void Optimize(std::vector<Mesh::Vertex>& vertices, std::vector<std::uint32_t>& indices);
+
+namespace mesh {
+
+/**
+ * \brief Reorders the triangles and vertices of a mesh for the post-transform vertex cache, overdraw, and vertex fetch.
+ * \details Vertex cache statistics before and after optimization are written to the log.
+ * \param device The graphics device used to load the optimized mesh data into GPU memory.
+ * \param mesh The mesh to optimize.
+ * \return A mesh with the same triangles as \p mesh in an order suited to rendering.
+ */
+Mesh Optimize(const Device& device, const Mesh& mesh);
+
+}  // namespace mesh
+}  // namespace gfx
+
+#endif  // GEOMETRY_MESH_OPTIMIZER_H_
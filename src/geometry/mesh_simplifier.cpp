@@ -1,218 +1,327 @@
 #include "geometry/mesh_simplifier.h"
 
 #include <algorithm>
-#include <cassert>
 #include <chrono>
+#include <cstdint>
 #include <format>
+#include <functional>
 #include <iostream>
-#include <memory>
+#include <limits>
 #include <print>
-#include <queue>
 #include <ranges>
+#include <span>
 #include <stdexcept>
+#include <thread>
 #include <unordered_map>
 #include <utility>
 #include <vector>
 
 #include <glm/glm.hpp>
 
-#include "geometry/half_edge.h"
+#include "concurrency/parallel_for.h"
+#include "geometry/edge_contraction.h"
 #include "geometry/half_edge_mesh.h"
-#include "geometry/vertex.h"
+#include "geometry/mesh_optimizer.h"
+#include "geometry/vertex_clustering.h"
 #include "graphics/device.h"
 #include "graphics/mesh.h"
 
 namespace {
 
-struct EdgeContraction {
-  EdgeContraction(const std::shared_ptr<gfx::HalfEdge>& edge,
-                  const std::shared_ptr<gfx::Vertex>& vertex,
-                  const glm::mat4& quadric,
-                  const float cost,
-                  const bool valid = true)
-      : edge{edge}, vertex{vertex}, quadric{quadric}, cost{cost}, valid{valid} {}
-
-  std::shared_ptr<gfx::HalfEdge> edge;
-  std::shared_ptr<gfx::Vertex> vertex;
-  glm::mat4 quadric;
-  float cost;
-  bool valid;
-};
-
-std::shared_ptr<gfx::HalfEdge> GetMinEdge(const std::shared_ptr<gfx::HalfEdge>& edge01) {
-  const auto edge10 = edge01->flip();
-  return edge01->vertex()->id() < edge10->vertex()->id() ? edge01 : edge10;
-}
-
-glm::mat4 CreateErrorQuadric(const gfx::Vertex& v0) {
-  glm::mat4 quadric{0.0f};
-  auto edgei0 = v0.edge();
+/** \brief The minimum number of faces in a region which amortizes the cost of stitching regions together. */
+constexpr std::size_t kMinRegionFaceCount = 4096;
+
+/** \brief The factor of the target face count that vertex clustering reduces a mesh to before edge contraction. */
+constexpr std::size_t kClusteringFaceCountFactor = 4;
+
+/** \brief Identifies vertices incident to faces in more than one region. */
+constexpr auto kSharedRegion = gfx::kInvalidIndex - 1;
+
+/**
+ * \brief Assigns faces to spatial regions by recursively splitting face centroids at the median of their longest axis.
+ * \param faces The faces to partition.
+ * \param centroids The centroid of each face indexed by face ID.
+ * \param first_region The first region ID to assign to \p faces.
+ * \param region_count The number of regions to partition \p faces into.
+ * \param face_regions The region ID of each face indexed by face ID.
+ */
+void PartitionFaces(const std::span<std::uint32_t> faces,
+                    const std::span<const glm::vec3> centroids,
+                    const std::uint32_t first_region,
+                    const std::uint32_t region_count,
+                    std::vector<std::uint32_t>& face_regions) {
+  if (region_count == 1) {
+    for (const auto face : faces) face_regions[face] = first_region;
+    return;
+  }
 
-  do {
-    const auto& position = v0.position();
-    const auto& normal = edgei0->face()->normal();
-    const glm::vec4 plane{normal, -glm::dot(position, normal)};
-    quadric += glm::outerProduct(plane, plane);
-    edgei0 = edgei0->next()->flip();
-  } while (edgei0 != v0.edge());
+  glm::vec3 min{std::numeric_limits<float>::max()};
+  glm::vec3 max{std::numeric_limits<float>::lowest()};
+  for (const auto face : faces) {
+    min = glm::min(min, centroids[face]);
+    max = glm::max(max, centroids[face]);
+  }
 
-  return quadric;
+  const auto extent = max - min;
+  const glm::length_t axis = extent.x >= extent.y && extent.x >= extent.z ? 0 : extent.y >= extent.z ? 1 : 2;
+  const auto left_region_count = region_count / 2;
+  const auto split = faces.begin() + static_cast<std::ptrdiff_t>(faces.size() * left_region_count / region_count);
+  std::ranges::nth_element(faces, split, std::less{}, [&](const auto face) { return centroids[face][axis]; });
+
+  PartitionFaces(std::span{faces.begin(), split}, centroids, first_region, left_region_count, face_regions);
+  PartitionFaces(std::span{split, faces.end()},
+                 centroids,
+                 first_region + left_region_count,
+                 region_count - left_region_count,
+                 face_regions);
 }
 
-std::shared_ptr<EdgeContraction> CreateEdgeContraction(const std::shared_ptr<gfx::HalfEdge>& edge01,
-                                                       const std::unordered_map<std::uint32_t, glm::mat4>& quadrics) {
-  const auto v0 = edge01->flip()->vertex();
-  const auto q0_iterator = quadrics.find(v0->id());
-  assert(q0_iterator != quadrics.cend());
-
-  const auto v1 = edge01->vertex();
-  const auto q1_iterator = quadrics.find(v1->id());
-  assert(q1_iterator != quadrics.cend());
-
-  const auto& q0 = q0_iterator->second;
-  const auto& q1 = q1_iterator->second;
-  const auto q01 = q0 + q1;
+/**
+ * \brief Extracts a region of a mesh where vertices shared with other regions are locked.
+ * \param positions The vertex positions of the mesh being simplified.
+ * \param indices The vertex indices of each triangle in the mesh being simplified.
+ * \param region The ID of the region to extract.
+ * \param region_faces The faces in the region.
+ * \param seam_faces The faces in any region incident to a shared vertex.
+ * \param face_regions The region ID of each face indexed by face ID.
+ * \param vertex_regions The region ID of each vertex or \c kSharedRegion for vertices in more than one region.
+ * \return The mesh region and the original vertex ID of each region vertex.
+ */
+std::pair<gfx::MeshRegion, std::vector<std::uint32_t>> ExtractRegion(
+    const std::span<const glm::vec3> positions,
+    const std::span<const std::uint32_t> indices,
+    const std::uint32_t region,
+    const std::span<const std::uint32_t> region_faces,
+    const std::span<const std::uint32_t> seam_faces,
+    const std::span<const std::uint32_t> face_regions,
+    const std::span<const std::uint32_t> vertex_regions) {
+  gfx::MeshRegion mesh_region;
+  std::vector<std::uint32_t> vertex_ids;
+  std::unordered_map<std::uint32_t, std::uint32_t> local_ids;
+
+  const auto add_face = [&](const std::uint32_t face) {
+    for (const auto vertex_id : indices.subspan(3 * static_cast<std::size_t>(face), 3)) {
+      const auto [iterator, inserted] =
+          local_ids.try_emplace(vertex_id, static_cast<std::uint32_t>(mesh_region.positions.size()));
+      if (inserted) {
+        mesh_region.positions.push_back(positions[vertex_id]);
+        vertex_ids.push_back(vertex_id);
+      }
+      mesh_region.indices.push_back(iterator->second);
+    }
+  };
 
-  if (glm::determinant(q01) == 0.0f) {
-    // average the edge vertices if the error quadric is not invertible
-    const auto position = (v0->position() + v1->position()) / 2.0f;
-    return std::make_shared<EdgeContraction>(edge01, std::make_shared<gfx::Vertex>(position), q01, 0.0f);
+  for (const auto face : region_faces) add_face(face);
+  mesh_region.face_count = region_faces.size();
+  mesh_region.closed_vertex_count = static_cast<std::uint32_t>(mesh_region.positions.size());
+
+  // faces from other regions incident to shared vertices are included so that every vertex in the region has a closed
+  // one-ring which allows quadrics and edge contractions adjacent to shared vertices to be computed exactly
+  for (const auto face : seam_faces) {
+    if (face_regions[face] == region) continue;
+    if (std::ranges::any_of(indices.subspan(3 * static_cast<std::size_t>(face), 3), [&](const auto id) {
+          const auto iterator = local_ids.find(id);
+          return vertex_regions[id] == kSharedRegion && iterator != local_ids.cend()
+                 && iterator->second < mesh_region.closed_vertex_count;
+        })) {
+      add_face(face);
+    }
   }
 
-  auto position = glm::inverse(q01) * glm::vec4{0.0f, 0.0f, 0.0f, 1.0f};
-  position /= position.w;
+  mesh_region.locked_vertices = vertex_ids | std::views::transform([&](const auto id) {
+                                  return static_cast<std::uint8_t>(vertex_regions[id] != region);
+                                })
+                                | std::ranges::to<std::vector>();
 
-  const auto squared_distance = glm::dot(position, q01 * position);
-  return std::make_shared<EdgeContraction>(edge01, std::make_shared<gfx::Vertex>(position), q01, squared_distance);
+  return {std::move(mesh_region), std::move(vertex_ids)};
 }
 
-bool WillDegenerate(const std::shared_ptr<gfx::HalfEdge>& edge01) {
-  const auto v0 = edge01->flip()->vertex();
-  const auto v1_next = edge01->next()->vertex();
-  const auto v0_next = edge01->flip()->next()->vertex();
-  std::unordered_map<std::uint32_t, std::shared_ptr<gfx::Vertex>> neighborhood;
+/**
+ * \brief Simplifies a mesh by partitioning it into spatial regions which are simplified in parallel.
+ * \details Each region is simplified on its own thread while vertices shared with other regions remain locked. Regions
+ *          are then stitched back together at their shared vertices and the seams are simplified sequentially using
+ *          the quadrics accumulated in each region until the target face count is reached.
+ * \param mesh_positions The vertex positions of the mesh to simplify.
+ * \param mesh_indices The vertex indices of each triangle in the mesh to simplify.
+ * \param transform The model transform of the mesh to simplify.
+ * \param target_face_count The number of faces to reduce the mesh to.
+ * \param region_count The number of regions to partition the mesh into.
+ * \param placement Determines where the vertex created by each edge contraction is placed.
+ * \return The simplified half-edge mesh.
+ */
+gfx::HalfEdgeMesh SimplifyRegions(const std::span<const glm::vec3> mesh_positions,
+                                  const std::span<const std::uint32_t> mesh_indices,
+                                  const glm::mat4& transform,
+                                  const float target_face_count,
+                                  const std::uint32_t region_count,
+                                  const gfx::VertexPlacement placement) {
+  const auto face_count = static_cast<std::uint32_t>(mesh_indices.size() / 3);
+  const auto rate = 1.0f - target_face_count / static_cast<float>(face_count);
+
+  std::vector<glm::vec3> centroids(face_count);
+  gfx::ParallelFor(face_count, [&](const std::size_t begin, const std::size_t end) {
+    for (auto face = begin; face < end; ++face) {
+      centroids[face] = (mesh_positions[mesh_indices[3 * face]] + mesh_positions[mesh_indices[3 * face + 1]]
+                         + mesh_positions[mesh_indices[3 * face + 2]])
+                        / 3.0f;
+    }
+  });
+
+  // faces are partitioned in place such that faces in the same region are stored contiguously in order of region ID
+  auto faces = std::views::iota(0u, face_count) | std::ranges::to<std::vector>();
+  std::vector<std::uint32_t> face_regions(face_count);
+  PartitionFaces(faces, centroids, 0, region_count, face_regions);
+
+  std::vector<std::size_t> region_offsets(region_count + 1, 0);
+  for (const auto region : face_regions) ++region_offsets[region + 1];
+  for (std::uint32_t region = 0; region < region_count; ++region) {
+    region_offsets[region + 1] += region_offsets[region];
+  }
 
-  for (auto iterator = edge01->next(); iterator != edge01->flip(); iterator = iterator->flip()->next()) {
-    if (const auto vertex = iterator->vertex(); vertex != v0 && vertex != v1_next && vertex != v0_next) {
-      neighborhood.emplace(vertex->id(), vertex);
+  std::vector<std::uint32_t> vertex_regions(mesh_positions.size(), gfx::kInvalidIndex);
+  for (std::uint32_t face = 0; face < face_count; ++face) {
+    for (const auto id : mesh_indices.subspan(3 * static_cast<std::size_t>(face), 3)) {
+      if (auto& vertex_region = vertex_regions[id]; vertex_region == gfx::kInvalidIndex) {
+        vertex_region = face_regions[face];
+      } else if (vertex_region != face_regions[face]) {
+        vertex_region = kSharedRegion;
+      }
     }
   }
 
-  for (auto iterator = edge01->flip()->next(); iterator != edge01; iterator = iterator->flip()->next()) {
-    if (const auto vertex = iterator->vertex(); neighborhood.contains(vertex->id())) {
-      return true;
+  const auto seam_faces = std::views::iota(0u, face_count) | std::views::filter([&](const auto face) {
+                            return std::ranges::any_of(
+                                mesh_indices.subspan(3 * static_cast<std::size_t>(face), 3),
+                                [&](const auto id) { return vertex_regions[id] == kSharedRegion; });
+                          })
+                          | std::ranges::to<std::vector>();
+
+  std::vector<gfx::SimplifiedRegion> regions(region_count);
+  gfx::ParallelFor(
+      region_count,
+      [&](const std::size_t begin, const std::size_t end) {
+        for (auto region = static_cast<std::uint32_t>(begin); region < end; ++region) {
+          const auto region_faces = std::span{faces}.subspan(region_offsets[region],
+                                                             region_offsets[region + 1] - region_offsets[region]);
+          const auto [mesh_region, vertex_ids] = ExtractRegion(
+              mesh_positions, mesh_indices, region, region_faces, seam_faces, face_regions, vertex_regions);
+
+          // map locked vertices back to their original vertex ID so they can be merged with adjacent regions
+          auto simplified_region = gfx::SimplifyRegion(mesh_region, rate, placement);
+          for (auto& locked_vertex_id : simplified_region.locked_vertex_ids) {
+            if (locked_vertex_id != gfx::kInvalidIndex) locked_vertex_id = vertex_ids[locked_vertex_id];
+          }
+          regions[region] = std::move(simplified_region);
+        }
+      },
+      1);
+
+  // stitch regions together by merging shared vertices which were not modified during region simplification
+  std::vector<glm::vec3> positions;
+  std::vector<gfx::PositionQuadric> quadrics;
+  std::vector<std::uint32_t> indices;
+  std::vector<std::uint32_t> shared_vertex_ids(mesh_positions.size(), gfx::kInvalidIndex);
+
+  for (const auto& region : regions) {
+    std::vector<std::uint32_t> stitched_ids(region.positions.size());
+    for (std::size_t i = 0; i < region.positions.size(); ++i) {
+      const auto shared_vertex_id = region.locked_vertex_ids[i];
+      if (shared_vertex_id != gfx::kInvalidIndex && shared_vertex_ids[shared_vertex_id] != gfx::kInvalidIndex) {
+        stitched_ids[i] = shared_vertex_ids[shared_vertex_id];
+        continue;
+      }
+      stitched_ids[i] = static_cast<std::uint32_t>(positions.size());
+      positions.push_back(region.positions[i]);
+      quadrics.push_back(region.quadrics[i]);
+      if (shared_vertex_id != gfx::kInvalidIndex) shared_vertex_ids[shared_vertex_id] = stitched_ids[i];
     }
+    for (const auto index : region.indices) indices.push_back(stitched_ids[index]);
+  }
+
+  gfx::HalfEdgeMesh half_edge_mesh{positions, indices, transform};
+  quadrics.reserve(quadrics.size() + indices.size() / 6);
+  ContractEdges(half_edge_mesh, quadrics, {}, target_face_count, placement);
+  return half_edge_mesh;
+}
+
+/**
+ * \brief Simplifies a mesh with an error metric over vertex positions.
+ * \param mesh The mesh to simplify.
+ * \param target_face_count The number of faces to reduce the mesh to.
+ * \param options Options used to configure mesh simplification.
+ * \return The vertices and indices of the simplified mesh.
+ */
+gfx::AttributeMesh SimplifyPositions(const gfx::Mesh& mesh,
+                                     const float target_face_count,
+                                     const gfx::mesh::SimplifyOptions& options) {
+  const auto initial_face_count = mesh.indices().size() / 3;
+  auto positions =
+      mesh.vertices() | std::views::transform(&gfx::Mesh::Vertex::position) | std::ranges::to<std::vector>();
+  std::span<const std::uint32_t> indices = mesh.indices();
+
+  // vertex clustering removes most faces of meshes far larger than the target size before edge contraction
+  gfx::ClusteredMesh clustered_mesh;
+  if (const auto clustered_face_count = kClusteringFaceCountFactor * static_cast<std::size_t>(target_face_count);
+      options.cluster_vertices && initial_face_count > clustered_face_count) {
+    clustered_mesh = gfx::ClusterVertices(positions, indices, clustered_face_count);
+    positions = std::move(clustered_mesh.positions);
+    indices = clustered_mesh.indices;
   }
 
-  return false;
+  // limit the number of regions so that the cost of stitching regions together does not outweigh parallel speedup
+  const auto partition_count =
+      options.partition_count == 0 ? std::max(std::thread::hardware_concurrency(), 1u) : options.partition_count;
+  const auto region_count = static_cast<std::uint32_t>(
+      std::min<std::size_t>(partition_count, std::max<std::size_t>(indices.size() / 3 / kMinRegionFaceCount, 1)));
+
+  auto half_edge_mesh = [&] {
+    if (options.contract_independent_edges) {
+      gfx::HalfEdgeMesh simplified_mesh{positions, indices, mesh.transform()};
+      auto quadrics = gfx::CreateErrorQuadrics(simplified_mesh, simplified_mesh.vertices().slot_count());
+      gfx::ContractIndependentEdges(simplified_mesh, quadrics, {}, target_face_count, options.placement);
+      return simplified_mesh;
+    }
+    if (region_count > 1) {
+      return SimplifyRegions(positions, indices, mesh.transform(), target_face_count, region_count, options.placement);
+    }
+    gfx::HalfEdgeMesh simplified_mesh{positions, indices, mesh.transform()};
+    auto quadrics = gfx::CreateErrorQuadrics(simplified_mesh, simplified_mesh.vertices().slot_count());
+    gfx::ContractEdges(simplified_mesh, quadrics, {}, target_face_count, options.placement);
+    return simplified_mesh;
+  }();
+
+  gfx::AttributeMesh simplified_mesh;
+  half_edge_mesh.ToIndexedMesh(simplified_mesh.vertices, simplified_mesh.indices);
+  return simplified_mesh;
 }
 
 }  // namespace
 
 namespace gfx {
 
-Mesh mesh::Simplify(const Device& device, const Mesh& mesh, const float rate) {
+Mesh mesh::Simplify(const Device& device, const Mesh& mesh, const float rate, const SimplifyOptions& options) {
   if (rate < 0.0f || rate > 1.0f) {
     throw std::invalid_argument{std::format("Invalid mesh simplification rate: {}", rate)};
   }
 
   const auto start_time = std::chrono::high_resolution_clock::now();
-  HalfEdgeMesh half_edge_mesh{mesh};
-
-  // compute error quadrics for each vertex in the mesh
-  std::unordered_map<std::uint32_t, glm::mat4> quadrics;
-  for (const auto& [id, vertex] : half_edge_mesh.vertices()) {
-    quadrics.emplace(id, CreateErrorQuadric(*vertex));
-  }
-
-  // use a priority queue to sort edge contraction candidates by the cost of removing each edge
-  static constexpr auto kSortByMinCost = [](const auto& lhs, const auto& rhs) { return lhs->cost > rhs->cost; };
-  std::priority_queue<std::shared_ptr<EdgeContraction>,
-                      std::vector<std::shared_ptr<EdgeContraction>>,
-                      decltype(kSortByMinCost)>
-      edge_contractions{kSortByMinCost};
-
-  // this is used to invalidate existing priority queue entries as edges are updated or removed from the mesh
-  std::unordered_map<std::size_t, std::shared_ptr<EdgeContraction>> valid_edges;
-
-  // compute edge contraction candidates for each edge in the mesh
-  for (const auto& edge : half_edge_mesh.edges() | std::views::values) {
-    const auto min_edge = GetMinEdge(edge);
-    const auto min_edge_key = hash_value(*min_edge);
-
-    if (!valid_edges.contains(min_edge_key)) {
-      auto edge_contraction = CreateEdgeContraction(min_edge, quadrics);
-      edge_contractions.push(edge_contraction);
-      valid_edges.emplace(min_edge_key, std::move(edge_contraction));
-    }
-  }
+  const auto initial_face_count = mesh.indices().size() / 3;
+  const auto target_face_count = (1.0f - rate) * static_cast<float>(initial_face_count);
 
-  // stop mesh simplification if the number of triangles has been sufficiently reduced
-  const auto initial_face_count = half_edge_mesh.faces().size();
-  const auto is_simplified = [&, target_face_count = (1.0f - rate) * static_cast<float>(initial_face_count)] {
-    const auto face_count = static_cast<float>(half_edge_mesh.faces().size());
-    return edge_contractions.empty() || face_count < target_face_count;
-  };
-
-  for (auto next_vertex_id = half_edge_mesh.vertices().size(); !is_simplified(); edge_contractions.pop()) {
-    const auto& edge_contraction = edge_contractions.top();
-    const auto& edge01 = edge_contraction->edge;
-    if (!edge_contraction->valid || WillDegenerate(edge01)) continue;
-
-    // begin processing the next edge contraction
-    const auto& v_new = edge_contraction->vertex;
-    v_new->set_id(static_cast<std::uint32_t>(next_vertex_id++));
-    quadrics.emplace(v_new->id(), edge_contraction->quadric);
-
-    // invalidate entries in the priority queue that will be removed during the edge contraction
-    for (const auto& vi : {edge01->flip()->vertex(), edge01->vertex()}) {
-      auto edgeji = vi->edge();
-      do {
-        const auto min_edge = GetMinEdge(edgeji);
-        if (const auto iterator = valid_edges.find(hash_value(*min_edge)); iterator != valid_edges.cend()) {
-          iterator->second->valid = false;
-          valid_edges.erase(iterator);
-        }
-        edgeji = edgeji->next()->flip();
-      } while (edgeji != vi->edge());
-    }
-
-    // remove the edge from the mesh and attach incident edges to the new vertex
-    half_edge_mesh.Contract(*edge01, v_new);
-
-    // add new edge contraction candidates for edges affected by the edge contraction
-    std::unordered_map<std::size_t, std::shared_ptr<HalfEdge>> visited_edges;
-    const auto& vi = v_new;
-    auto edgeji = vi->edge();
-    do {
-      const auto vj = edgeji->flip()->vertex();
-      auto edgekj = vj->edge();
-      do {
-        const auto min_edge = GetMinEdge(edgekj);
-        const auto min_edge_key = hash_value(*min_edge);
-        if (!visited_edges.contains(min_edge_key)) {
-          if (const auto iterator = valid_edges.find(min_edge_key); iterator != valid_edges.cend()) {
-            // invalidate existing edge contraction candidate in the priority queue
-            iterator->second->valid = false;
-          }
-          auto new_edge_contraction = CreateEdgeContraction(min_edge, quadrics);
-          valid_edges[min_edge_key] = new_edge_contraction;
-          edge_contractions.push(std::move(new_edge_contraction));
-          visited_edges.emplace(min_edge_key, min_edge);
-        }
-        edgekj = edgekj->next()->flip();
-      } while (edgekj != vj->edge());
-      edgeji = edgeji->next()->flip();
-    } while (edgeji != vi->edge());
-  }
+  auto [vertices, indices] =
+      options.attributes == VertexAttributes::kPosition
+          ? SimplifyPositions(mesh, target_face_count, options)
+          : SimplifyWithAttributes(mesh.vertices(), mesh.indices(), options.attributes, target_face_count);
 
   std::println(std::clog,
                "Mesh simplified from {} to {} triangles in {} seconds",
                initial_face_count,
-               half_edge_mesh.faces().size(),
+               indices.size() / 3,
                std::chrono::duration<float>{std::chrono::high_resolution_clock::now() - start_time}.count());
 
-  return half_edge_mesh.ToMesh(device);
+  // optimize the simplified mesh before it is constructed so its buffers are only uploaded once
+  if (options.optimize) Optimize(vertices, indices);
+  return Mesh{device, std::move(vertices), std::move(indices), mesh.transform()};
 }
 
 }  // namespace gfx
@@ -1,21 +1,82 @@
 #ifndef GEOMETRY_MESH_SIMPLIFIER_H_
 #define GEOMETRY_MESH_SIMPLIFIER_H_
 
+#include <cstdint>
+
+#include "geometry/vertex_attributes.h"
+#include "geometry/vertex_placement.h"
+
 namespace gfx {
 class Device;
 class Mesh;
 
 namespace mesh {
 
+/** \brief Options used to configure mesh simplification. */
+struct SimplifyOptions {
+  /**
+   * \brief The number of spatial regions to simplify concurrently.
+   * \details Each region is simplified on its own thread while vertices shared with other regions remain fixed after
+   *          which the seams between regions are simplified sequentially. A value of 0 uses one region per hardware
+   *          thread and a value of 1 simplifies the entire mesh sequentially.
+   */
+  std::uint32_t partition_count = 1;
+
+  /**
+   * \brief Determines if vertices are clustered before edge contraction for meshes far larger than the target size.
+   * \details Vertex clustering merges vertices in a uniform grid which coarsely reduces the mesh in a single pass at a
+   *          fraction of the cost of edge contraction. The clustered mesh is then simplified to the target face count
+   *          with edge contraction which determines the quality of the final result.
+   */
+  bool cluster_vertices = false;
+
+  /**
+   * \brief Determines if edges are contracted in rounds of independent edge contractions performed concurrently.
+   * \details Each round contracts a set of low cost edges whose neighborhoods do not overlap on all hardware threads
+   *          which parallelizes the entire mesh without fixed region boundaries or seams. When enabled,
+   *          \ref partition_count is ignored.
+   */
+  bool contract_independent_edges = false;
+
+  /**
+   * \brief The vertex attributes included in the error metric.
+   * \details Including normals or texture coordinates places new vertex attributes at the minimum of an attribute
+   *          quadric at the cost of a larger quadric per vertex. Vertices split at normal or texture seams are welded
+   *          by position and keep separate attributes on either side of the seam which is constrained to remain in
+   *          place. The welded mesh must be a closed manifold. Meshes simplified with vertex attributes are simplified
+   *          sequentially without vertex clustering.
+   */
+  VertexAttributes attributes = VertexAttributes::kPosition;
+
+  /**
+   * \brief Determines where the vertex created by each edge contraction is placed.
+   * \details VertexPlacement::kEndpoint and VertexPlacement::kMidpoint avoid solving for the optimal position of each
+   *          edge which is suited to fast previews and first-pass reductions. This option only applies to meshes
+   *          simplified by vertex position.
+   */
+  VertexPlacement placement = VertexPlacement::kOptimal;
+
+  /**
+   * \brief Determines if the simplified mesh is reordered for rendering.
+   * \details Edge contraction emits triangles and vertices in the order they are stored in the half-edge mesh which
+   *          has little locality. Optimization reorders triangles for the post-transform vertex cache and overdraw and
+   *          reorders vertices for vertex fetch at the cost of an additional pass over the simplified mesh.
+   */
+  bool optimize = false;
+};
+
 /**
  * \brief Reduces the number of triangles in a mesh.
  * \param device The graphics device used to load the reconstructed mesh data into GPU memory.
  * \param mesh The mesh to simplify.
  * \param rate The percentage of triangles to be removed (e.g., .95 indicates 95% of triangles should be removed).
+ * \param options Options used to configure mesh simplification.
  * \return A triangle mesh with \p rate percent of triangles removed from \p mesh.
+ * \throw std::invalid_argument Thrown if \p rate is not in the range [0, 1] or \p mesh is simplified with vertex
+ *                              attributes and is not a closed manifold after welding vertices by position.
  * \see docs/surface_simplification for a description of this mesh simplification algorithm.
  */
-Mesh Simplify(const Device& device, const Mesh& mesh, const float rate);
+Mesh Simplify(const Device& device, const Mesh& mesh, const float rate, const SimplifyOptions& options = {});
 
 }  // namespace mesh
 }  // namespace gfx
@@ -0,0 +1,519 @@
+#include "geometry/out_of_core_simplifier.h"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <chrono>
+#include <cstdint>
+#include <format>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <print>
+#include <random>
+#include <span>
+#include <stdexcept>
+#include <system_error>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include "geometry/edge_contraction.h"
+#include "geometry/half_edge_mesh.h"
+#include "graphics/mapped_file.h"
+#include "graphics/obj_loader.h"
+
+namespace {
+
+/** \brief The estimated peak number of bytes used per face when simplifying a mesh in memory. */
+constexpr std::size_t kBytesPerFace = 512;
+
+/** \brief The per-axis resolution of the grid used to group vertices into chunks. */
+constexpr std::uint32_t kGridResolution = 64;
+static_assert(std::has_single_bit(kGridResolution));
+
+/** \brief The number of bits used to represent a grid coordinate along each axis. */
+constexpr auto kGridBitCount = static_cast<std::uint32_t>(std::countr_zero(kGridResolution));
+
+/** \brief The maximum number of chunked simplification passes before the remaining mesh is written as is. */
+constexpr std::uint32_t kMaxPassCount = 4;
+
+/** \brief The maximum number of faces buffered for each chunk before they are appended to the chunk file. */
+constexpr std::size_t kMaxChunkBufferFaceCount = 16384;
+
+// positions are stored as float arrays rather than glm::vec3 to avoid depending on the alignment of glm types
+using Position = std::array<float, 3>;
+using Triangle = std::array<std::uint32_t, 3>;
+
+/** \brief A triangle mesh stored in binary files of contiguous vertex positions and triangle indices. */
+struct StreamedMesh {
+  std::filesystem::path positions_filepath;
+  std::filesystem::path faces_filepath;
+  std::size_t vertex_count = 0;
+  std::size_t face_count = 0;
+  glm::vec3 min{std::numeric_limits<float>::max()};
+  glm::vec3 max{std::numeric_limits<float>::lowest()};
+};
+
+/** \brief A face written to a chunk file. */
+struct ChunkFace {
+  Triangle vertices;
+  std::uint32_t is_owned;  // indicates if the face is owned by the chunk or is a halo face from an adjacent chunk
+};
+
+/** \brief A directory of intermediate files which is removed when it goes out of scope. */
+class TemporaryDirectory {
+public:
+  explicit TemporaryDirectory(const std::filesystem::path& parent_directory)
+      : path_{(parent_directory.empty() ? std::filesystem::temp_directory_path() : parent_directory)
+              / std::format("mesh_simplification_{:08x}", std::random_device{}())} {
+    std::filesystem::create_directories(path_);
+  }
+
+  TemporaryDirectory(const TemporaryDirectory&) = delete;
+  TemporaryDirectory& operator=(const TemporaryDirectory&) = delete;
+
+  ~TemporaryDirectory() noexcept {
+    std::error_code error_code;
+    std::filesystem::remove_all(path_, error_code);
+  }
+
+  [[nodiscard]] const std::filesystem::path& path() const noexcept { return path_; }
+
+private:
+  std::filesystem::path path_;
+};
+
+std::ofstream OpenBinaryFile(const std::filesystem::path& filepath, const std::ios::openmode mode = std::ios::trunc) {
+  std::ofstream ofstream{filepath, std::ios::binary | std::ios::out | mode};
+  if (!ofstream) {
+    throw std::runtime_error{std::format("Unable to open {}", filepath.string())};
+  }
+  return ofstream;
+}
+
+template <typename T>
+void Write(std::ofstream& ofstream, const std::span<const T> data) {
+  ofstream.write(reinterpret_cast<const char*>(data.data()),  // NOLINT(*-reinterpret-cast)
+                 static_cast<std::streamsize>(data.size_bytes()));
+}
+
+/** \brief Appends vertex positions and faces to a streamed mesh. */
+class StreamedMeshWriter {
+public:
+  StreamedMeshWriter(const std::filesystem::path& directory, const std::string_view name)
+      : mesh_{.positions_filepath = directory / std::format("{}_positions.bin", name),
+              .faces_filepath = directory / std::format("{}_faces.bin", name)},
+        positions_ofstream_{OpenBinaryFile(mesh_.positions_filepath)},
+        faces_ofstream_{OpenBinaryFile(mesh_.faces_filepath)} {}
+
+  std::uint32_t WritePosition(const glm::vec3& position) {
+    const Position data{position.x, position.y, position.z};
+    Write(positions_ofstream_, std::span{&data, 1});
+    mesh_.min = glm::min(mesh_.min, position);
+    mesh_.max = glm::max(mesh_.max, position);
+    return static_cast<std::uint32_t>(mesh_.vertex_count++);
+  }
+
+  void WriteFace(const Triangle& face) {
+    Write(faces_ofstream_, std::span{&face, 1});
+    ++mesh_.face_count;
+  }
+
+  StreamedMesh Close() && {
+    positions_ofstream_.close();
+    faces_ofstream_.close();
+    if (!positions_ofstream_ || !faces_ofstream_) {
+      throw std::runtime_error{std::format("Unable to write {}", mesh_.positions_filepath.parent_path().string())};
+    }
+    return std::move(mesh_);
+  }
+
+private:
+  StreamedMesh mesh_;
+  std::ofstream positions_ofstream_;
+  std::ofstream faces_ofstream_;
+};
+
+/** \brief Maps vertex positions to chunks of spatially adjacent grid cells. */
+class ChunkGrid {
+public:
+  /**
+   * \brief Initializes a chunk grid.
+   * \param mesh The mesh to partition into chunks.
+   * \param positions The mesh vertex positions.
+   * \param faces The mesh faces.
+   * \param max_chunk_face_count The maximum number of faces owned by a chunk unless a single grid cell exceeds it.
+   * \param cell_offset The fraction of a grid cell to offset each cell by which shifts chunk borders between passes.
+   */
+  ChunkGrid(const StreamedMesh& mesh,
+            const std::span<const Position> positions,
+            const std::span<const Triangle> faces,
+            const std::size_t max_chunk_face_count,
+            const float cell_offset)
+      : min_{mesh.min},
+        cell_scale_{static_cast<float>(kGridResolution - 1) / glm::max(mesh.max - mesh.min, glm::vec3{1.0e-6f})},
+        cell_offset_{cell_offset},
+        cell_chunks_(std::size_t{1} << (3u * kGridBitCount), 0) {
+    // count faces by the grid cell of their first vertex which determines the chunk that owns the face
+    std::vector<std::size_t> cell_face_counts(cell_chunks_.size(), 0);
+    for (const auto& face : faces) {
+      ++cell_face_counts[GetCell(positions[face[0]])];
+    }
+
+    // group cells into chunks along a z-order curve which keeps cells in each chunk spatially coherent
+    std::size_t chunk_face_count = 0;
+    for (std::size_t cell = 0; cell < cell_chunks_.size(); ++cell) {
+      if (chunk_face_count > 0 && chunk_face_count + cell_face_counts[cell] > max_chunk_face_count) {
+        ++chunk_count_;
+        chunk_face_count = 0;
+      }
+      chunk_face_count += cell_face_counts[cell];
+      cell_chunks_[cell] = chunk_count_;
+    }
+    ++chunk_count_;
+  }
+
+  [[nodiscard]] std::uint32_t chunk_count() const noexcept { return chunk_count_; }
+
+  [[nodiscard]] std::uint32_t GetChunk(const Position& position) const noexcept {
+    return cell_chunks_[GetCell(position)];
+  }
+
+private:
+  [[nodiscard]] std::size_t GetCell(const Position& position) const noexcept {
+    const auto cell = (glm::vec3{position[0], position[1], position[2]} - min_) * cell_scale_ + cell_offset_;
+    const auto max_cell = static_cast<float>(kGridResolution - 1);
+    return Interleave(static_cast<std::uint32_t>(std::clamp(cell.x, 0.0f, max_cell)))
+           | Interleave(static_cast<std::uint32_t>(std::clamp(cell.y, 0.0f, max_cell))) << 1u
+           | Interleave(static_cast<std::uint32_t>(std::clamp(cell.z, 0.0f, max_cell))) << 2u;
+  }
+
+  /** \brief Spreads the bits of a grid coordinate so that they can be interleaved into a z-order curve index. */
+  static std::size_t Interleave(const std::uint32_t coordinate) noexcept {
+    std::size_t bits = 0;
+    for (auto bit = 0u; bit < kGridBitCount; ++bit) {
+      bits |= static_cast<std::size_t>((coordinate >> bit) & 1u) << (3u * bit);
+    }
+    return bits;
+  }
+
+  glm::vec3 min_;
+  glm::vec3 cell_scale_;
+  float cell_offset_;
+  std::vector<std::uint32_t> cell_chunks_;
+  std::uint32_t chunk_count_ = 0;
+};
+
+/** \brief Buffers faces assigned to chunks and appends them to a file for each chunk. */
+class ChunkWriter {
+public:
+  ChunkWriter(const std::filesystem::path& directory, const std::uint32_t chunk_count, const std::size_t memory_budget)
+      : directory_{directory},
+        buffers_(chunk_count),
+        buffer_face_count_{std::clamp<std::size_t>(memory_budget / (4 * sizeof(ChunkFace) * chunk_count),
+                                                   1,
+                                                   kMaxChunkBufferFaceCount)} {
+    for (std::uint32_t chunk = 0; chunk < chunk_count; ++chunk) {
+      OpenBinaryFile(GetFilepath(chunk));
+    }
+  }
+
+  [[nodiscard]] std::filesystem::path GetFilepath(const std::uint32_t chunk) const {
+    return directory_ / std::format("chunk_{}.bin", chunk);
+  }
+
+  void Write(const std::uint32_t chunk, const ChunkFace& chunk_face) {
+    auto& buffer = buffers_[chunk];
+    buffer.push_back(chunk_face);
+    if (buffer.size() == buffer_face_count_) Flush(chunk);
+  }
+
+  void Flush() {
+    for (std::uint32_t chunk = 0; chunk < buffers_.size(); ++chunk) Flush(chunk);
+  }
+
+private:
+  void Flush(const std::uint32_t chunk) {
+    auto& buffer = buffers_[chunk];
+    if (buffer.empty()) return;
+
+    auto ofstream = OpenBinaryFile(GetFilepath(chunk), std::ios::app);
+    ::Write(ofstream, std::span<const ChunkFace>{buffer});
+    if (!ofstream) {
+      throw std::runtime_error{std::format("Unable to write {}", GetFilepath(chunk).string())};
+    }
+    buffer.clear();
+  }
+
+  std::filesystem::path directory_;
+  std::vector<std::vector<ChunkFace>> buffers_;
+  std::size_t buffer_face_count_;
+};
+
+StreamedMesh ReadObj(const std::filesystem::path& filepath, const std::filesystem::path& directory) {
+  StreamedMeshWriter streamed_mesh_writer{directory, "input"};
+  gfx::obj_loader::ReadPositions(
+      filepath,
+      [&](const glm::vec3& position) { streamed_mesh_writer.WritePosition(position); },
+      [&](const Triangle& face) { streamed_mesh_writer.WriteFace(face); });
+
+  auto mesh = std::move(streamed_mesh_writer).Close();
+  const gfx::MappedFile faces_file{mesh.faces_filepath};
+  for (const auto& face : faces_file.data_as<Triangle>()) {
+    if (std::ranges::any_of(face, [&](const auto v) { return v >= mesh.vertex_count; })) {
+      throw std::invalid_argument{std::format("Invalid position index in {}", filepath.string())};
+    }
+  }
+  return mesh;
+}
+
+/**
+ * \brief Simplifies a streamed mesh one chunk at a time.
+ * \param mesh The mesh to simplify.
+ * \param rate The percentage of faces not incident to a chunk border to remove.
+ * \param memory_budget The approximate maximum number of bytes of mesh data to keep in memory at once.
+ * \param pass The index of the current pass which determines the offset of chunk borders.
+ * \param directory The directory to write intermediate files to.
+ * \return The simplified mesh.
+ */
+StreamedMesh SimplifyChunks(const StreamedMesh& mesh,
+                            const float rate,
+                            const std::size_t memory_budget,
+                            const std::uint32_t pass,
+                            const std::filesystem::path& directory) {
+  const gfx::MappedFile positions_file{mesh.positions_filepath};
+  const auto positions = positions_file.data_as<Position>();
+
+  // bucket faces into a file for each chunk where faces that cross a chunk border are also written to each adjacent
+  // chunk as halo faces so that every vertex in a chunk has a closed one-ring
+  const ChunkGrid chunk_grid = [&] {
+    const gfx::MappedFile faces_file{mesh.faces_filepath};
+    return ChunkGrid{mesh,
+                     positions,
+                     faces_file.data_as<Triangle>(),
+                     std::max<std::size_t>(memory_budget / kBytesPerFace, 1),
+                     pass % 2 == 0 ? 0.0f : 0.5f};
+  }();
+  const auto chunk_count = chunk_grid.chunk_count();
+  ChunkWriter chunk_writer{directory, chunk_count, memory_budget};
+  {
+    const gfx::MappedFile faces_file{mesh.faces_filepath};
+    for (const auto& face : faces_file.data_as<Triangle>()) {
+      const std::array chunks{chunk_grid.GetChunk(positions[face[0]]),
+                              chunk_grid.GetChunk(positions[face[1]]),
+                              chunk_grid.GetChunk(positions[face[2]])};
+      chunk_writer.Write(chunks[0], ChunkFace{.vertices = face, .is_owned = 1});
+      if (chunks[1] != chunks[0]) chunk_writer.Write(chunks[1], ChunkFace{.vertices = face, .is_owned = 0});
+      if (chunks[2] != chunks[0] && chunks[2] != chunks[1]) {
+        chunk_writer.Write(chunks[2], ChunkFace{.vertices = face, .is_owned = 0});
+      }
+    }
+    chunk_writer.Flush();
+  }
+
+  StreamedMeshWriter streamed_mesh_writer{directory, std::format("pass_{}", pass)};
+
+  // the output IDs of vertices shared across chunk borders are remapped by input vertex ID in a file which the
+  // operating system can page out so that memory use does not grow with the number of chunks processed so far
+  gfx::MappedFile shared_output_ids_file{directory / "shared_output_ids.bin",
+                                        sizeof(std::uint32_t) * mesh.vertex_count};
+  const auto shared_output_ids = shared_output_ids_file.writable_data_as<std::uint32_t>();
+
+  for (std::uint32_t chunk = 0; chunk < chunk_count; ++chunk) {
+    const auto chunk_filepath = chunk_writer.GetFilepath(chunk);
+    gfx::MeshRegion region;
+    std::vector<std::uint32_t> vertex_ids;
+    {
+      const gfx::MappedFile chunk_file{chunk_filepath};
+      const auto chunk_faces = chunk_file.data_as<ChunkFace>();
+      const auto is_in_chunk = [&](const std::uint32_t v) { return chunk_grid.GetChunk(positions[v]) == chunk; };
+      const auto is_crossing = [&](const ChunkFace& chunk_face) {
+        return !std::ranges::all_of(chunk_face.vertices, is_in_chunk);
+      };
+
+      // vertices in the chunk have closed one-rings and are assigned local IDs before vertices in adjacent chunks
+      std::unordered_map<std::uint32_t, std::uint32_t> local_ids;
+      for (const auto in_chunk : {true, false}) {
+        for (const auto& chunk_face : chunk_faces) {
+          for (const auto v : chunk_face.vertices) {
+            if (is_in_chunk(v) != in_chunk) continue;
+            if (local_ids.try_emplace(v, static_cast<std::uint32_t>(vertex_ids.size())).second) {
+              const auto& position = positions[v];
+              region.positions.emplace_back(position[0], position[1], position[2]);
+              vertex_ids.push_back(v);
+            }
+          }
+        }
+        if (in_chunk) region.closed_vertex_count = static_cast<std::uint32_t>(vertex_ids.size());
+      }
+
+      // vertices of faces that cross a chunk border are locked so chunks can be stitched together at their borders
+      region.locked_vertices.resize(vertex_ids.size(), 0);
+      for (const auto is_owned : {1u, 0u}) {
+        for (const auto& chunk_face : chunk_faces) {
+          if (chunk_face.is_owned != is_owned) continue;
+          const auto is_locked = is_crossing(chunk_face);
+          for (const auto v : chunk_face.vertices) {
+            const auto local_id = local_ids.at(v);
+            region.indices.push_back(local_id);
+            if (is_locked) region.locked_vertices[local_id] = 1;
+          }
+        }
+        if (is_owned == 1) region.face_count = region.indices.size() / 3;
+      }
+    }
+    std::filesystem::remove(chunk_filepath);
+
+    const auto simplified_region = gfx::SimplifyRegion(region, rate);
+
+    // locked vertices are shared with adjacent chunks and written once using the ID of the vertex in the input mesh
+    // where shared output IDs are offset by one since the remap file is zero-initialized
+    std::vector<std::uint32_t> output_ids(simplified_region.positions.size());
+    for (std::size_t i = 0; i < simplified_region.positions.size(); ++i) {
+      if (const auto local_id = simplified_region.locked_vertex_ids[i]; local_id != gfx::kInvalidIndex) {
+        auto& shared_output_id = shared_output_ids[vertex_ids[local_id]];
+        if (shared_output_id == 0) {
+          shared_output_id = streamed_mesh_writer.WritePosition(simplified_region.positions[i]) + 1;
+        }
+        output_ids[i] = shared_output_id - 1;
+      } else {
+        output_ids[i] = streamed_mesh_writer.WritePosition(simplified_region.positions[i]);
+      }
+    }
+    for (std::size_t i = 0; i < simplified_region.indices.size(); i += 3) {
+      streamed_mesh_writer.WriteFace(Triangle{output_ids[simplified_region.indices[i]],
+                                              output_ids[simplified_region.indices[i + 1]],
+                                              output_ids[simplified_region.indices[i + 2]]});
+    }
+  }
+
+  return std::move(streamed_mesh_writer).Close();
+}
+
+void WriteObj(const std::filesystem::path& filepath,
+              const std::span<const Position> positions,
+              const std::span<const Triangle> faces) {
+  std::ofstream ofstream{filepath};
+  if (!ofstream) {
+    throw std::runtime_error{std::format("Unable to open {}", filepath.string())};
+  }
+  for (const auto& position : positions) {
+    std::println(ofstream, "v {} {} {}", position[0], position[1], position[2]);
+  }
+  for (const auto& face : faces) {
+    std::println(ofstream, "f {} {} {}", face[0] + 1, face[1] + 1, face[2] + 1);
+  }
+  if (!ofstream.flush()) {
+    throw std::runtime_error{std::format("Unable to write {}", filepath.string())};
+  }
+}
+
+/**
+ * \brief Simplifies a streamed mesh in memory and writes the result to an .obj file.
+ * \return The number of faces in the simplified mesh.
+ */
+std::size_t SimplifyInMemory(const StreamedMesh& mesh,
+                             const float target_face_count,
+                             const std::filesystem::path& filepath) {
+  std::vector<glm::vec3> positions;
+  std::vector<std::uint32_t> indices;
+  indices.reserve(3 * mesh.face_count);
+  {
+    // vertices not referenced by any face are removed since they do not have an error quadric
+    const gfx::MappedFile positions_file{mesh.positions_filepath};
+    const gfx::MappedFile faces_file{mesh.faces_filepath};
+    const auto mesh_positions = positions_file.data_as<Position>();
+    std::vector<std::uint32_t> index_map(mesh_positions.size(), gfx::kInvalidIndex);
+
+    for (const auto& face : faces_file.data_as<Triangle>()) {
+      for (const auto v : face) {
+        if (index_map[v] == gfx::kInvalidIndex) {
+          index_map[v] = static_cast<std::uint32_t>(positions.size());
+          positions.emplace_back(mesh_positions[v][0], mesh_positions[v][1], mesh_positions[v][2]);
+        }
+        indices.push_back(index_map[v]);
+      }
+    }
+  }
+
+  gfx::HalfEdgeMesh half_edge_mesh{positions, indices};
+  std::vector<glm::vec3>{}.swap(positions);
+  std::vector<std::uint32_t>{}.swap(indices);
+
+  auto quadrics = gfx::CreateErrorQuadrics(half_edge_mesh, half_edge_mesh.vertices().slot_count());
+  gfx::ContractEdges(half_edge_mesh, quadrics, {}, target_face_count);
+
+  const auto& vertices = half_edge_mesh.vertices();
+  const auto& faces = half_edge_mesh.faces();
+  std::vector<Position> output_positions;
+  output_positions.reserve(vertices.size());
+  std::vector<std::uint32_t> index_map(vertices.slot_count(), gfx::kInvalidIndex);
+
+  for (const auto id : vertices.indices()) {
+    const auto& position = vertices[id].position();
+    index_map[id] = static_cast<std::uint32_t>(output_positions.size());
+    output_positions.push_back(Position{position.x, position.y, position.z});
+  }
+
+  std::vector<Triangle> output_faces;
+  output_faces.reserve(faces.size());
+  for (const auto id : faces.indices()) {
+    const auto& face = faces[id];
+    output_faces.push_back(Triangle{index_map[face.v0()], index_map[face.v1()], index_map[face.v2()]});
+  }
+
+  WriteObj(filepath, output_positions, output_faces);
+  return output_faces.size();
+}
+
+}  // namespace
+
+namespace gfx {
+
+void mesh::SimplifyOutOfCore(const std::filesystem::path& input_filepath,
+                             const std::filesystem::path& output_filepath,
+                             const float rate,
+                             const OutOfCoreOptions& options) {
+  if (rate < 0.0f || rate > 1.0f) {
+    throw std::invalid_argument{std::format("Invalid mesh simplification rate: {}", rate)};
+  }
+
+  const auto start_time = std::chrono::high_resolution_clock::now();
+  const TemporaryDirectory temporary_directory{options.temporary_directory};
+
+  auto mesh = ReadObj(input_filepath, temporary_directory.path());
+  const auto initial_face_count = mesh.face_count;
+  const auto target_face_count = (1.0f - rate) * static_cast<float>(initial_face_count);
+  const auto fits_in_memory = [&] { return mesh.face_count <= options.memory_budget / kBytesPerFace; };
+
+  // simplify chunks until the mesh fits in memory where the rate of each pass accounts for faces already removed
+  for (std::uint32_t pass = 0;
+       pass < kMaxPassCount && !fits_in_memory() && static_cast<float>(mesh.face_count) >= target_face_count;
+       ++pass) {
+    const auto pass_rate = 1.0f - target_face_count / static_cast<float>(mesh.face_count);
+    auto simplified_mesh = SimplifyChunks(mesh, pass_rate, options.memory_budget, pass, temporary_directory.path());
+    std::filesystem::remove(mesh.positions_filepath);
+    std::filesystem::remove(mesh.faces_filepath);
+    mesh = std::move(simplified_mesh);
+  }
+
+  // the final pass in memory removes any remaining faces along chunk borders
+  const auto final_face_count = [&] {
+    if (fits_in_memory()) return SimplifyInMemory(mesh, target_face_count, output_filepath);
+    const MappedFile positions_file{mesh.positions_filepath};
+    const MappedFile faces_file{mesh.faces_filepath};
+    WriteObj(output_filepath, positions_file.data_as<Position>(), faces_file.data_as<Triangle>());
+    return mesh.face_count;
+  }();
+
+  std::println(std::clog,
+               "Mesh simplified from {} to {} triangles in {} seconds",
+               initial_face_count,
+               final_face_count,
+               std::chrono::duration<float>{std::chrono::high_resolution_clock::now() - start_time}.count());
+}
+
+}  // namespace gfx
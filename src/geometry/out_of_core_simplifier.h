@@ -0,0 +1,44 @@
+#ifndef GEOMETRY_OUT_OF_CORE_SIMPLIFIER_H_
+#define GEOMETRY_OUT_OF_CORE_SIMPLIFIER_H_
+
+#include <cstddef>
+#include <filesystem>
+
+namespace gfx {
+namespace mesh {
+
+/** \brief Options used to configure out-of-core mesh simplification. */
+struct OutOfCoreOptions {
+  /**
+   * \brief The approximate maximum number of bytes of mesh data to keep in memory at once.
+   * \details Meshes larger than this budget are split into spatial chunks which are simplified one at a time.
+   */
+  std::size_t memory_budget = std::size_t{1} << 30u;
+
+  /** \brief The directory to store intermediate files in or the system temporary directory if empty. */
+  std::filesystem::path temporary_directory;
+};
+
+/**
+ * \brief Reduces the number of triangles in an .obj file without loading the entire mesh into memory.
+ * \details The input mesh is streamed into spatial chunks which are simplified independently while vertices on chunk
+ *          borders remain locked. Chunk borders are shifted between passes so that previously locked vertices can be
+ *          simplified and once the reduced mesh fits within the memory budget, it is simplified in memory to the
+ *          target face count. If the mesh still exceeds the memory budget after a bounded number of passes, the
+ *          partially simplified mesh is written instead. Only vertex positions are preserved in the simplified mesh.
+ * \param input_filepath The path of the .obj file containing the mesh to simplify.
+ * \param output_filepath The path of the .obj file to write the simplified mesh to.
+ * \param rate The percentage of triangles to be removed (e.g., .95 indicates 95% of triangles should be removed).
+ * \param options Options used to configure out-of-core mesh simplification.
+ * \throw std::invalid_argument Thrown if \p rate is not in the range [0, 1] or the input mesh is invalid.
+ * \throw std::runtime_error Thrown if a file cannot be read or written.
+ */
+void SimplifyOutOfCore(const std::filesystem::path& input_filepath,
+                       const std::filesystem::path& output_filepath,
+                       const float rate,
+                       const OutOfCoreOptions& options = {});
+
+}  // namespace mesh
+}  // namespace gfx
+
+#endif  // GEOMETRY_OUT_OF_CORE_SIMPLIFIER_H_
@@ -0,0 +1,179 @@
+#include "geometry/progressive_mesh.h"
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstdint>
+#include <limits>
+#include <ranges>
+#include <span>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include "geometry/arena.h"
+#include "geometry/edge_contraction.h"
+#include "geometry/half_edge_mesh.h"
+#include "graphics/device.h"
+
+namespace {
+
+glm::vec3 Normalize(const glm::vec3& normal) {
+  // meshes without normals have zero normals which cannot be normalized
+  const auto length = glm::length(normal);
+  return length > 0.0f ? normal / length : normal;
+}
+
+gfx::Mesh::Vertex Mix(const gfx::Mesh::Vertex& vertex0, const gfx::Mesh::Vertex& vertex1, const float t) {
+  return gfx::Mesh::Vertex{.position = glm::mix(vertex0.position, vertex1.position, t),
+                           .texture_coordinates = glm::mix(vertex0.texture_coordinates, vertex1.texture_coordinates, t),
+                           .normal = Normalize(glm::mix(vertex0.normal, vertex1.normal, t))};
+}
+
+}  // namespace
+
+namespace gfx {
+
+ProgressiveMesh::ProgressiveMesh(const Mesh& mesh, const std::size_t min_face_count)
+    : vertices_{mesh.vertices()}, transform_{mesh.transform()} {
+  HalfEdgeMesh half_edge_mesh{mesh};
+  auto quadrics = CreateErrorQuadrics(half_edge_mesh, half_edge_mesh.vertices().slot_count());
+  auto edge_contractions = CreateEdgeContractions(half_edge_mesh, quadrics, {});
+  std::vector<EdgeContractionRecord> records;
+  ContractEdges(half_edge_mesh,
+                quadrics,
+                edge_contractions,
+                {},
+                VertexPlacement::kOptimal,
+                static_cast<float>(min_face_count) + 1.0f,  // edge contraction stops below the target face count
+                std::numeric_limits<float>::infinity(),
+                &records);
+
+  // vertices created by edge contractions average the attributes of the vertices they replace
+  vertices_.reserve(vertices_.size() + records.size());
+  for (const auto& record : records) {
+    assert(record.new_vertex == vertices_.size());
+    const auto vertex0 = vertices_[record.vertices[0]];
+    const auto vertex1 = vertices_[record.vertices[1]];
+    auto& vertex = vertices_.emplace_back(Mix(vertex0, vertex1, 0.5f));
+    vertex.position = record.position;
+  }
+
+  const auto& indices = mesh.indices();
+  const auto face_count = indices.size() / 3;
+  std::vector<std::uint32_t> face_records(face_count, kInvalidIndex);  // the edge contraction that removes each face
+  for (std::uint32_t i = 0; const auto& record : records) {
+    for (const auto face : record.faces) face_records[face] = i;
+    ++i;
+  }
+
+  // replay edge contractions to find the corners of remaining faces that reference each contracted vertex
+  std::vector<std::vector<std::uint32_t>> vertex_corners(vertices_.size());
+  for (std::uint32_t corner = 0; corner < indices.size(); ++corner) {
+    vertex_corners[indices[corner]].push_back(corner);
+  }
+
+  vertex_splits_.reserve(records.size());
+  for (std::uint32_t i = 0; const auto& record : records) {
+    const auto corner_begin = static_cast<std::uint32_t>(split_corners_.size());
+    auto& vertex_split = vertex_splits_.emplace_back(
+        VertexSplit{.vertex = record.new_vertex, .split_vertices = record.vertices, .corner_begin = corner_begin});
+
+    // corners of faces removed by this or an earlier edge contraction are restored by the faces themselves
+    auto& new_vertex_corners = vertex_corners[record.new_vertex];
+    for (const auto vertex : record.vertices) {
+      for (const auto corner : vertex_corners[vertex]) {
+        if (face_records[corner / 3] > i) {
+          split_corners_.push_back(corner);
+          new_vertex_corners.push_back(corner);
+        }
+      }
+      vertex_corners[vertex] = {};
+      if (vertex == record.vertices[0]) vertex_split.corner_mid = static_cast<std::uint32_t>(split_corners_.size());
+    }
+    vertex_split.corner_end = static_cast<std::uint32_t>(split_corners_.size());
+    ++i;
+  }
+
+  // vertex splits are applied in reverse order of edge contraction to refine the mesh
+  std::ranges::reverse(vertex_splits_);
+  vertex_split_ids_.assign(vertices_.size(), kInvalidIndex);
+  for (std::uint32_t i = 0; const auto& vertex_split : vertex_splits_) {
+    for (const auto vertex : vertex_split.split_vertices) vertex_split_ids_[vertex] = i;
+    ++i;
+  }
+
+  // order faces by the vertex split that restores them after faces of the coarsest level of detail
+  std::vector<std::uint32_t> face_positions(face_count);
+  std::uint32_t face_position = 0;
+  for (std::uint32_t face = 0; face < face_count; ++face) {
+    if (face_records[face] == kInvalidIndex) face_positions[face] = face_position++;
+  }
+  base_face_count_ = face_position;
+  for (const auto& record : records | std::views::reverse) {
+    for (const auto face : record.faces) face_positions[face] = face_position++;
+  }
+
+  indices_.resize(indices.size());
+  for (std::uint32_t face = 0; face < face_count; ++face) {
+    std::ranges::copy_n(indices.begin() + 3 * face, 3, indices_.begin() + 3 * face_positions[face]);
+  }
+  for (auto& corner : split_corners_) corner = 3 * face_positions[corner / 3] + corner % 3;
+
+  split_count_ = vertex_splits_.size();
+}
+
+std::size_t ProgressiveMesh::GetSplitCount(const std::size_t face_count) const noexcept {
+  return face_count < base_face_count_ ? 0 : std::min((face_count - base_face_count_) / 2, vertex_splits_.size());
+}
+
+void ProgressiveMesh::SetFaceCount(const std::size_t face_count) {
+  const auto split_count = GetSplitCount(face_count);
+
+  for (; split_count_ < split_count; ++split_count_) {
+    const auto& vertex_split = vertex_splits_[split_count_];
+    for (auto i = vertex_split.corner_begin; i < vertex_split.corner_mid; ++i) {
+      indices_[split_corners_[i]] = vertex_split.split_vertices[0];
+    }
+    for (auto i = vertex_split.corner_mid; i < vertex_split.corner_end; ++i) {
+      indices_[split_corners_[i]] = vertex_split.split_vertices[1];
+    }
+  }
+
+  for (; split_count_ > split_count; --split_count_) {
+    const auto& vertex_split = vertex_splits_[split_count_ - 1];
+    for (auto i = vertex_split.corner_begin; i < vertex_split.corner_end; ++i) {
+      indices_[split_corners_[i]] = vertex_split.vertex;
+    }
+  }
+}
+
+void ProgressiveMesh::Geomorph(const std::size_t coarse_face_count,
+                               const float t,
+                               const std::span<Mesh::Vertex> vertices) const {
+  assert(vertices.size() == vertices_.size());
+  const auto coarse_split_count = std::min(GetSplitCount(coarse_face_count), split_count_);
+
+  // the vertex in the coarse level of detail that replaces the vertex of each vertex split since the coarse level
+  std::vector<std::uint32_t> ancestors;
+  ancestors.reserve(split_count_ - coarse_split_count);
+
+  for (auto i = coarse_split_count; i < split_count_; ++i) {
+    const auto& vertex_split = vertex_splits_[i];
+    const auto vertex_split_id = vertex_split_ids_[vertex_split.vertex];
+    const auto ancestor = vertex_split_id != kInvalidIndex && vertex_split_id >= coarse_split_count
+                              ? ancestors[vertex_split_id - coarse_split_count]
+                              : vertex_split.vertex;
+    ancestors.push_back(ancestor);
+    for (const auto vertex : vertex_split.split_vertices) {
+      vertices[vertex] = Mix(vertices_[ancestor], vertices_[vertex], t);
+    }
+  }
+}
+
+Mesh ProgressiveMesh::ToMesh(const Device& device) const {
+  const auto indices = this->indices();
+  return Mesh{device, vertices_, std::vector(indices.begin(), indices.end()), transform_};
+}
+
+}  // namespace gfx
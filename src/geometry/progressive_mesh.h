@@ -0,0 +1,107 @@
+#ifndef GEOMETRY_PROGRESSIVE_MESH_H_
+#define GEOMETRY_PROGRESSIVE_MESH_H_
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include <glm/mat4x4.hpp>
+
+#include "graphics/mesh.h"
+
+namespace gfx {
+class Device;
+
+/**
+ * \brief A mesh that can be refined or coarsened to any level of detail produced by a single mesh simplification.
+ * \details Each edge contraction performed while simplifying the mesh is stored as a vertex split which records the
+ *          two vertices merged by the contraction and the triangle corners that referenced them. Faces are ordered so
+ *          that faces removed by later contractions precede faces removed by earlier contractions which means the
+ *          faces of each level of detail are a prefix of the index buffer. Changing the level of detail only rewrites
+ *          the corners recorded by the vertex splits between the two levels. The vertex buffer contains every vertex
+ *          of every level of detail and is never modified.
+ */
+class ProgressiveMesh {
+public:
+  /**
+   * \brief Simplifies a mesh and records each edge contraction as a vertex split.
+   * \param mesh The closed manifold mesh to simplify which is the finest level of detail.
+   * \param min_face_count The number of faces to reduce the coarsest level of detail to.
+   */
+  ProgressiveMesh(const Mesh& mesh, std::size_t min_face_count);
+
+  /** \brief Gets the vertices of every level of detail. */
+  [[nodiscard]] const std::vector<Mesh::Vertex>& vertices() const noexcept { return vertices_; }
+
+  /** \brief Gets the vertex indices of each triangle in the current level of detail. */
+  [[nodiscard]] std::span<const std::uint32_t> indices() const noexcept {
+    return std::span{indices_}.first(3 * face_count());
+  }
+
+  /** \brief Gets the number of faces in the current level of detail. */
+  [[nodiscard]] std::size_t face_count() const noexcept { return GetFaceCount(split_count_); }
+
+  /** \brief Gets the number of faces in the coarsest level of detail. */
+  [[nodiscard]] std::size_t min_face_count() const noexcept { return GetFaceCount(0); }
+
+  /** \brief Gets the number of faces in the finest level of detail. */
+  [[nodiscard]] std::size_t max_face_count() const noexcept { return GetFaceCount(vertex_splits_.size()); }
+
+  /**
+   * \brief Refines or coarsens the mesh to a level of detail in time proportional to the number of vertex splits
+   *        between the current and target level of detail.
+   * \param face_count The number of faces to change the level of detail to. The result has the largest face count no
+   *                   greater than \p face_count clamped to the range [min_face_count(), max_face_count()].
+   */
+  void SetFaceCount(std::size_t face_count);
+
+  /**
+   * \brief Interpolates vertices of the current level of detail toward a coarser level of detail.
+   * \details Vertices removed between the current and coarser level of detail are interpolated from the vertex that
+   *          replaces them in the coarser level of detail. At \p t = 0 the current level of detail renders identically
+   *          to the coarser level of detail which allows level of detail changes to be blended over several frames.
+   *          Only vertices removed between the two levels of detail are written.
+   * \param coarse_face_count The face count of the coarser level of detail to interpolate from.
+   * \param t The interpolation parameter where 0 is the coarser and 1 is the current level of detail.
+   * \param vertices The vertices to write interpolated vertices to which is initially a copy of vertices().
+   */
+  void Geomorph(std::size_t coarse_face_count, float t, std::span<Mesh::Vertex> vertices) const;
+
+  /**
+   * \brief Creates a snapshot of the current level of detail.
+   * \param device The graphics device used to load mesh data into GPU memory.
+   * \return An indexed triangle mesh of the current level of detail.
+   */
+  [[nodiscard]] Mesh ToMesh(const Device& device) const;
+
+private:
+  /** \brief Reverses an edge contraction by splitting a vertex back into the two vertices it replaced. */
+  struct VertexSplit {
+    std::uint32_t vertex = 0;
+    std::array<std::uint32_t, 2> split_vertices{};
+    std::uint32_t corner_begin = 0;  // the first split corner which references split_vertices[0]
+    std::uint32_t corner_mid = 0;    // the first split corner which references split_vertices[1]
+    std::uint32_t corner_end = 0;
+  };
+
+  [[nodiscard]] std::size_t GetFaceCount(const std::size_t split_count) const noexcept {
+    return base_face_count_ + 2 * split_count;
+  }
+
+  [[nodiscard]] std::size_t GetSplitCount(std::size_t face_count) const noexcept;
+
+  std::vector<Mesh::Vertex> vertices_;
+  std::vector<std::uint32_t> indices_;
+  std::vector<VertexSplit> vertex_splits_;
+  std::vector<std::uint32_t> split_corners_;      // the index buffer positions rewritten by each vertex split
+  std::vector<std::uint32_t> vertex_split_ids_;  // the vertex split that introduces each vertex or kInvalidIndex
+  std::size_t base_face_count_ = 0;
+  std::size_t split_count_ = 0;
+  glm::mat4 transform_;
+};
+
+}  // namespace gfx
+
+#endif  // GEOMETRY_PROGRESSIVE_MESH_H_
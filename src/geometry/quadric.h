@@ -0,0 +1,354 @@
+#ifndef GEOMETRY_QUADRIC_H_
+#define GEOMETRY_QUADRIC_H_
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <optional>
+#include <span>
+#include <utility>
+
+namespace gfx {
+
+/**
+ * \brief An error quadric over points in an N-dimensional space of vertex positions and attributes.
+ * \details The quadric measures the sum of squared distances from a point to the planes of a set of triangles
+ *          embedded in N dimensions as Q(v) = v^T A v + 2 b^T v + c. The symmetric matrix A is stored as its upper
+ *          triangle which for N = 3 reduces a quadric to 10 coefficients compared to 16 for a 4x4 matrix. Because N is
+ *          a compile-time constant, every loop over the quadric has a fixed trip count which the compiler can fully
+ *          unroll. Errors and minimizers are always computed in double precision to avoid cancellation between the
+ *          large terms of quadrics accumulated over many faces. Coefficients are stored in single precision by default
+ *          which keeps a position quadric at 40 bytes, so sums of stored quadrics performed during edge contraction
+ *          round each coefficient to single precision. Quadrics summed over many faces should instead be accumulated
+ *          with double precision coefficients and converted once the sum is complete.
+ * \tparam N The number of dimensions where the first three dimensions are the vertex position.
+ * \tparam T The floating-point type of the stored coefficients.
+ * \see Garland, M., & Heckbert, P. S. (1998). Simplifying surfaces with color and texture using quadric error metrics.
+ */
+template <std::size_t N, typename T = float>
+class Quadric {
+public:
+  using Vector = std::array<float, N>;
+
+  /** \brief Initializes a quadric with zero error everywhere. */
+  constexpr Quadric() noexcept = default;
+
+  /** \brief Converts a quadric whose coefficients are stored with a different floating-point type. */
+  template <typename U>
+  explicit constexpr Quadric(const Quadric<N, U>& quadric) noexcept {
+    const auto convert = [](const U value) { return static_cast<T>(value); };
+    std::ranges::transform(quadric.a_, a_.begin(), convert);
+    std::ranges::transform(quadric.b_, b_.begin(), convert);
+    c_ = static_cast<T>(quadric.c_);
+  }
+
+  /**
+   * \brief Creates the quadric of a hyperplane.
+   * \param normal The unit normal of the hyperplane.
+   * \param distance The signed distance of the hyperplane from the origin along the negative normal direction such
+   *                 that points on the hyperplane satisfy dot(normal, v) + distance = 0.
+   */
+  static constexpr Quadric FromPlane(const Vector& normal, const float distance) noexcept {
+    // A = n n^T, b = d n, c = d^2
+    Quadric quadric;
+    for (std::size_t i = 0, k = 0; i < N; ++i) {
+      for (std::size_t j = i; j < N; ++j, ++k) quadric.a_[k] = static_cast<T>(normal[i]) * normal[j];
+      quadric.b_[i] = static_cast<T>(distance) * normal[i];
+    }
+    quadric.c_ = static_cast<T>(distance) * distance;
+    return quadric;
+  }
+
+  /**
+   * \brief Initializes the quadric of a triangle.
+   * \param p,q,r The triangle vertices. The quadric is zero if the triangle is degenerate.
+   */
+  Quadric(const Vector& p, const Vector& q, const Vector& r) noexcept {
+    // construct an orthonormal basis {e1, e2} of the triangle plane with Gram-Schmidt orthogonalization
+    auto e1 = Subtract(q, p);
+    const auto e1_length = std::sqrt(Dot(e1, e1));
+    if (e1_length == 0.0f) return;
+    for (auto& value : e1) value /= e1_length;
+
+    auto e2 = Subtract(r, p);
+    const auto r_length = std::sqrt(Dot(e2, e2));
+    const auto r_e1 = Dot(e2, e1);
+    for (std::size_t i = 0; i < N; ++i) e2[i] -= r_e1 * e1[i];
+    const auto e2_length = std::sqrt(Dot(e2, e2));
+    if (e2_length <= kMinRelativeHeight * r_length) return;  // the triangle vertices are collinear
+    for (auto& value : e2) value /= e2_length;
+
+    // A = I - e1 e1^T - e2 e2^T, b = (p.e1) e1 + (p.e2) e2 - p, c = p.p - (p.e1)^2 - (p.e2)^2
+    const auto p_e1 = Dot(p, e1);
+    const auto p_e2 = Dot(p, e2);
+    for (std::size_t i = 0, k = 0; i < N; ++i) {
+      for (std::size_t j = i; j < N; ++j, ++k) {
+        a_[k] = (i == j ? 1.0f : 0.0f) - e1[i] * e1[j] - e2[i] * e2[j];
+      }
+      b_[i] = p_e1 * e1[i] + p_e2 * e2[i] - p[i];
+    }
+    c_ = Dot(p, p) - p_e1 * p_e1 - p_e2 * p_e2;
+  }
+
+  /** \brief Evaluates the quadric error at a point. */
+  [[nodiscard]] float Error(const Vector& v) const noexcept {
+    double error = c_;
+    for (std::size_t i = 0, k = 0; i < N; ++i) {
+      const double vi = v[i];
+      auto row = 0.5 * a_[k++] * vi + b_[i];
+      for (std::size_t j = i + 1; j < N; ++j) row += static_cast<double>(a_[k++]) * v[j];
+      error += 2.0 * row * vi;
+    }
+    // clamp rounding errors since the quadric is positive semi-definite
+    return std::max(static_cast<float>(error), 0.0f);
+  }
+
+  /**
+   * \brief Finds the point that minimizes the quadric error by solving A v = -b.
+   * \return The point of minimum error or \c std::nullopt if A is singular or too ill-conditioned for the point to be
+   *         computed reliably in which case the caller should choose among a fixed set of candidate points instead.
+   */
+  [[nodiscard]] std::optional<Vector> Minimize() const noexcept {
+    // A is positive semi-definite so its largest coefficient lies on the diagonal which provides its scale
+    double scale = 0.0;
+    for (std::size_t i = 0, k = 0; i < N; k += N - i, ++i) scale = std::max(scale, static_cast<double>(a_[k]));
+    if (scale == 0.0) return std::nullopt;
+
+    if constexpr (N == 3) {
+      return Minimize3(scale);
+    } else {
+      return MinimizeN(scale);
+    }
+  }
+
+  /** \brief The maximum number of quadrics minimized together by MinimizeErrors. */
+  static constexpr std::size_t kMaxBatchSize = 16;
+
+  /**
+   * \brief Computes the error at the point that minimizes each quadric in a batch.
+   * \details The coefficients of the batch are transposed into one array per coefficient so that the closed-form solve
+   *          used by Minimize runs over a fixed number of quadrics without data-dependent branches. This lets the
+   *          compiler vectorize the solve across quadrics for the target instruction set without platform-specific
+   *          intrinsics.
+   * \param quadrics The quadrics to minimize of which there are at most kMaxBatchSize.
+   * \param errors The error at the point returned by Minimize for each quadric or NaN if the quadric is singular or
+   *               too ill-conditioned for its minimizer to be computed reliably in which case the caller should choose
+   *               among a fixed set of candidate points instead.
+   */
+  static void MinimizeErrors(const std::span<const Quadric> quadrics, const std::span<float> errors) noexcept
+    requires(N == 3)
+  {
+    assert(quadrics.size() <= kMaxBatchSize && errors.size() == quadrics.size());
+    std::array<std::array<double, kMaxBatchSize>, 10> coefficients{};
+    for (std::size_t i = 0; i < quadrics.size(); ++i) {
+      for (std::size_t k = 0; k < 6; ++k) coefficients[k][i] = quadrics[i].a_[k];
+      for (std::size_t k = 0; k < 3; ++k) coefficients[6 + k][i] = quadrics[i].b_[k];
+      coefficients[9][i] = quadrics[i].c_;
+    }
+
+    // padding quadrics are zero which makes them singular
+    const auto& [a00, a01, a02, a11, a12, a22, b0, b1, b2, c] = coefficients;
+    std::array<float, kMaxBatchSize> min_errors{};
+    for (std::size_t i = 0; i < kMaxBatchSize; ++i) {
+      const auto c00 = a11[i] * a22[i] - a12[i] * a12[i];
+      const auto c01 = a02[i] * a12[i] - a01[i] * a22[i];
+      const auto c02 = a01[i] * a12[i] - a02[i] * a11[i];
+      const auto c11 = a00[i] * a22[i] - a02[i] * a02[i];
+      const auto c12 = a01[i] * a02[i] - a00[i] * a12[i];
+      const auto c22 = a00[i] * a11[i] - a01[i] * a01[i];
+      const auto determinant = a00[i] * c00 + a01[i] * c01 + a02[i] * c02;
+      const auto scale = std::max(std::max(a00[i], a11[i]), a22[i]);
+      const auto is_solvable = std::abs(determinant) > kMinRelativePivot * scale * scale * scale;
+
+      // divide unsolvable quadrics by one instead so their discarded minimizer cannot overflow when rounded to float
+      const auto divisor = is_solvable ? determinant : 1.0;
+
+      // the minimizer is rounded and its error is evaluated in the same order as Minimize and Error so that costs
+      // match those of quadrics minimized individually
+      const double x0 = static_cast<float>(-(c00 * b0[i] + c01 * b1[i] + c02 * b2[i]) / divisor);
+      const double x1 = static_cast<float>(-(c01 * b0[i] + c11 * b1[i] + c12 * b2[i]) / divisor);
+      const double x2 = static_cast<float>(-(c02 * b0[i] + c12 * b1[i] + c22 * b2[i]) / divisor);
+      const auto row0 = 0.5 * a00[i] * x0 + b0[i] + a01[i] * x1 + a02[i] * x2;
+      const auto row1 = 0.5 * a11[i] * x1 + b1[i] + a12[i] * x2;
+      const auto row2 = 0.5 * a22[i] * x2 + b2[i];
+      const auto error = c[i] + 2.0 * row0 * x0 + 2.0 * row1 * x1 + 2.0 * row2 * x2;
+      min_errors[i] =
+          is_solvable ? std::max(static_cast<float>(error), 0.0f) : std::numeric_limits<float>::quiet_NaN();
+    }
+
+    std::ranges::copy(std::span{min_errors}.first(errors.size()), errors.begin());
+  }
+
+  /**
+   * \brief Finds the point on a line segment that minimizes the quadric error.
+   * \details The error along the segment is a quadratic in its interpolation parameter whose minimum is found in closed
+   *          form which provides a well-defined point even when A is singular.
+   * \param p,q The segment endpoints.
+   * \return The interpolation parameter in [0, 1] of the point of minimum error from \p p to \p q.
+   */
+  [[nodiscard]] float MinimizeOnSegment(const Vector& p, const Vector& q) const noexcept {
+    // Q(p + t d) = Q(p) + 2t (A p + b).d + t^2 d^T A d where d = q - p
+    const auto d = Subtract(q, p);
+    const auto a_p = Multiply(p);
+    const auto a_d = Multiply(d);
+    auto slope = 0.0;
+    auto curvature = 0.0;
+    for (std::size_t i = 0; i < N; ++i) {
+      slope += (a_p[i] + b_[i]) * d[i];
+      curvature += a_d[i] * d[i];
+    }
+
+    // the error is linear or constant along the segment if its curvature vanishes
+    if (curvature <= 0.0) return slope < 0.0 ? 1.0f : 0.0f;
+    return static_cast<float>(std::clamp(-slope / curvature, 0.0, 1.0));
+  }
+
+  /**
+   * \brief Finds the point that minimizes the quadric error while its leading coordinates are held fixed.
+   * \details Partitioning a point into fixed coordinates x and free coordinates y reduces the minimization to solving
+   *          A_yy y = -(b_y + A_yx x) which places vertex attributes at their optimum for a given vertex position.
+   * \tparam K The number of leading coordinates to hold fixed.
+   * \param v The point whose leading \p K coordinates are held fixed.
+   * \return The point of minimum error or \c std::nullopt if A_yy is singular or too ill-conditioned for the point to
+   *         be computed reliably.
+   */
+  template <std::size_t K>
+    requires(K < N)
+  [[nodiscard]] std::optional<Vector> Minimize(const Vector& v) const noexcept {
+    Quadric<N - K, T> reduced;
+    for (std::size_t i = K, k = 0; i < N; ++i) {
+      for (auto j = i; j < N; ++j, ++k) reduced.a_[k] = a_[GetIndex(i, j)];
+      auto b = static_cast<double>(b_[i]);
+      for (std::size_t j = 0; j < K; ++j) b += static_cast<double>(a_[GetIndex(j, i)]) * v[j];
+      reduced.b_[i - K] = static_cast<T>(b);
+    }
+
+    const auto y = reduced.Minimize();
+    if (!y.has_value()) return std::nullopt;
+    auto point = v;
+    std::ranges::copy(*y, point.begin() + K);
+    return point;
+  }
+
+  Quadric& operator+=(const Quadric& quadric) noexcept {
+    for (std::size_t i = 0; i < a_.size(); ++i) a_[i] += quadric.a_[i];
+    for (std::size_t i = 0; i < N; ++i) b_[i] += quadric.b_[i];
+    c_ += quadric.c_;
+    return *this;
+  }
+
+  friend Quadric operator+(Quadric lhs, const Quadric& rhs) noexcept { return lhs += rhs; }
+
+private:
+  template <std::size_t, typename>
+  friend class Quadric;
+
+  /** \brief The minimum magnitude of a pivot relative to the scale of A below which A is considered singular. */
+  static constexpr auto kMinRelativePivot = 1.0e-7;
+
+  /** \brief The minimum triangle height relative to its edge length below which a triangle is considered degenerate. */
+  static constexpr auto kMinRelativeHeight = 1.0e-5f;
+
+  /** \brief Solves a 3x3 system in closed form with Cramer's rule which has no data-dependent branches. */
+  [[nodiscard]] std::optional<Vector> Minimize3(const double scale) const noexcept {
+    const double a00 = a_[0];
+    const double a01 = a_[1];
+    const double a02 = a_[2];
+    const double a11 = a_[3];
+    const double a12 = a_[4];
+    const double a22 = a_[5];
+    const double c00 = a11 * a22 - a12 * a12;
+    const double c01 = a02 * a12 - a01 * a22;
+    const double c02 = a01 * a12 - a02 * a11;
+    const double c11 = a00 * a22 - a02 * a02;
+    const double c12 = a01 * a02 - a00 * a12;
+    const double c22 = a00 * a11 - a01 * a01;
+
+    // a determinant near zero relative to the scale of A indicates a solution dominated by rounding error
+    const auto determinant = a00 * c00 + a01 * c01 + a02 * c02;
+    if (std::abs(determinant) <= kMinRelativePivot * scale * scale * scale) return std::nullopt;
+
+    const double b0 = -b_[0];
+    const double b1 = -b_[1];
+    const double b2 = -b_[2];
+    return Vector{static_cast<float>((c00 * b0 + c01 * b1 + c02 * b2) / determinant),
+                  static_cast<float>((c01 * b0 + c11 * b1 + c12 * b2) / determinant),
+                  static_cast<float>((c02 * b0 + c12 * b1 + c22 * b2) / determinant)};
+  }
+
+  /** \brief Solves an NxN system with Gaussian elimination and partial pivoting. */
+  [[nodiscard]] std::optional<Vector> MinimizeN(const double scale) const noexcept {
+    // augmented matrix [A | -b]
+    std::array<std::array<double, N + 1>, N> m{};
+    for (std::size_t i = 0, k = 0; i < N; ++i) {
+      for (std::size_t j = i; j < N; ++j, ++k) m[i][j] = m[j][i] = a_[k];
+      m[i][N] = -b_[i];
+    }
+
+    for (std::size_t column = 0; column < N; ++column) {
+      auto pivot = column;
+      for (auto row = column + 1; row < N; ++row) {
+        if (std::abs(m[row][column]) > std::abs(m[pivot][column])) pivot = row;
+      }
+      if (std::abs(m[pivot][column]) <= kMinRelativePivot * scale) return std::nullopt;
+      std::swap(m[column], m[pivot]);
+
+      for (auto row = column + 1; row < N; ++row) {
+        const auto factor = m[row][column] / m[column][column];
+        for (auto j = column; j <= N; ++j) m[row][j] -= factor * m[column][j];
+      }
+    }
+
+    std::array<double, N> x{};
+    for (auto row = N; row-- > 0;) {
+      auto value = m[row][N];
+      for (auto j = row + 1; j < N; ++j) value -= m[row][j] * x[j];
+      x[row] = value / m[row][row];
+    }
+
+    Vector v{};
+    for (std::size_t i = 0; i < N; ++i) v[i] = static_cast<float>(x[i]);
+    return v;
+  }
+
+  /** \brief Multiplies the symmetric matrix A by a vector in double precision. */
+  [[nodiscard]] std::array<double, N> Multiply(const Vector& v) const noexcept {
+    std::array<double, N> product{};
+    for (std::size_t i = 0, k = 0; i < N; ++i) {
+      product[i] += static_cast<double>(a_[k++]) * v[i];
+      for (auto j = i + 1; j < N; ++j, ++k) {
+        product[i] += static_cast<double>(a_[k]) * v[j];
+        product[j] += static_cast<double>(a_[k]) * v[i];
+      }
+    }
+    return product;
+  }
+
+  /** \brief Gets the index of the coefficient in row \p i and column \p j >= \p i of the upper triangle of A. */
+  static constexpr std::size_t GetIndex(const std::size_t i, const std::size_t j) noexcept {
+    return i * N - i * (i - 1) / 2 + (j - i);
+  }
+
+  static constexpr float Dot(const Vector& lhs, const Vector& rhs) noexcept {
+    auto dot = 0.0f;
+    for (std::size_t i = 0; i < N; ++i) dot += lhs[i] * rhs[i];
+    return dot;
+  }
+
+  static constexpr Vector Subtract(const Vector& lhs, const Vector& rhs) noexcept {
+    Vector difference{};
+    for (std::size_t i = 0; i < N; ++i) difference[i] = lhs[i] - rhs[i];
+    return difference;
+  }
+
+  std::array<T, N*(N + 1) / 2> a_{};
+  std::array<T, N> b_{};
+  T c_{};
+};
+
+}  // namespace gfx
+
+#endif  // GEOMETRY_QUADRIC_H_
@@ -0,0 +1,25 @@
+#include "geometry/simplification_session.h"
+
+#include "geometry/edge_contraction.h"
+#include "graphics/mesh.h"
+
+namespace gfx::mesh {
+
+SimplificationSession::SimplificationSession(const Mesh& mesh)
+    : half_edge_mesh_{mesh},
+      quadrics_{CreateErrorQuadrics(half_edge_mesh_, half_edge_mesh_.vertices().slot_count())},
+      edge_contractions_{CreateEdgeContractions(half_edge_mesh_, quadrics_, {})} {}
+
+void SimplificationSession::SimplifyTo(const std::size_t face_count) {
+  // edge contraction stops once the face count is strictly less than the target
+  ContractEdges(half_edge_mesh_,
+                quadrics_,
+                edge_contractions_,
+                {},
+                VertexPlacement::kOptimal,
+                static_cast<float>(face_count) + 1.0f);
+}
+
+Mesh SimplificationSession::ToMesh(const Device& device) const { return half_edge_mesh_.ToMesh(device); }
+
+}  // namespace gfx::mesh
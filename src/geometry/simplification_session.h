@@ -0,0 +1,59 @@
+#ifndef GEOMETRY_SIMPLIFICATION_SESSION_H_
+#define GEOMETRY_SIMPLIFICATION_SESSION_H_
+
+#include <cstddef>
+#include <vector>
+
+#include "geometry/edge_contraction.h"
+#include "geometry/half_edge_mesh.h"
+#include "geometry/indexed_min_heap.h"
+
+namespace gfx {
+class Device;
+class Mesh;
+
+namespace mesh {
+
+/**
+ * \brief Incrementally simplifies a mesh to successively lower face counts.
+ * \details The half-edge mesh, vertex quadrics and edge contraction queue persist between calls to SimplifyTo so each
+ *          level of detail resumes edge contraction from the previous level. Generating a chain of levels of detail
+ *          therefore costs about the same as a single simplification to the lowest level and, unlike repeatedly
+ *          simplifying the output of Simplify, quadrics accumulated by earlier contractions are retained.
+ */
+class SimplificationSession {
+public:
+  /**
+   * \brief Initializes a simplification session.
+   * \param mesh The mesh to simplify.
+   */
+  explicit SimplificationSession(const Mesh& mesh);
+
+  /** \brief Gets the number of faces in the simplified mesh. */
+  [[nodiscard]] std::size_t face_count() const noexcept { return half_edge_mesh_.faces().size(); }
+
+  /**
+   * \brief Contracts edges until the simplified mesh has no more than a target number of faces.
+   * \details Has no effect if the simplified mesh already has no more than \p face_count faces. The result may have
+   *          more than \p face_count faces if no remaining edge can be contracted without degenerating the mesh.
+   * \param face_count The number of faces to reduce the simplified mesh to.
+   */
+  void SimplifyTo(std::size_t face_count);
+
+  /**
+   * \brief Creates a snapshot of the simplified mesh.
+   * \param device The graphics device used to load the reconstructed mesh data into GPU memory.
+   * \return An indexed triangle mesh of the current simplification state.
+   */
+  [[nodiscard]] Mesh ToMesh(const Device& device) const;
+
+private:
+  HalfEdgeMesh half_edge_mesh_;
+  std::vector<PositionQuadric> quadrics_;
+  IndexedMinHeap edge_contractions_;
+};
+
+}  // namespace mesh
+}  // namespace gfx
+
+#endif  // GEOMETRY_SIMPLIFICATION_SESSION_H_
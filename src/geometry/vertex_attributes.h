@@ -0,0 +1,18 @@
+#ifndef GEOMETRY_VERTEX_ATTRIBUTES_H_
+#define GEOMETRY_VERTEX_ATTRIBUTES_H_
+
+#include <cstdint>
+
+namespace gfx {
+
+/** \brief The vertex attributes included in the error metric used to simplify a mesh. */
+enum class VertexAttributes : std::uint8_t {
+  kPosition,
+  kPositionNormal,
+  kPositionTextureCoordinates,
+  kPositionNormalTextureCoordinates
+};
+
+}  // namespace gfx
+
+#endif  // GEOMETRY_VERTEX_ATTRIBUTES_H_
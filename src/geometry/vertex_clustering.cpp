@@ -0,0 +1,373 @@
+#include "geometry/vertex_clustering.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <ranges>
+#include <span>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include "geometry/arena.h"
+#include "geometry/quadric.h"
+
+namespace {
+
+/** \brief The maximum number of grid cells along each axis at the root level of the octree. */
+constexpr std::uint32_t kMaxGridResolution = 1u << 15u;
+
+/** \brief The maximum number of times a grid cell can be subdivided before its vertices are no longer clustered. */
+constexpr std::uint32_t kMaxOctreeDepth = 5;
+
+/** \brief The number of bits used to store each cell coordinate in an octree node key. */
+constexpr std::uint32_t kCellCoordinateBitCount = 20;
+static_assert(kMaxGridResolution << kMaxOctreeDepth <= 1u << kCellCoordinateBitCount);
+
+/** \brief Identifies vertices which are not clustered with any other vertex. */
+constexpr auto kUnclusteredNode = std::numeric_limits<std::uint64_t>::max();
+
+/** \brief A uniform grid of cubic cells enclosing the vertices of a mesh. */
+struct Grid {
+  glm::vec3 origin;
+  float cell_size;
+};
+
+/**
+ * \brief Creates a grid whose cell size is chosen such that the number of cells intersecting the mesh surface
+ *        approximates the number of vertices in a closed mesh with the target face count.
+ */
+Grid CreateGrid(const std::span<const glm::vec3> positions,
+                const std::span<const std::uint32_t> indices,
+                const std::size_t target_face_count) {
+  glm::vec3 min{std::numeric_limits<float>::max()};
+  glm::vec3 max{std::numeric_limits<float>::lowest()};
+  for (const auto& position : positions) {
+    min = glm::min(min, position);
+    max = glm::max(max, position);
+  }
+
+  double area = 0.0;
+  for (std::size_t i = 0; i < indices.size(); i += 3) {
+    const auto& p0 = positions[indices[i]];
+    const auto& p1 = positions[indices[i + 1]];
+    const auto& p2 = positions[indices[i + 2]];
+    area += 0.5 * static_cast<double>(glm::length(glm::cross(p1 - p0, p2 - p0)));
+  }
+
+  // by Euler's formula, a closed mesh has approximately half as many vertices as faces
+  const auto target_vertex_count = std::max<std::size_t>(target_face_count / 2, 1);
+  const auto max_extent = std::max({max.x - min.x, max.y - min.y, max.z - min.z});
+  const auto cell_size = std::max(static_cast<float>(std::sqrt(area / static_cast<double>(target_vertex_count))),
+                                  max_extent / static_cast<float>(kMaxGridResolution - 1));
+
+  return Grid{.origin = min, .cell_size = cell_size};
+}
+
+/** \brief Gets the size of octree nodes at a given level where each level halves the size of its parent. */
+float GetNodeSize(const Grid& grid, const std::uint32_t level) {
+  return grid.cell_size / static_cast<float>(1u << level);
+}
+
+/** \brief Gets the key of the octree node at a given level containing a position. */
+std::uint64_t GetNodeKey(const Grid& grid, const glm::vec3& position, const std::uint32_t level) {
+  const glm::uvec3 cell = glm::min(glm::uvec3{glm::max((position - grid.origin) / GetNodeSize(grid, level), 0.0f)},
+                                   glm::uvec3{(kMaxGridResolution << level) - 1});
+  return static_cast<std::uint64_t>(level) << 3u * kCellCoordinateBitCount
+         | static_cast<std::uint64_t>(cell.z) << 2u * kCellCoordinateBitCount
+         | static_cast<std::uint64_t>(cell.y) << kCellCoordinateBitCount | cell.x;
+}
+
+/** \brief Gets the octree level of the node with a given key. */
+std::uint32_t GetNodeLevel(const std::uint64_t key) {
+  return static_cast<std::uint32_t>(key >> 3u * kCellCoordinateBitCount);
+}
+
+/** \brief Gets the bounds of the octree node with a given key. */
+std::pair<glm::vec3, glm::vec3> GetNodeBounds(const Grid& grid, const std::uint64_t key) {
+  static constexpr auto kCoordinateMask = (std::uint64_t{1} << kCellCoordinateBitCount) - 1;
+  const auto level = GetNodeLevel(key);
+  const glm::vec3 cell{static_cast<float>(key & kCoordinateMask),
+                       static_cast<float>(key >> kCellCoordinateBitCount & kCoordinateMask),
+                       static_cast<float>(key >> 2u * kCellCoordinateBitCount & kCoordinateMask)};
+  const auto node_size = GetNodeSize(grid, level);
+  const auto node_min = grid.origin + cell * node_size;
+  return {node_min, node_min + node_size};
+}
+
+/**
+ * \brief Finds faces incident to a non-manifold edge or vertex.
+ * \details A mesh is a closed manifold if each directed edge appears exactly once and is paired with an edge in the
+ *          opposite direction, and the faces incident to each vertex form a single fan of at least three faces.
+ * \param indices The vertex indices of each triangle in counter-clockwise order.
+ * \return The indices of faces incident to a non-manifold edge or vertex which may contain duplicates.
+ */
+std::vector<std::uint32_t> FindNonManifoldFaces(const std::span<const std::uint32_t> indices) {
+  const auto face_count = static_cast<std::uint32_t>(indices.size() / 3);
+  std::vector<std::uint32_t> non_manifold_faces;
+
+  // each half-edge is keyed by its vertices and must have exactly one flip edge
+  std::vector<std::pair<std::uint64_t, std::uint32_t>> half_edges;
+  half_edges.reserve(indices.size());
+  for (std::uint32_t face = 0; face < face_count; ++face) {
+    for (std::uint32_t i = 0; i < 3; ++i) {
+      const auto v0 = indices[3 * face + i];
+      const auto v1 = indices[3 * face + (i + 1) % 3];
+      half_edges.emplace_back(static_cast<std::uint64_t>(v0) << 32u | v1, face);
+    }
+  }
+  std::ranges::sort(half_edges);
+
+  for (std::size_t i = 0; i < half_edges.size(); ++i) {
+    const auto [key, face] = half_edges[i];
+    const auto flip_key = key << 32u | key >> 32u;
+    if ((i > 0 && half_edges[i - 1].first == key) || (i + 1 < half_edges.size() && half_edges[i + 1].first == key)
+        || !std::ranges::binary_search(half_edges, flip_key, {}, &std::pair<std::uint64_t, std::uint32_t>::first)) {
+      non_manifold_faces.push_back(face);
+    }
+  }
+
+  // the link of a vertex can only be traversed once every edge is known to be manifold
+  if (!non_manifold_faces.empty()) return non_manifold_faces;
+
+  struct LinkEdge {
+    std::uint32_t vertex;
+    std::uint32_t v0;
+    std::uint32_t v1;
+    std::uint32_t face;
+  };
+
+  std::vector<LinkEdge> link_edges;
+  link_edges.reserve(indices.size());
+  for (std::uint32_t face = 0; face < face_count; ++face) {
+    for (std::uint32_t i = 0; i < 3; ++i) {
+      link_edges.push_back(LinkEdge{.vertex = indices[3 * face + i],
+                                    .v0 = indices[3 * face + (i + 1) % 3],
+                                    .v1 = indices[3 * face + (i + 2) % 3],
+                                    .face = face});
+    }
+  }
+  const auto get_link_key = [](const LinkEdge& link_edge) { return std::pair{link_edge.vertex, link_edge.v0}; };
+  std::ranges::sort(link_edges, {}, get_link_key);
+
+  for (auto begin = link_edges.begin(); begin != link_edges.end();) {
+    const auto end = std::ranges::find_if(begin, link_edges.end(), [&](const auto& link_edge) {
+      return link_edge.vertex != begin->vertex;
+    });
+    const auto link = std::ranges::subrange(begin, end);
+
+    // walk the link of the vertex from its first edge and verify every incident face is visited exactly once
+    std::size_t visited_count = 1;
+    for (auto v = begin->v1; v != begin->v0 && visited_count <= link.size(); ++visited_count) {
+      v = std::ranges::lower_bound(link, v, {}, &LinkEdge::v0)->v1;
+    }
+    if (visited_count != link.size() || link.size() < 3) {
+      for (const auto& link_edge : link) non_manifold_faces.push_back(link_edge.face);
+    }
+    begin = end;
+  }
+
+  return non_manifold_faces;
+}
+
+}  // namespace
+
+namespace gfx {
+
+ClusteredMesh ClusterVertices(const std::span<const glm::vec3> positions,
+                              const std::span<const std::uint32_t> indices,
+                              const std::size_t target_face_count) {
+  const auto face_count = static_cast<std::uint32_t>(indices.size() / 3);
+  if (face_count <= target_face_count) {
+    return ClusteredMesh{.positions = {positions.begin(), positions.end()},
+                         .indices = {indices.begin(), indices.end()}};
+  }
+
+  // vertices are clustered by the leaf node of an octree containing them whose root level is a uniform grid. Every
+  // vertex is first clustered at the root level in a single pass after which only nodes incident to non-manifold faces
+  // are subdivided. Vertices in a node subdivided at the maximum octree depth are no longer clustered.
+  const auto grid = CreateGrid(positions, indices, target_face_count);
+  std::unordered_map<std::uint64_t, std::uint32_t> node_clusters;
+  std::vector<std::uint64_t> vertex_nodes(positions.size());
+  std::vector<std::uint32_t> vertex_clusters(positions.size());
+  std::uint32_t cluster_count = 0;
+
+  // the vertices of each cluster are stored as an intrusive linked list so subdivided nodes can be visited directly
+  std::vector<std::uint32_t> cluster_heads;
+  std::vector<std::uint32_t> next_cluster_vertices(positions.size(), kInvalidIndex);
+
+  const auto assign_cluster = [&](const std::uint32_t v, const std::uint32_t level) {
+    const auto node = level <= kMaxOctreeDepth ? GetNodeKey(grid, positions[v], level) : kUnclusteredNode;
+    auto cluster = cluster_count;
+    if (node != kUnclusteredNode) {
+      cluster = node_clusters.try_emplace(node, cluster_count).first->second;
+    }
+    if (cluster == cluster_count) {
+      ++cluster_count;
+      cluster_heads.push_back(kInvalidIndex);
+    }
+    vertex_nodes[v] = node;
+    vertex_clusters[v] = cluster;
+    next_cluster_vertices[v] = std::exchange(cluster_heads[cluster], v);
+  };
+
+  for (std::uint32_t v = 0; v < positions.size(); ++v) {
+    assign_cluster(v, 0);
+  }
+
+  // faces with more than one vertex in the same cluster collapse and are removed from the mesh. Faces that do not
+  // collapse are stored contiguously and the slot of each face is tracked so it can be updated in constant time.
+  std::vector<std::uint32_t> clustered_indices;
+  std::vector<std::uint32_t> clustered_faces;
+  std::vector<std::uint32_t> face_slots(face_count, kInvalidIndex);
+
+  const auto update_face = [&](const std::uint32_t face) {
+    const auto c0 = vertex_clusters[indices[3 * face]];
+    const auto c1 = vertex_clusters[indices[3 * face + 1]];
+    const auto c2 = vertex_clusters[indices[3 * face + 2]];
+    auto& slot = face_slots[face];
+
+    if (c0 != c1 && c1 != c2 && c2 != c0) {
+      if (slot == kInvalidIndex) {
+        slot = static_cast<std::uint32_t>(clustered_faces.size());
+        clustered_faces.push_back(face);
+        clustered_indices.insert(clustered_indices.end(), {c0, c1, c2});
+      } else {
+        std::ranges::copy(std::array{c0, c1, c2}, clustered_indices.begin() + 3 * static_cast<std::ptrdiff_t>(slot));
+      }
+    } else if (slot != kInvalidIndex) {
+      // move the last face into the slot of the collapsed face
+      const auto last_face = clustered_faces.back();
+      std::ranges::copy(clustered_indices.end() - 3,
+                        clustered_indices.end(),
+                        clustered_indices.begin() + 3 * static_cast<std::ptrdiff_t>(slot));
+      clustered_faces[slot] = last_face;
+      face_slots[last_face] = slot;
+      clustered_faces.pop_back();
+      clustered_indices.resize(clustered_indices.size() - 3);
+      slot = kInvalidIndex;
+    }
+  };
+
+  for (std::uint32_t face = 0; face < face_count; ++face) {
+    update_face(face);
+  }
+
+  // the faces incident to each vertex are only needed to update faces when their vertices are re-clustered
+  std::vector<std::uint32_t> vertex_face_offsets(positions.size() + 1, 0);
+  for (const auto v : indices) ++vertex_face_offsets[v + 1];
+  for (std::size_t v = 0; v < positions.size(); ++v) vertex_face_offsets[v + 1] += vertex_face_offsets[v];
+  std::vector<std::uint32_t> vertex_faces(indices.size());
+  auto vertex_face_ends = vertex_face_offsets;
+  for (std::uint32_t face = 0; face < face_count; ++face) {
+    for (const auto v : indices.subspan(3 * static_cast<std::size_t>(face), 3)) {
+      vertex_faces[vertex_face_ends[v]++] = face;
+    }
+  }
+
+  // subdivide nodes incident to non-manifold faces which eventually restores the original connectivity in the
+  // neighborhood of each non-manifold edge or vertex and repeat until the clustered mesh is a closed manifold. Only
+  // the vertices of subdivided nodes are re-clustered and only their incident faces are updated.
+  std::vector<std::uint8_t> is_subdivided_cluster;
+  std::vector<std::uint32_t> subdivided_clusters;
+  std::vector<std::uint32_t> reclustered_vertices;
+  std::vector<std::uint32_t> face_refinements(face_count, 0);
+  for (std::uint32_t refinement = 1;; ++refinement) {
+    is_subdivided_cluster.assign(cluster_count, 0);
+    subdivided_clusters.clear();
+    for (const auto clustered_face : FindNonManifoldFaces(clustered_indices)) {
+      for (const auto v : indices.subspan(3 * static_cast<std::size_t>(clustered_faces[clustered_face]), 3)) {
+        if (const auto cluster = vertex_clusters[v];
+            vertex_nodes[v] != kUnclusteredNode && is_subdivided_cluster[cluster] == 0) {
+          is_subdivided_cluster[cluster] = 1;
+          subdivided_clusters.push_back(cluster);
+        }
+      }
+    }
+    if (subdivided_clusters.empty()) break;
+
+    reclustered_vertices.clear();
+    for (const auto cluster : subdivided_clusters) {
+      for (auto v = std::exchange(cluster_heads[cluster], kInvalidIndex); v != kInvalidIndex;) {
+        const auto next_v = next_cluster_vertices[v];
+        assign_cluster(v, GetNodeLevel(vertex_nodes[v]) + 1);
+        reclustered_vertices.push_back(v);
+        v = next_v;
+      }
+    }
+
+    // faces are updated after all of their vertices have been re-clustered and at most once per refinement
+    for (const auto v : reclustered_vertices) {
+      for (auto i = vertex_face_offsets[v]; i < vertex_face_offsets[v + 1]; ++i) {
+        if (const auto face = vertex_faces[i]; std::exchange(face_refinements[face], refinement) != refinement) {
+          update_face(face);
+        }
+      }
+    }
+  }
+
+  // map referenced clusters to output vertex IDs in order of first use
+  std::vector<std::uint32_t> output_ids(cluster_count, kInvalidIndex);
+  std::uint32_t output_vertex_count = 0;
+  ClusteredMesh clustered_mesh;
+  clustered_mesh.indices.reserve(clustered_indices.size());
+
+  for (const auto cluster : clustered_indices) {
+    if (output_ids[cluster] == kInvalidIndex) output_ids[cluster] = output_vertex_count++;
+    clustered_mesh.indices.push_back(output_ids[cluster]);
+  }
+
+  // accumulate the error quadric of each face in the cluster of each of its vertices including faces that collapsed
+  // in double precision since a cluster may sum the quadrics of many faces
+  std::vector<Quadric<3, double>> quadrics(output_vertex_count);
+  for (std::uint32_t face = 0; face < face_count; ++face) {
+    const auto face_indices = indices.subspan(3 * static_cast<std::size_t>(face), 3);
+    const auto& p0 = positions[face_indices[0]];
+    const auto normal = glm::cross(positions[face_indices[1]] - p0, positions[face_indices[2]] - p0);
+    if (const auto length = glm::length(normal); length > 0.0f) {
+      const auto unit_normal = normal / length;
+      const auto quadric =
+          Quadric<3, double>::FromPlane({unit_normal.x, unit_normal.y, unit_normal.z}, -glm::dot(p0, unit_normal));
+      for (const auto v : face_indices) {
+        if (const auto output_id = output_ids[vertex_clusters[v]]; output_id != kInvalidIndex) {
+          quadrics[output_id] += quadric;
+        }
+      }
+    }
+  }
+
+  std::vector<glm::vec3> position_sums(output_vertex_count, glm::vec3{0.0f});
+  std::vector<std::uint32_t> cluster_sizes(output_vertex_count, 0);
+  std::vector<std::uint64_t> cluster_nodes(output_vertex_count);
+  for (std::uint32_t v = 0; v < vertex_clusters.size(); ++v) {
+    if (const auto output_id = output_ids[vertex_clusters[v]]; output_id != kInvalidIndex) {
+      position_sums[output_id] += positions[v];
+      ++cluster_sizes[output_id];
+      cluster_nodes[output_id] = vertex_nodes[v];
+    }
+  }
+
+  // place each cluster at the position which minimizes its error quadric clamped to the bounds of its octree node
+  clustered_mesh.positions.reserve(output_vertex_count);
+  for (std::uint32_t output_id = 0; output_id < output_vertex_count; ++output_id) {
+    const auto mean_position = position_sums[output_id] / static_cast<float>(cluster_sizes[output_id]);
+    const auto position = cluster_sizes[output_id] == 1 ? std::nullopt : quadrics[output_id].Minimize();
+    if (!position.has_value()) {
+      clustered_mesh.positions.push_back(mean_position);
+      continue;
+    }
+    const auto [node_min, node_max] = GetNodeBounds(grid, cluster_nodes[output_id]);
+    const glm::vec3 optimal_position{(*position)[0], (*position)[1], (*position)[2]};
+    clustered_mesh.positions.push_back(glm::clamp(optimal_position, node_min, node_max));
+  }
+
+  return clustered_mesh;
+}
+
+}  // namespace gfx
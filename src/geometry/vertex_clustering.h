@@ -0,0 +1,42 @@
+#ifndef GEOMETRY_VERTEX_CLUSTERING_H_
+#define GEOMETRY_VERTEX_CLUSTERING_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include <glm/vec3.hpp>
+
+namespace gfx {
+
+/** \brief An indexed triangle mesh produced by vertex clustering. */
+struct ClusteredMesh {
+  std::vector<glm::vec3> positions;
+  std::vector<std::uint32_t> indices;
+};
+
+/**
+ * \brief Coarsely reduces the number of triangles in a closed manifold mesh by clustering vertices in a uniform grid.
+ * \details Vertices in the same grid cell are merged into a single representative vertex whose position minimizes the
+ *          sum of the error quadrics of faces incident to the cell and faces that collapse are removed. The grid cell
+ *          size is chosen from the surface area of the mesh such that the number of occupied cells approximates the
+ *          number of vertices needed for the target face count. Cells whose vertices cannot be merged without
+ *          producing a non-manifold edge or vertex are recursively subdivided as an octree so the result remains a
+ *          closed manifold mesh, which means the target face count may be exceeded. Vertices are clustered in a single
+ *          linear pass after which refinement is incremental: only the vertices of subdivided cells are re-clustered
+ *          and only their incident faces are updated, so each vertex is re-clustered at most once per octree level.
+ *          Each refinement pass sorts the edges of the clustered mesh, which is far smaller than the input mesh, to
+ *          find non-manifold edges and vertices.
+ * \param positions The vertex positions of the mesh.
+ * \param indices The vertex indices of each triangle in counter-clockwise order.
+ * \param target_face_count The approximate number of faces to reduce the mesh to.
+ * \return The clustered mesh or a copy of the original mesh if it has no more than \p target_face_count faces.
+ */
+ClusteredMesh ClusterVertices(std::span<const glm::vec3> positions,
+                              std::span<const std::uint32_t> indices,
+                              std::size_t target_face_count);
+
+}  // namespace gfx
+
+#endif  // GEOMETRY_VERTEX_CLUSTERING_H_
@@ -0,0 +1,36 @@
+#ifndef GEOMETRY_VERTEX_PLACEMENT_H_
+#define GEOMETRY_VERTEX_PLACEMENT_H_
+
+#include <cstdint>
+
+namespace gfx {
+
+/**
+ * \brief Determines where the vertex created by an edge contraction is placed.
+ * \details Optimal placements solve a linear system for every edge evaluation and produce the highest quality results.
+ *          Midpoint and endpoint placements only evaluate the edge quadric at a fixed point which is substantially
+ *          cheaper and suited to draft quality simplification.
+ */
+enum class VertexPlacement : std::uint8_t {
+  /**
+   * \brief The position that minimizes the error quadric of the edge or, if the quadric is singular, the edge vertex or
+   *        edge midpoint with the lowest error.
+   */
+  kOptimal,
+
+  /**
+   * \brief The position that minimizes the error quadric of the edge or, if the quadric is singular, the point of
+   *        minimum error along the edge.
+   */
+  kOptimalLineSearch,
+
+  /** \brief The edge midpoint. */
+  kMidpoint,
+
+  /** \brief The edge vertex with the lowest error which ensures simplified meshes only reference existing vertices. */
+  kEndpoint
+};
+
+}  // namespace gfx
+
+#endif  // GEOMETRY_VERTEX_PLACEMENT_H_
@@ -19,6 +19,8 @@ class ArcCamera {
 public:
   ArcCamera(const glm::vec3& target, const glm::vec3& position, const ViewFrustum& view_frustum);
 
+  [[nodiscard]] const ViewFrustum& view_frustum() const noexcept { return view_frustum_; }
+
   [[nodiscard]] glm::mat4 GetViewTransform() const noexcept;
   [[nodiscard]] glm::mat4 GetProjectionTransform() const noexcept;
 
@@ -0,0 +1,39 @@
+#include "graphics/atomic_file.h"
+
+#include <format>
+#include <fstream>
+#include <ios>
+#include <random>
+#include <stdexcept>
+#include <system_error>
+
+namespace gfx {
+
+void WriteFileAtomically(const std::filesystem::path& filepath,
+                         const std::initializer_list<std::span<const std::byte>> data) {
+  // a random suffix keeps concurrent processes writing the same file from sharing a temporary file
+  auto temporary_filepath = filepath;
+  temporary_filepath += std::format(".{:08x}.tmp", std::random_device{}());
+
+  std::error_code error_code;
+  {
+    std::ofstream ofstream{temporary_filepath, std::ios::binary | std::ios::trunc};
+    for (const auto bytes : data) {
+      ofstream.write(reinterpret_cast<const char*>(bytes.data()),  // NOLINT(*-reinterpret-cast)
+                     static_cast<std::streamsize>(bytes.size()));
+    }
+    if (!ofstream.flush()) {
+      ofstream.close();
+      std::filesystem::remove(temporary_filepath, error_code);
+      throw std::runtime_error{std::format("Unable to write {}", temporary_filepath.string())};
+    }
+  }
+
+  std::filesystem::rename(temporary_filepath, filepath, error_code);
+  if (error_code) {
+    std::filesystem::remove(temporary_filepath, error_code);
+    throw std::runtime_error{std::format("Unable to write {}", filepath.string())};
+  }
+}
+
+}  // namespace gfx
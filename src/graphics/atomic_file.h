@@ -0,0 +1,23 @@
+#ifndef GRAPHICS_ATOMIC_FILE_H_
+#define GRAPHICS_ATOMIC_FILE_H_
+
+#include <cstddef>
+#include <filesystem>
+#include <initializer_list>
+#include <span>
+
+namespace gfx {
+
+/**
+ * \brief Writes a file by renaming a completely written temporary file to its final path.
+ * \details Concurrent processes reading the file and writes interrupted by a crash never observe a partially written
+ *          file. The file either keeps its previous contents or contains all of \p data.
+ * \param filepath The path of the file to write.
+ * \param data The byte ranges to write to the file in order.
+ * \throw std::runtime_error Thrown if the file cannot be written.
+ */
+void WriteFileAtomically(const std::filesystem::path& filepath, std::initializer_list<std::span<const std::byte>> data);
+
+}  // namespace gfx
+
+#endif  // GRAPHICS_ATOMIC_FILE_H_
@@ -2,7 +2,10 @@
 #define GRAPHICS_BUFFER_H_
 
 #include <cassert>
+#include <cstddef>
+#include <cstdint>
 #include <cstring>
+#include <span>
 
 #include <vulkan/vulkan.hpp>
 
@@ -13,30 +16,49 @@ namespace gfx {
 
 class Buffer {
 public:
+  /**
+   * \brief Initializes a buffer.
+   * \param queue_family_indices The unique queue families that access the buffer concurrently or an empty span if the
+   *                             buffer is only accessed by one queue family at a time.
+   */
   Buffer(const Device& device,
          const vk::DeviceSize size,
          const vk::BufferUsageFlags buffer_usage_flags,
-         const vk::MemoryPropertyFlags memory_property_flags)
-      : buffer_{device->createBufferUnique(vk::BufferCreateInfo{.size = size, .usage = buffer_usage_flags})},
-        memory_{device, device->getBufferMemoryRequirements(*buffer_), memory_property_flags},
+         const vk::MemoryPropertyFlags memory_property_flags,
+         const std::span<const std::uint32_t> queue_family_indices = {})
+      : buffer_{device->createBufferUnique(vk::BufferCreateInfo{
+            .size = size,
+            .usage = buffer_usage_flags,
+            .sharingMode = queue_family_indices.size() > 1 ? vk::SharingMode::eConcurrent : vk::SharingMode::eExclusive,
+            .queueFamilyIndexCount = static_cast<std::uint32_t>(queue_family_indices.size()),
+            .pQueueFamilyIndices = queue_family_indices.data()})},
+        memory_{device,
+                device->getBufferMemoryRequirements(*buffer_),
+                memory_property_flags,
+                MemoryAllocator::ResourceTiling::kLinear},
         size_{size} {
-    device->bindBufferMemory(*buffer_, *memory_, 0);
+    device->bindBufferMemory(*buffer_, *memory_, memory_.offset());
   }
 
   [[nodiscard]] vk::Buffer operator*() const noexcept { return *buffer_; }
 
+  [[nodiscard]] vk::DeviceSize size() const noexcept { return size_; }
+
+  /** \brief Copies data to host-visible buffer memory which remains mapped for subsequent copies. */
   template <typename T>
-  void Copy(const vk::ArrayProxy<const T> data) {
-    auto* mapped_memory = memory_.Map();
+  void Copy(const vk::ArrayProxy<const T> data, const vk::DeviceSize offset = 0) {
+    auto* mapped_memory = static_cast<std::byte*>(memory_.Map());
     const auto size_bytes = sizeof(T) * data.size();
-    assert(size_bytes <= size_);
-    memcpy(mapped_memory, data.data(), size_bytes);
+    assert(offset + size_bytes <= size_);
+    memcpy(mapped_memory + offset, data.data(), size_bytes);
   }
 
-  void Copy(const Device& device, const Buffer& src_buffer) {
-    device.SubmitOneTimeCommandBuffer([&src_buffer, &dst_buffer = *this](const auto command_buffer) {
-      command_buffer.copyBuffer(*src_buffer, *dst_buffer, vk::BufferCopy{.size = src_buffer.size_});
-    });
+  /** \brief Copies data from host-visible buffer memory which remains mapped for subsequent copies. */
+  template <typename T>
+  void Read(const std::span<T> data, const vk::DeviceSize offset = 0) const {
+    const auto* mapped_memory = static_cast<const std::byte*>(memory_.Map());
+    assert(offset + data.size_bytes() <= size_);
+    memcpy(data.data(), mapped_memory + offset, data.size_bytes());
   }
 
 private:
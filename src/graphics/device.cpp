@@ -7,14 +7,17 @@
 #include <unordered_set>
 #include <vector>
 
+#include "graphics/memory_allocator.h"
+#include "graphics/upload_queue.h"
+
 namespace {
 
 vk::UniqueDevice CreateDevice(const gfx::PhysicalDevice& physical_device) {
   static constexpr auto kHighestNormalizedQueuePriority = 1.0f;
-  const auto [graphics_index, present_index] = physical_device.queue_family_indices();
+  const auto [graphics_index, present_index, transfer_index] = physical_device.queue_family_indices();
 
   const auto device_queue_create_info =
-      std::unordered_set{graphics_index, present_index}  //
+      std::unordered_set{graphics_index, present_index, transfer_index}  //
       | std::views::transform([](const auto queue_family_index) {
           return vk::DeviceQueueCreateInfo{.queueFamilyIndex = queue_family_index,
                                            .queueCount = 1,
@@ -24,11 +27,18 @@ vk::UniqueDevice CreateDevice(const gfx::PhysicalDevice& physical_device) {
 
   static constexpr std::array kDeviceExtensions{VK_KHR_SWAPCHAIN_EXTENSION_NAME};
 
+  // enable optional features that allow scenes to be rendered with a single indirect draw call when supported
+  const auto& physical_device_features = physical_device.features();
+  const vk::PhysicalDeviceFeatures enabled_features{
+      .multiDrawIndirect = physical_device_features.multiDrawIndirect,
+      .drawIndirectFirstInstance = physical_device_features.drawIndirectFirstInstance};
+
   auto device = physical_device->createDeviceUnique(
       vk::DeviceCreateInfo{.queueCreateInfoCount = static_cast<std::uint32_t>(device_queue_create_info.size()),
                            .pQueueCreateInfos = device_queue_create_info.data(),
                            .enabledExtensionCount = static_cast<std::uint32_t>(kDeviceExtensions.size()),
-                           .ppEnabledExtensionNames = kDeviceExtensions.data()});
+                           .ppEnabledExtensionNames = kDeviceExtensions.data(),
+                           .pEnabledFeatures = &enabled_features});
 
 #if VULKAN_HPP_DISPATCH_LOADER_DYNAMIC == 1
   VULKAN_HPP_DEFAULT_DISPATCHER.init(*device);
@@ -46,8 +56,11 @@ Device::Device(const vk::Instance instance, const vk::SurfaceKHR surface)
       device_{CreateDevice(physical_device_)},
       graphics_queue_{device_->getQueue(physical_device_.queue_family_indices().graphics_index, 0)},
       present_queue_{device_->getQueue(physical_device_.queue_family_indices().present_index, 0)},
-      one_time_submit_command_pool_{device_->createCommandPoolUnique(
-          vk::CommandPoolCreateInfo{.flags = vk::CommandPoolCreateFlagBits::eTransient,
-                                    .queueFamilyIndex = physical_device_.queue_family_indices().graphics_index})} {}
+      transfer_queue_{device_->getQueue(physical_device_.queue_family_indices().transfer_index, 0)},
+      memory_allocator_{std::make_unique<MemoryAllocator>(*physical_device_, *device_)},
+      upload_queue_{std::make_unique<UploadQueue>(*this)} {}
+
+// defined here where the memory allocator and upload queue are complete types
+Device::~Device() noexcept = default;
 
 }  // namespace gfx
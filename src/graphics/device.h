@@ -1,17 +1,20 @@
 #ifndef GRAPHICS_DEVICE_H_
 #define GRAPHICS_DEVICE_H_
 
-#include <concepts>
+#include <memory>
 
 #include <vulkan/vulkan.hpp>
 
 #include "graphics/physical_device.h"
 
 namespace gfx {
+class MemoryAllocator;
+class UploadQueue;
 
 class Device {
 public:
   Device(vk::Instance instance, vk::SurfaceKHR surface);
+  ~Device() noexcept;
 
   [[nodiscard]] vk::Device operator*() const noexcept { return *device_; }
   [[nodiscard]] const vk::Device* operator->() const noexcept { return &(*device_); }
@@ -19,27 +22,20 @@ public:
   [[nodiscard]] const PhysicalDevice& physical_device() const noexcept { return physical_device_; }
   [[nodiscard]] vk::Queue graphics_queue() const noexcept { return graphics_queue_; }
   [[nodiscard]] vk::Queue present_queue() const noexcept { return present_queue_; }
+  [[nodiscard]] vk::Queue transfer_queue() const noexcept { return transfer_queue_; }
 
-  void SubmitOneTimeCommandBuffer(std::invocable<const vk::CommandBuffer> auto&& command_sequence) const {
-    const auto command_buffers = device_->allocateCommandBuffersUnique(
-        vk::CommandBufferAllocateInfo{.commandPool = *one_time_submit_command_pool_,
-                                      .level = vk::CommandBufferLevel::ePrimary,
-                                      .commandBufferCount = 1});
-    const auto command_buffer = *command_buffers.front();
+  /** \brief Gets the allocator that sub-allocates buffer and image memory from large device memory blocks. */
+  [[nodiscard]] MemoryAllocator& memory_allocator() const noexcept { return *memory_allocator_; }
 
-    command_buffer.begin(vk::CommandBufferBeginInfo{.flags = vk::CommandBufferUsageFlagBits::eOneTimeSubmit});
-    command_sequence(command_buffer);
-    command_buffer.end();
-
-    graphics_queue_.submit(vk::SubmitInfo{.commandBufferCount = 1, .pCommandBuffers = &command_buffer});
-    graphics_queue_.waitIdle();
-  }
+  /** \brief Gets the queue used to asynchronously upload data to device-local buffers. */
+  [[nodiscard]] UploadQueue& upload_queue() const noexcept { return *upload_queue_; }
 
 private:
   PhysicalDevice physical_device_;
   vk::UniqueDevice device_;
-  vk::Queue graphics_queue_, present_queue_;
-  vk::UniqueCommandPool one_time_submit_command_pool_;
+  vk::Queue graphics_queue_, present_queue_, transfer_queue_;
+  std::unique_ptr<MemoryAllocator> memory_allocator_;
+  std::unique_ptr<UploadQueue> upload_queue_;
 };
 
 }  // namespace gfx
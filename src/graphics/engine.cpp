@@ -10,17 +10,30 @@
 #include <glm/mat4x4.hpp>
 
 #include "graphics/arc_camera.h"
+#include "graphics/lod_group.h"
 #include "graphics/mesh.h"
+#include "graphics/meshlet.h"
+#include "graphics/packed_vertex.h"
+#include "graphics/scene.h"
 #include "graphics/shader_module.h"
 #include "graphics/window.h"
 
 namespace {
 
+/** \brief The directory where compiled shaders and the pipeline cache are saved relative to the working directory. */
+const std::filesystem::path kCacheDirectory{"cache"};
+
 struct VertexTransforms {
   glm::mat4 model_view_transform{1.0f};
   glm::mat4 projection_transform{1.0f};
 };
 
+/** \brief The push constants of the scene vertex shader where model transforms are read from the instance buffer. */
+struct ViewTransforms {
+  glm::mat4 view_transform{1.0f};
+  glm::mat4 projection_transform{1.0f};
+};
+
 vk::SampleCountFlagBits GetMsaaSampleCount(const vk::PhysicalDeviceLimits& physical_device_limits) {
   const auto color_sample_count_flags = physical_device_limits.framebufferColorSampleCounts;
   const auto depth_sample_count_flags = physical_device_limits.framebufferDepthSampleCounts;
@@ -155,43 +168,88 @@ vk::UniquePipelineLayout CreateGraphicsPipelineLayout(const vk::Device device) {
       vk::PipelineLayoutCreateInfo{.pushConstantRangeCount = 1, .pPushConstantRanges = &kPushConstantRange});
 }
 
+vk::UniqueDescriptorSetLayout CreateSceneDescriptorSetLayout(const vk::Device device) {
+  static constexpr vk::DescriptorSetLayoutBinding kInstanceBufferBinding{
+      .binding = 0,
+      .descriptorType = vk::DescriptorType::eStorageBuffer,
+      .descriptorCount = 1,
+      .stageFlags = vk::ShaderStageFlagBits::eVertex};
+
+  return device.createDescriptorSetLayoutUnique(
+      vk::DescriptorSetLayoutCreateInfo{.bindingCount = 1, .pBindings = &kInstanceBufferBinding});
+}
+
+vk::UniquePipelineLayout CreateScenePipelineLayout(const vk::Device device,
+                                                   const vk::DescriptorSetLayout descriptor_set_layout) {
+  static constexpr vk::PushConstantRange kPushConstantRange{.stageFlags = vk::ShaderStageFlagBits::eVertex,
+                                                            .offset = 0,
+                                                            .size = sizeof(ViewTransforms)};
+
+  return device.createPipelineLayoutUnique(vk::PipelineLayoutCreateInfo{.setLayoutCount = 1,
+                                                                        .pSetLayouts = &descriptor_set_layout,
+                                                                        .pushConstantRangeCount = 1,
+                                                                        .pPushConstantRanges = &kPushConstantRange});
+}
+
+template <std::size_t N>
+vk::UniqueDescriptorPool CreateDescriptorPool(const vk::Device device) {
+  static constexpr vk::DescriptorPoolSize kDescriptorPoolSize{.type = vk::DescriptorType::eStorageBuffer,
+                                                              .descriptorCount = N};
+
+  return device.createDescriptorPoolUnique(
+      vk::DescriptorPoolCreateInfo{.maxSets = N, .poolSizeCount = 1, .pPoolSizes = &kDescriptorPoolSize});
+}
+
+template <std::size_t N>
+std::vector<vk::DescriptorSet> AllocateDescriptorSets(const vk::Device device,
+                                                      const vk::DescriptorPool descriptor_pool,
+                                                      const vk::DescriptorSetLayout descriptor_set_layout) {
+  std::array<vk::DescriptorSetLayout, N> descriptor_set_layouts;
+  std::ranges::fill(descriptor_set_layouts, descriptor_set_layout);
+  return device.allocateDescriptorSets(
+      vk::DescriptorSetAllocateInfo{.descriptorPool = descriptor_pool,
+                                    .descriptorSetCount = static_cast<std::uint32_t>(descriptor_set_layouts.size()),
+                                    .pSetLayouts = descriptor_set_layouts.data()});
+}
+
 vk::UniquePipeline CreateGraphicsPipeline(const vk::Device device,
                                           const vk::Extent2D swapchain_image_extent,
                                           const vk::SampleCountFlagBits msaa_sample_count,
                                           const vk::PipelineLayout pipeline_layout,
-                                          const vk::RenderPass render_pass) {
-  const std::filesystem::path vertex_shader_filepath{"assets/shaders/mesh.vert"};
-  const gfx::ShaderModule vertex_shader_module{device, vk::ShaderStageFlagBits::eVertex, vertex_shader_filepath};
-
-  const std::filesystem::path fragment_shader_filepath{"assets/shaders/mesh.frag"};
-  const gfx::ShaderModule fragment_shader_module{device, vk::ShaderStageFlagBits::eFragment, fragment_shader_filepath};
+                                          const vk::RenderPass render_pass,
+                                          const vk::PipelineCache pipeline_cache,
+                                          const std::filesystem::path& vertex_shader_filepath) {
+  const std::array shader_stages{
+      gfx::ShaderStage{.stage = vk::ShaderStageFlagBits::eVertex, .glsl_filepath = vertex_shader_filepath},
+      gfx::ShaderStage{.stage = vk::ShaderStageFlagBits::eFragment, .glsl_filepath = "assets/shaders/mesh.frag"}};
+  const auto shader_modules = gfx::CreateShaderModules(device, shader_stages, kCacheDirectory / "shaders");
 
   const std::array shader_stage_create_info{
-      vk::PipelineShaderStageCreateInfo{.stage = vk::ShaderStageFlagBits::eVertex,
-                                        .module = *vertex_shader_module,
+      vk::PipelineShaderStageCreateInfo{.stage = shader_stages[0].stage,
+                                        .module = *shader_modules[0],
                                         .pName = "main"},
-      vk::PipelineShaderStageCreateInfo{.stage = vk::ShaderStageFlagBits::eFragment,
-                                        .module = *fragment_shader_module,
+      vk::PipelineShaderStageCreateInfo{.stage = shader_stages[1].stage,
+                                        .module = *shader_modules[1],
                                         .pName = "main"}};
 
   static constexpr vk::VertexInputBindingDescription kVertexInputBindingDescription{
       .binding = 0,
-      .stride = sizeof(gfx::Mesh::Vertex),
+      .stride = sizeof(gfx::PackedVertex),
       .inputRate = vk::VertexInputRate::eVertex};
 
   static constexpr std::array kVertexAttributeDescriptions{
       vk::VertexInputAttributeDescription{.location = 0,
                                           .binding = 0,
-                                          .format = vk::Format::eR32G32B32Sfloat,
-                                          .offset = offsetof(gfx::Mesh::Vertex, position)},
+                                          .format = vk::Format::eR16G16B16A16Unorm,
+                                          .offset = offsetof(gfx::PackedVertex, position)},
       vk::VertexInputAttributeDescription{.location = 1,
                                           .binding = 0,
-                                          .format = vk::Format::eR32G32Sfloat,
-                                          .offset = offsetof(gfx::Mesh::Vertex, texture_coordinates)},
+                                          .format = vk::Format::eR16G16Sfloat,
+                                          .offset = offsetof(gfx::PackedVertex, texture_coordinates)},
       vk::VertexInputAttributeDescription{.location = 2,
                                           .binding = 0,
-                                          .format = vk::Format::eR32G32B32Sfloat,
-                                          .offset = offsetof(gfx::Mesh::Vertex, normal)}};
+                                          .format = vk::Format::eR16G16Snorm,
+                                          .offset = offsetof(gfx::PackedVertex, normal)}};
 
   static constexpr vk::PipelineVertexInputStateCreateInfo kVertexInputStateCreateInfo{
       .vertexBindingDescriptionCount = 1,
@@ -245,7 +303,7 @@ vk::UniquePipeline CreateGraphicsPipeline(const vk::Device device,
       .blendConstants = std::array{0.0f, 0.0f, 0.0f, 0.0f}};
 
   auto [result, graphics_pipeline] = device.createGraphicsPipelineUnique(
-      nullptr,
+      pipeline_cache,
       vk::GraphicsPipelineCreateInfo{.stageCount = static_cast<std::uint32_t>(shader_stage_create_info.size()),
                                      .pStages = shader_stage_create_info.data(),
                                      .pVertexInputState = &kVertexInputStateCreateInfo,
@@ -325,12 +383,27 @@ Engine::Engine(const Window& window)
                                        *render_pass_,
                                        color_attachment_.image_view(),
                                        depth_attachment_.image_view())},
+      pipeline_cache_{device_, kCacheDirectory / "pipeline_cache.bin"},
       graphics_pipeline_layout_{CreateGraphicsPipelineLayout(*device_)},
       graphics_pipeline_{CreateGraphicsPipeline(*device_,
                                                 swapchain_.image_extent(),
                                                 msaa_sample_count_,
                                                 *graphics_pipeline_layout_,
-                                                *render_pass_)},
+                                                *render_pass_,
+                                                *pipeline_cache_,
+                                                "assets/shaders/mesh.vert")},
+      scene_descriptor_set_layout_{CreateSceneDescriptorSetLayout(*device_)},
+      scene_pipeline_layout_{CreateScenePipelineLayout(*device_, *scene_descriptor_set_layout_)},
+      scene_pipeline_{CreateGraphicsPipeline(*device_,
+                                             swapchain_.image_extent(),
+                                             msaa_sample_count_,
+                                             *scene_pipeline_layout_,
+                                             *render_pass_,
+                                             *pipeline_cache_,
+                                             "assets/shaders/scene.vert")},
+      descriptor_pool_{CreateDescriptorPool<kMaxRenderFrames>(*device_)},
+      scene_descriptor_sets_{
+          AllocateDescriptorSets<kMaxRenderFrames>(*device_, *descriptor_pool_, *scene_descriptor_set_layout_)},
       command_pool_{CreateCommandPool(device_)},
       command_buffers_{AllocateCommandBuffers<kMaxRenderFrames>(*device_, *command_pool_)},
       acquire_next_image_semaphores_{CreateSemaphores<kMaxRenderFrames>(*device_)},
@@ -338,13 +411,93 @@ Engine::Engine(const Window& window)
       draw_fences_{CreateFences<kMaxRenderFrames>(*device_)} {}
 
 void Engine::Render(const ArcCamera& camera, const Mesh& mesh) {
+  const auto command_buffer = BeginFrame();
+
+  // meshes are uploaded asynchronously so skip drawing a mesh until its device-local buffers are written
+  if (mesh.IsUploaded()) {
+    command_buffer.bindPipeline(vk::PipelineBindPoint::eGraphics, *graphics_pipeline_);
+    const auto model_view_transform = camera.GetViewTransform() * mesh.transform();
+    const auto projection_transform = camera.GetProjectionTransform();
+    command_buffer.pushConstants<VertexTransforms>(
+        *graphics_pipeline_layout_,
+        vk::ShaderStageFlagBits::eVertex,
+        0,
+        VertexTransforms{
+            .model_view_transform = model_view_transform * mesh.quantization_bounds().GetDequantizationTransform(),
+            .projection_transform = projection_transform});
+
+    // cull meshlets outside the view frustum or facing away from the camera before submitting draws
+    mesh.Render(command_buffer, MeshletCuller{model_view_transform, projection_transform});
+  }
+
+  EndFrame(command_buffer);
+}
+
+void Engine::Render(const ArcCamera& camera, const LodGroup& lod_group) {
+  const auto command_buffer = BeginFrame();
+
+  if (const auto& mesh = lod_group.mesh(); mesh.IsUploaded()) {
+    command_buffer.bindPipeline(vk::PipelineBindPoint::eGraphics, *graphics_pipeline_);
+    const auto model_view_transform = camera.GetViewTransform() * mesh.transform();
+    const auto projection_transform = camera.GetProjectionTransform();
+    command_buffer.pushConstants<VertexTransforms>(
+        *graphics_pipeline_layout_,
+        vk::ShaderStageFlagBits::eVertex,
+        0,
+        VertexTransforms{
+            .model_view_transform = model_view_transform * mesh.quantization_bounds().GetDequantizationTransform(),
+            .projection_transform = projection_transform});
+
+    // cull the meshlets of the selected level of detail
+    mesh.Render(command_buffer, lod_group.lod().index_range, MeshletCuller{model_view_transform, projection_transform});
+  }
+
+  EndFrame(command_buffer);
+}
+
+void Engine::Render(const ArcCamera& camera, const Scene& scene) {
+  const auto command_buffer = BeginFrame();
+
+  if (scene.IsUploaded()) {
+    // the descriptor set of the current frame is no longer in use after waiting for its draw fence so it can be
+    // updated to reference the instance buffer of a different scene than the previous time the frame was rendered
+    const auto descriptor_set = scene_descriptor_sets_[current_frame_index_];
+    const vk::DescriptorBufferInfo instance_buffer_info{.buffer = scene.instance_buffer(),
+                                                        .offset = 0,
+                                                        .range = vk::WholeSize};
+    device_->updateDescriptorSets(vk::WriteDescriptorSet{.dstSet = descriptor_set,
+                                                         .dstBinding = 0,
+                                                         .dstArrayElement = 0,
+                                                         .descriptorCount = 1,
+                                                         .descriptorType = vk::DescriptorType::eStorageBuffer,
+                                                         .pBufferInfo = &instance_buffer_info},
+                                  nullptr);
+
+    command_buffer.bindPipeline(vk::PipelineBindPoint::eGraphics, *scene_pipeline_);
+    command_buffer.bindDescriptorSets(vk::PipelineBindPoint::eGraphics,
+                                      *scene_pipeline_layout_,
+                                      0,
+                                      descriptor_set,
+                                      nullptr);
+    command_buffer.pushConstants<ViewTransforms>(
+        *scene_pipeline_layout_,
+        vk::ShaderStageFlagBits::eVertex,
+        0,
+        ViewTransforms{.view_transform = camera.GetViewTransform(),
+                       .projection_transform = camera.GetProjectionTransform()});
+    scene.Render(command_buffer);
+  }
+
+  EndFrame(command_buffer);
+}
+
+vk::CommandBuffer Engine::BeginFrame() {
   if (++current_frame_index_ == kMaxRenderFrames) {
     current_frame_index_ = 0;
   }
   // NOLINTBEGIN(cppcoreguidelines-pro-bounds-constant-array-index)
   const auto draw_fence = *draw_fences_[current_frame_index_];
   const auto acquire_next_image_semaphore = *acquire_next_image_semaphores_[current_frame_index_];
-  const auto present_image_semaphore = *present_image_semaphores_[current_frame_index_];
   // NOLINTEND(cppcoreguidelines-pro-bounds-constant-array-index)
 
   static constexpr auto kMaxTimeout = std::numeric_limits<std::uint64_t>::max();
@@ -352,13 +505,11 @@ void Engine::Render(const ArcCamera& camera, const Mesh& mesh) {
   vk::resultCheck(result, "Draw fence failed to enter a signaled state");
   device_->resetFences(draw_fence);
 
-  std::uint32_t image_index = 0;
-  std::tie(result, image_index) = device_->acquireNextImageKHR(*swapchain_, kMaxTimeout, acquire_next_image_semaphore);
+  std::tie(result, image_index_) = device_->acquireNextImageKHR(*swapchain_, kMaxTimeout, acquire_next_image_semaphore);
   vk::resultCheck(result, "Failed to acquire the next presentable image");
 
   const auto command_buffer = *command_buffers_[current_frame_index_];
   command_buffer.begin(vk::CommandBufferBeginInfo{.flags = vk::CommandBufferUsageFlagBits::eOneTimeSubmit});
-  command_buffer.bindPipeline(vk::PipelineBindPoint::eGraphics, *graphics_pipeline_);
 
   static constexpr std::array kClearColor{0.05098039f, 0.06666667f, 0.08627451f, 1.0f};
   static constexpr std::array kClearValues{vk::ClearValue{.color = vk::ClearColorValue{kClearColor}},
@@ -367,24 +518,25 @@ void Engine::Render(const ArcCamera& camera, const Mesh& mesh) {
   command_buffer.beginRenderPass(
       vk::RenderPassBeginInfo{
           .renderPass = *render_pass_,
-          .framebuffer = *framebuffers_[image_index],
+          .framebuffer = *framebuffers_[image_index_],
           .renderArea = vk::Rect2D{.offset = vk::Offset2D{0, 0}, .extent = swapchain_.image_extent()},
           .clearValueCount = static_cast<std::uint32_t>(kClearValues.size()),
           .pClearValues = kClearValues.data()},
       vk::SubpassContents::eInline);
 
-  command_buffer.pushConstants<VertexTransforms>(
-      *graphics_pipeline_layout_,
-      vk::ShaderStageFlagBits::eVertex,
-      0,
-      VertexTransforms{.model_view_transform = camera.GetViewTransform() * mesh.transform(),
-                       .projection_transform = camera.GetProjectionTransform()});
-
-  mesh.Render(command_buffer);
+  return command_buffer;
+}
 
+void Engine::EndFrame(const vk::CommandBuffer command_buffer) {
   command_buffer.endRenderPass();
   command_buffer.end();
 
+  // NOLINTBEGIN(cppcoreguidelines-pro-bounds-constant-array-index)
+  const auto draw_fence = *draw_fences_[current_frame_index_];
+  const auto acquire_next_image_semaphore = *acquire_next_image_semaphores_[current_frame_index_];
+  const auto present_image_semaphore = *present_image_semaphores_[current_frame_index_];
+  // NOLINTEND(cppcoreguidelines-pro-bounds-constant-array-index)
+
   static constexpr vk::PipelineStageFlags kPipelineWaitStage = vk::PipelineStageFlagBits::eColorAttachmentOutput;
   device_.graphics_queue().submit(vk::SubmitInfo{.waitSemaphoreCount = 1,
                                                  .pWaitSemaphores = &acquire_next_image_semaphore,
@@ -396,11 +548,11 @@ void Engine::Render(const ArcCamera& camera, const Mesh& mesh) {
                                   draw_fence);
 
   const auto swapchain = *swapchain_;
-  result = device_.present_queue().presentKHR(vk::PresentInfoKHR{.waitSemaphoreCount = 1,
-                                                                 .pWaitSemaphores = &present_image_semaphore,
-                                                                 .swapchainCount = 1,
-                                                                 .pSwapchains = &swapchain,
-                                                                 .pImageIndices = &image_index});
+  const auto result = device_.present_queue().presentKHR(vk::PresentInfoKHR{.waitSemaphoreCount = 1,
+                                                                            .pWaitSemaphores = &present_image_semaphore,
+                                                                            .swapchainCount = 1,
+                                                                            .pSwapchains = &swapchain,
+                                                                            .pImageIndices = &image_index_});
   vk::resultCheck(result, "Failed to queue an image for presentation");
 }
 
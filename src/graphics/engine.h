@@ -10,11 +10,14 @@
 #include "graphics/device.h"
 #include "graphics/image.h"
 #include "graphics/instance.h"
+#include "graphics/pipeline_cache.h"
 #include "graphics/swapchain.h"
 
 namespace gfx {
 class ArcCamera;
+class LodGroup;
 class Mesh;
+class Scene;
 class Window;
 
 class Engine {
@@ -25,9 +28,22 @@ public:
 
   void Render(const ArcCamera& camera, const Mesh& mesh);
 
+  /** \brief Renders the level of detail of a mesh selected by the last \ref LodGroup::Update. */
+  void Render(const ArcCamera& camera, const LodGroup& lod_group);
+
+  /** \brief Renders every instance in a scene with a number of commands that is independent of the instance count. */
+  void Render(const ArcCamera& camera, const Scene& scene);
+
 private:
+  /** \brief Waits for the next frame to be available and begins recording its command buffer in the render pass. */
+  vk::CommandBuffer BeginFrame();
+
+  /** \brief Ends the render pass, submits the current frame and presents its swapchain image. */
+  void EndFrame(vk::CommandBuffer command_buffer);
+
   static constexpr std::size_t kMaxRenderFrames = 2;
   std::uint32_t current_frame_index_ = 0;
+  std::uint32_t image_index_ = 0;
   Instance instance_;
   vk::UniqueSurfaceKHR surface_;
   Device device_;
@@ -37,8 +53,18 @@ private:
   Image depth_attachment_;
   vk::UniqueRenderPass render_pass_;
   std::vector<vk::UniqueFramebuffer> framebuffers_;
+
+  /** \brief The pipeline cache loaded at startup and saved when the engine is destroyed to speed up later startups. */
+  PipelineCache pipeline_cache_;
   vk::UniquePipelineLayout graphics_pipeline_layout_;
   vk::UniquePipeline graphics_pipeline_;
+  vk::UniqueDescriptorSetLayout scene_descriptor_set_layout_;
+  vk::UniquePipelineLayout scene_pipeline_layout_;
+  vk::UniquePipeline scene_pipeline_;
+  vk::UniqueDescriptorPool descriptor_pool_;
+
+  /** \brief The descriptor sets that reference the instance buffer of the scene rendered in each frame. */
+  std::vector<vk::DescriptorSet> scene_descriptor_sets_;
   vk::UniqueCommandPool command_pool_;
   std::vector<vk::UniqueCommandBuffer> command_buffers_;
   std::array<vk::UniqueSemaphore, kMaxRenderFrames> acquire_next_image_semaphores_;
@@ -0,0 +1,81 @@
+#include "graphics/free_list_allocator.h"
+
+#include <bit>
+#include <cassert>
+#include <iterator>
+
+namespace {
+
+std::uint64_t AlignUp(const std::uint64_t value, const std::uint64_t alignment) noexcept {
+  return (value + alignment - 1) & ~(alignment - 1);
+}
+
+}  // namespace
+
+namespace gfx {
+
+FreeListAllocator::FreeListAllocator(const std::uint64_t size) : size_{size} {
+  if (size > 0) InsertFreeRange(0, size);
+}
+
+std::uint64_t FreeListAllocator::largest_free_range_size() const noexcept {
+  return free_ranges_by_size_.empty() ? 0 : free_ranges_by_size_.rbegin()->first;
+}
+
+std::optional<std::uint64_t> FreeListAllocator::Allocate(const std::uint64_t size, const std::uint64_t alignment) {
+  assert(size > 0);
+  assert(std::has_single_bit(alignment));
+
+  // find the smallest free range that fits the allocation after aligning its offset
+  for (auto iterator = free_ranges_by_size_.lower_bound({size, 0}); iterator != free_ranges_by_size_.end();
+       ++iterator) {
+    const auto [range_size, range_offset] = *iterator;
+    const auto offset = AlignUp(range_offset, alignment);
+    const auto range_end = range_offset + range_size;
+    if (offset + size > range_end) continue;
+
+    EraseFreeRange(free_ranges_.find(range_offset));
+    if (offset > range_offset) InsertFreeRange(range_offset, offset - range_offset);
+    if (offset + size < range_end) InsertFreeRange(offset + size, range_end - (offset + size));
+
+    allocations_.emplace(offset, size);
+    allocated_size_ += size;
+    return offset;
+  }
+
+  return std::nullopt;
+}
+
+void FreeListAllocator::Free(std::uint64_t offset) {
+  const auto allocation = allocations_.find(offset);
+  assert(allocation != allocations_.end());
+  auto size = allocation->second;
+  allocations_.erase(allocation);
+  allocated_size_ -= size;
+
+  // coalesce with adjacent free ranges so fragmentation does not accumulate as allocations are freed
+  if (const auto next = free_ranges_.find(offset + size); next != free_ranges_.end()) {
+    size += next->second;
+    EraseFreeRange(next);
+  }
+  if (const auto next = free_ranges_.lower_bound(offset); next != free_ranges_.begin()) {
+    if (const auto prev = std::prev(next); prev->first + prev->second == offset) {
+      offset = prev->first;
+      size += prev->second;
+      EraseFreeRange(prev);
+    }
+  }
+  InsertFreeRange(offset, size);
+}
+
+void FreeListAllocator::InsertFreeRange(const std::uint64_t offset, const std::uint64_t size) {
+  free_ranges_.emplace(offset, size);
+  free_ranges_by_size_.emplace(size, offset);
+}
+
+void FreeListAllocator::EraseFreeRange(const std::map<std::uint64_t, std::uint64_t>::const_iterator free_range) {
+  free_ranges_by_size_.erase({free_range->second, free_range->first});
+  free_ranges_.erase(free_range);
+}
+
+}  // namespace gfx
@@ -0,0 +1,73 @@
+#ifndef GRAPHICS_FREE_LIST_ALLOCATOR_H_
+#define GRAPHICS_FREE_LIST_ALLOCATOR_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <optional>
+#include <set>
+#include <unordered_map>
+#include <utility>
+
+namespace gfx {
+
+/**
+ * \brief Sub-allocates aligned ranges from a fixed-size block of memory.
+ * \details Free ranges are indexed by size to find the smallest range that fits each allocation and by offset to
+ *          coalesce adjacent free ranges when an allocation is freed. The allocator only tracks offsets so it can
+ *          manage memory that is not addressable by the host such as device memory.
+ */
+class FreeListAllocator {
+public:
+  /** \brief Initializes an allocator for a block of \p size bytes. */
+  explicit FreeListAllocator(std::uint64_t size);
+
+  /** \brief Gets the size of the block in bytes. */
+  [[nodiscard]] std::uint64_t size() const noexcept { return size_; }
+
+  /** \brief Gets the number of bytes in allocated ranges. */
+  [[nodiscard]] std::uint64_t allocated_size() const noexcept { return allocated_size_; }
+
+  /** \brief Gets the number of allocated ranges. */
+  [[nodiscard]] std::size_t allocation_count() const noexcept { return allocations_.size(); }
+
+  /** \brief Gets the number of free ranges which increases with fragmentation. */
+  [[nodiscard]] std::size_t free_range_count() const noexcept { return free_ranges_.size(); }
+
+  /** \brief Gets the size of the largest free range which bounds the largest allocation that can succeed. */
+  [[nodiscard]] std::uint64_t largest_free_range_size() const noexcept;
+
+  /** \brief Determines if the block has no allocated ranges. */
+  [[nodiscard]] bool empty() const noexcept { return allocations_.empty(); }
+
+  /**
+   * \brief Allocates a range in the block.
+   * \param size The size of the range in bytes.
+   * \param alignment The power of two that the range offset must be a multiple of.
+   * \return The range offset or \c std::nullopt if no free range can hold the allocation.
+   */
+  [[nodiscard]] std::optional<std::uint64_t> Allocate(std::uint64_t size, std::uint64_t alignment = 1);
+
+  /** \brief Frees a range returned by \ref Allocate. */
+  void Free(std::uint64_t offset);
+
+private:
+  void InsertFreeRange(std::uint64_t offset, std::uint64_t size);
+  void EraseFreeRange(std::map<std::uint64_t, std::uint64_t>::const_iterator free_range);
+
+  std::uint64_t size_;
+  std::uint64_t allocated_size_ = 0;
+
+  /** \brief The size of each free range by offset. */
+  std::map<std::uint64_t, std::uint64_t> free_ranges_;
+
+  /** \brief The size and offset of each free range ordered by size. */
+  std::set<std::pair<std::uint64_t, std::uint64_t>> free_ranges_by_size_;
+
+  /** \brief The size of each allocated range by offset. */
+  std::unordered_map<std::uint64_t, std::uint64_t> allocations_;
+};
+
+}  // namespace gfx
+
+#endif  // GRAPHICS_FREE_LIST_ALLOCATOR_H_
@@ -10,6 +10,7 @@
 #include <utility>
 
 #include <glslang/Include/glslang_c_interface.h>
+#include <glslang/build_info.h>
 #include <glslang/Public/resource_limits_c.h>
 
 template <>
@@ -82,6 +83,12 @@ constexpr auto kGlslangMessages =
     GLSLANG_MSG_SPV_RULES_BIT | GLSLANG_MSG_VULKAN_RULES_BIT;
 // NOLINTEND(hicpp-signed-bitwise)
 
+// compilation settings shared with the compile options that key the SPIR-V cache so that both always change together
+constexpr auto kClientVersion = GLSLANG_TARGET_VULKAN_1_3;
+constexpr auto kTargetLanguageVersion = GLSLANG_TARGET_SPV_1_6;
+constexpr auto kDefaultVersion = 460;
+constexpr auto kDefaultProfile = GLSLANG_NO_PROFILE;
+
 template <typename Fn, typename T>
   requires requires(Fn glslang_get_fn, T* glslang_element) {
     { glslang_get_fn(glslang_element) } -> std::same_as<const char*>;
@@ -98,12 +105,12 @@ GlslangShader CreateGlslangShader(const glslang_stage_t glslang_stage, const std
   const glslang_input_t glslang_input{.language = GLSLANG_SOURCE_GLSL,
                                       .stage = glslang_stage,
                                       .client = GLSLANG_CLIENT_VULKAN,
-                                      .client_version = GLSLANG_TARGET_VULKAN_1_3,
+                                      .client_version = kClientVersion,
                                       .target_language = GLSLANG_TARGET_SPV,
-                                      .target_language_version = GLSLANG_TARGET_SPV_1_6,
+                                      .target_language_version = kTargetLanguageVersion,
                                       .code = glsl_source.c_str(),
-                                      .default_version = 460,
-                                      .default_profile = GLSLANG_NO_PROFILE,
+                                      .default_version = kDefaultVersion,
+                                      .default_profile = kDefaultProfile,
                                       .force_default_version_and_profile = 0,
                                       .forward_compatible = 0,
                                       .messages = static_cast<glslang_messages_t>(kGlslangMessages),
@@ -189,4 +196,17 @@ std::vector<std::uint32_t> Compile(const glslang_stage_t glslang_stage, const st
   return GenerateSpirv(glslang_stage, *glslang_program);
 }
 
+std::string GetCompileOptions(const glslang_stage_t glslang_stage) {
+  return std::format("glslang {}.{}.{} {} client={:#x} spv={:#x} glsl={} profile={} messages={}",
+                     GLSLANG_VERSION_MAJOR,
+                     GLSLANG_VERSION_MINOR,
+                     GLSLANG_VERSION_PATCH,
+                     glslang_stage,
+                     static_cast<int>(kClientVersion),
+                     static_cast<int>(kTargetLanguageVersion),
+                     kDefaultVersion,
+                     static_cast<int>(kDefaultProfile),
+                     static_cast<int>(kGlslangMessages));
+}
+
 }  // namespace gfx::glslang
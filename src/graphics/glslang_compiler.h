@@ -11,6 +11,14 @@ namespace gfx::glslang {
 
 std::vector<std::uint32_t> Compile(glslang_stage_t glslang_stage, const std::string& glsl_source);
 
+/**
+ * \brief Gets a description of the options used to compile a shader stage.
+ * \details The description includes the glslang version and target settings so stale SPIR-V is never reused.
+ * \param glslang_stage The shader stage to compile.
+ * \return A string which changes whenever the SPIR-V compiled from the same GLSL source would change.
+ */
+[[nodiscard]] std::string GetCompileOptions(glslang_stage_t glslang_stage);
+
 }  // namespace gfx::glslang
 
 #endif  // GRAPHICS_GLSLANG_COMPILER_H_
@@ -43,9 +43,12 @@ Image::Image(const Device& device,
              const vk::ImageAspectFlags image_aspect_flags,
              const vk::MemoryPropertyFlags memory_property_flags)
     : image_{CreateImage(*device, format, extent, sample_count, image_usage_flags)},
-      memory_{device, device->getImageMemoryRequirements(*image_), memory_property_flags},
+      memory_{device,
+              device->getImageMemoryRequirements(*image_),
+              memory_property_flags,
+              MemoryAllocator::ResourceTiling::kOptimal},
       format_{format} {
-  device->bindImageMemory(*image_, *memory_, 0);
+  device->bindImageMemory(*image_, *memory_, memory_.offset());
   image_view_ = CreateImageView(*device, *image_, format, image_aspect_flags);
 }
 
@@ -0,0 +1,66 @@
+#include "graphics/lod_group.h"
+
+#include <algorithm>
+#include <cassert>
+#include <limits>
+#include <ranges>
+#include <utility>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include "graphics/arc_camera.h"
+
+namespace {
+
+glm::vec3 GetBoundingBoxCenter(const std::vector<gfx::Mesh::Vertex>& vertices) {
+  auto min_position = glm::vec3{std::numeric_limits<float>::max()};
+  auto max_position = glm::vec3{std::numeric_limits<float>::lowest()};
+  for (const auto& vertex : vertices) {
+    min_position = glm::min(min_position, vertex.position);
+    max_position = glm::max(max_position, vertex.position);
+  }
+  return (min_position + max_position) / 2.0f;
+}
+
+float GetBoundingSphereRadius(const std::vector<gfx::Mesh::Vertex>& vertices, const glm::vec3& center) {
+  auto radius = 0.0f;
+  for (const auto& vertex : vertices) radius = std::max(radius, glm::distance(center, vertex.position));
+  return radius;
+}
+
+std::vector<float> GetGeometricErrors(const std::vector<gfx::LodLevel>& lods) {
+  return lods | std::views::transform(&gfx::LodLevel::geometric_error) | std::ranges::to<std::vector>();
+}
+
+}  // namespace
+
+namespace gfx {
+
+LodGroup::LodGroup(Mesh mesh, std::vector<LodLevel> lods, const LodSelectorOptions& options)
+    : mesh_{std::move(mesh)},
+      lods_{std::move(lods)},
+      bounding_sphere_center_{GetBoundingBoxCenter(mesh_.vertices())},
+      bounding_sphere_radius_{GetBoundingSphereRadius(mesh_.vertices(), bounding_sphere_center_)},
+      lod_selector_{GetGeometricErrors(lods_), options} {
+  assert(!lods_.empty());
+  // build meshlets for each level of detail so the selected level can be culled without referencing other levels
+  const auto index_ranges = lods_ | std::views::transform(&LodLevel::index_range) | std::ranges::to<std::vector>();
+  mesh_.BuildMeshlets(index_ranges);
+}
+
+std::size_t LodGroup::Update(const ArcCamera& camera, const float viewport_height) noexcept {
+  // scale model units by the largest axis scale of the model transform so the projected error remains conservative
+  const auto& transform = mesh_.transform();
+  const auto scale = std::max({glm::length(glm::vec3{transform[0]}),
+                               glm::length(glm::vec3{transform[1]}),
+                               glm::length(glm::vec3{transform[2]})});
+
+  const auto model_view_transform = camera.GetViewTransform() * transform;
+  const glm::vec3 view_center{model_view_transform * glm::vec4{bounding_sphere_center_, 1.0f}};
+  const auto distance = glm::length(view_center) - scale * bounding_sphere_radius_;
+
+  return lod_selector_.Select(scale * GetPixelsPerUnit(distance, camera.view_frustum(), viewport_height));
+}
+
+}  // namespace gfx
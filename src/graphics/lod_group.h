@@ -0,0 +1,63 @@
+#ifndef GRAPHICS_LOD_GROUP_H_
+#define GRAPHICS_LOD_GROUP_H_
+
+#include <cstddef>
+#include <vector>
+
+#include <glm/vec3.hpp>
+
+#include "graphics/lod_selector.h"
+#include "graphics/mesh.h"
+
+namespace gfx {
+class ArcCamera;
+
+/** \brief A level of detail in the shared index buffer of a \ref LodGroup mesh. */
+struct LodLevel {
+  IndexRange index_range;
+
+  /** \brief The maximum distance in model units between this level of detail and the original mesh surface. */
+  float geometric_error = 0.0f;
+};
+
+/**
+ * \brief Levels of detail of a mesh of which one is selected each frame based on its projected screen-space error.
+ * \details Full detail is kept close to the camera while distant meshes are rendered with far fewer triangles. The
+ *          distance to the camera is measured to the closest point of the mesh bounding sphere so the projected error
+ *          is an upper bound for every point on the mesh.
+ */
+class LodGroup {
+public:
+  /**
+   * \brief Initializes a level of detail group.
+   * \param mesh The mesh whose index buffer contains every level of detail.
+   * \param lods The levels of detail in order of decreasing detail and increasing geometric error.
+   * \param options Options that control when the selected level of detail changes.
+   */
+  LodGroup(Mesh mesh, std::vector<LodLevel> lods, const LodSelectorOptions& options = {});
+
+  [[nodiscard]] const Mesh& mesh() const noexcept { return mesh_; }
+  [[nodiscard]] const std::vector<LodLevel>& lods() const noexcept { return lods_; }
+
+  /** \brief Gets the selected level of detail. */
+  [[nodiscard]] const LodLevel& lod() const noexcept { return lods_[lod_selector_.lod_index()]; }
+
+  /**
+   * \brief Selects the level of detail to render from the current camera view.
+   * \param camera The camera the mesh is rendered from.
+   * \param viewport_height The height of the viewport in pixels.
+   * \return The index of the selected level of detail.
+   */
+  std::size_t Update(const ArcCamera& camera, float viewport_height) noexcept;
+
+private:
+  Mesh mesh_;
+  std::vector<LodLevel> lods_;
+  glm::vec3 bounding_sphere_center_{0.0f};
+  float bounding_sphere_radius_ = 0.0f;
+  LodSelector lod_selector_;
+};
+
+}  // namespace gfx
+
+#endif  // GRAPHICS_LOD_GROUP_H_
@@ -0,0 +1,40 @@
+#include "graphics/lod_selector.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <utility>
+
+namespace gfx {
+
+float GetPixelsPerUnit(const float distance, const ViewFrustum& view_frustum, const float viewport_height) noexcept {
+  // the viewport spans 2 * distance * tan(fov_y / 2) world units vertically at the given distance
+  const auto clamped_distance = std::max(distance, view_frustum.z_near);
+  return viewport_height / (2.0f * clamped_distance * std::tan(view_frustum.field_of_view_y / 2.0f));
+}
+
+LodSelector::LodSelector(std::vector<float> geometric_errors, const LodSelectorOptions& options)
+    : geometric_errors_{std::move(geometric_errors)}, options_{options} {
+  assert(!geometric_errors_.empty());
+  assert(std::ranges::is_sorted(geometric_errors_));
+  assert(options_.hysteresis >= 0.0f && options_.hysteresis < 1.0f);
+}
+
+std::size_t LodSelector::Select(const float pixels_per_unit) noexcept {
+  const auto get_pixel_error = [&](const std::size_t lod_index) {
+    return geometric_errors_[lod_index] * pixels_per_unit;
+  };
+
+  // refine while the selected level of detail exceeds the threshold
+  while (lod_index_ > 0 && get_pixel_error(lod_index_) > options_.max_pixel_error) --lod_index_;
+
+  // coarsen only while the next level of detail is below the threshold reduced by the hysteresis margin
+  const auto coarsen_pixel_error = (1.0f - options_.hysteresis) * options_.max_pixel_error;
+  while (lod_index_ + 1 < geometric_errors_.size() && get_pixel_error(lod_index_ + 1) < coarsen_pixel_error) {
+    ++lod_index_;
+  }
+
+  return lod_index_;
+}
+
+}  // namespace gfx
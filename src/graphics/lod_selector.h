@@ -0,0 +1,63 @@
+#ifndef GRAPHICS_LOD_SELECTOR_H_
+#define GRAPHICS_LOD_SELECTOR_H_
+
+#include <cstddef>
+#include <vector>
+
+#include "graphics/arc_camera.h"
+
+namespace gfx {
+
+/** \brief Options that control when a \ref LodSelector switches between levels of detail. */
+struct LodSelectorOptions {
+  /** \brief The maximum projected geometric error in pixels of the selected level of detail. */
+  float max_pixel_error = 1.0f;
+
+  /**
+   * \brief The fraction of \ref max_pixel_error by which the projected error of a coarser level of detail must fall
+   *        below the threshold before it is selected which prevents popping when the error is close to the threshold.
+   */
+  float hysteresis = 0.25f;
+};
+
+/**
+ * \brief Gets the number of pixels spanned by a unit length at a distance from the camera.
+ * \param distance The distance from the camera in world units which is clamped to the near plane.
+ * \param view_frustum The view frustum of the camera.
+ * \param viewport_height The height of the viewport in pixels.
+ */
+[[nodiscard]] float GetPixelsPerUnit(float distance, const ViewFrustum& view_frustum, float viewport_height) noexcept;
+
+/**
+ * \brief Selects the coarsest level of detail whose geometric error projected to the screen is below a pixel threshold.
+ * \details The previously selected level of detail is retained between frames so switching to a coarser level requires
+ *          its projected error to fall below a lower threshold than the threshold that switches to a finer level.
+ */
+class LodSelector {
+public:
+  /**
+   * \brief Initializes a level of detail selector.
+   * \param geometric_errors The geometric error in model units of each level of detail in order of decreasing detail.
+   * \param options Options that control when the selected level of detail changes.
+   */
+  explicit LodSelector(std::vector<float> geometric_errors, const LodSelectorOptions& options = {});
+
+  /** \brief Gets the index of the selected level of detail. */
+  [[nodiscard]] std::size_t lod_index() const noexcept { return lod_index_; }
+
+  /**
+   * \brief Selects a level of detail.
+   * \param pixels_per_unit The number of pixels spanned by a model unit at the closest point of the model.
+   * \return The index of the selected level of detail.
+   */
+  std::size_t Select(float pixels_per_unit) noexcept;
+
+private:
+  std::vector<float> geometric_errors_;
+  LodSelectorOptions options_;
+  std::size_t lod_index_ = 0;
+};
+
+}  // namespace gfx
+
+#endif  // GRAPHICS_LOD_SELECTOR_H_
@@ -0,0 +1,178 @@
+#include "graphics/mapped_file.h"
+
+#include <cstdint>
+#include <format>
+#include <stdexcept>
+#include <utility>
+
+#ifdef _WIN32
+#define NOMINMAX
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace {
+
+std::runtime_error CreateMappingError(const std::filesystem::path& filepath) {
+  return std::runtime_error{std::format("Unable to map {}", filepath.string())};
+}
+
+}  // namespace
+
+namespace gfx {
+
+#ifdef _WIN32
+
+MappedFile::MappedFile(const std::filesystem::path& filepath) {
+  const auto file = CreateFileW(filepath.c_str(),
+                                GENERIC_READ,
+                                FILE_SHARE_READ,
+                                nullptr,
+                                OPEN_EXISTING,
+                                FILE_ATTRIBUTE_NORMAL | FILE_FLAG_RANDOM_ACCESS,
+                                nullptr);
+  if (file == INVALID_HANDLE_VALUE) throw CreateMappingError(filepath);
+
+  LARGE_INTEGER file_size{};
+  if (GetFileSizeEx(file, &file_size) == 0) {
+    CloseHandle(file);
+    throw CreateMappingError(filepath);
+  }
+
+  // empty files cannot be mapped and are represented by an empty view
+  if (file_size.QuadPart > 0) {
+    file_mapping_ = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    auto* const data = file_mapping_ != nullptr ? MapViewOfFile(file_mapping_, FILE_MAP_READ, 0, 0, 0) : nullptr;
+    if (data == nullptr) {
+      if (file_mapping_ != nullptr) CloseHandle(file_mapping_);
+      CloseHandle(file);
+      throw CreateMappingError(filepath);
+    }
+    data_ = std::span{static_cast<std::byte*>(data), static_cast<std::size_t>(file_size.QuadPart)};
+  }
+
+  // the file mapping holds a reference to the file which allows the file handle to be closed immediately
+  CloseHandle(file);
+}
+
+MappedFile::MappedFile(const std::filesystem::path& filepath, const std::size_t size) : writable_{true} {
+  const auto file = CreateFileW(filepath.c_str(),
+                                GENERIC_READ | GENERIC_WRITE,
+                                0,
+                                nullptr,
+                                CREATE_ALWAYS,
+                                FILE_ATTRIBUTE_NORMAL | FILE_FLAG_RANDOM_ACCESS,
+                                nullptr);
+  if (file == INVALID_HANDLE_VALUE) throw CreateMappingError(filepath);
+
+  // a file mapping larger than the file extends the file with zeros
+  if (size > 0) {
+    const auto mapping_size = static_cast<std::uint64_t>(size);
+    file_mapping_ = CreateFileMappingW(file,
+                                       nullptr,
+                                       PAGE_READWRITE,
+                                       static_cast<DWORD>(mapping_size >> 32u),
+                                       static_cast<DWORD>(mapping_size),
+                                       nullptr);
+    auto* const data = file_mapping_ != nullptr ? MapViewOfFile(file_mapping_, FILE_MAP_WRITE, 0, 0, 0) : nullptr;
+    if (data == nullptr) {
+      if (file_mapping_ != nullptr) CloseHandle(file_mapping_);
+      CloseHandle(file);
+      throw CreateMappingError(filepath);
+    }
+    data_ = std::span{static_cast<std::byte*>(data), size};
+  }
+
+  CloseHandle(file);
+}
+
+void MappedFile::Unmap() noexcept {
+  if (!data_.empty()) UnmapViewOfFile(data_.data());
+  if (file_mapping_ != nullptr) CloseHandle(file_mapping_);
+  data_ = {};
+  file_mapping_ = nullptr;
+}
+
+MappedFile& MappedFile::operator=(MappedFile&& mapped_file) noexcept {
+  if (this != &mapped_file) {
+    Unmap();
+    data_ = std::exchange(mapped_file.data_, {});
+    writable_ = std::exchange(mapped_file.writable_, false);
+    file_mapping_ = std::exchange(mapped_file.file_mapping_, nullptr);
+  }
+  return *this;
+}
+
+#else
+
+MappedFile::MappedFile(const std::filesystem::path& filepath) {
+  const auto file = open(filepath.c_str(), O_RDONLY);  // NOLINT(*-vararg)
+  if (file == -1) throw CreateMappingError(filepath);
+
+  struct stat file_status{};
+  if (fstat(file, &file_status) == -1) {
+    close(file);
+    throw CreateMappingError(filepath);
+  }
+
+  // empty files cannot be mapped and are represented by an empty view
+  if (const auto file_size = static_cast<std::size_t>(file_status.st_size); file_size > 0) {
+    auto* const data = mmap(nullptr, file_size, PROT_READ, MAP_PRIVATE, file, 0);
+    if (data == MAP_FAILED) {
+      close(file);
+      throw CreateMappingError(filepath);
+    }
+    data_ = std::span{static_cast<std::byte*>(data), file_size};
+  }
+
+  // the mapping holds a reference to the file which allows the file descriptor to be closed immediately
+  close(file);
+}
+
+MappedFile::MappedFile(const std::filesystem::path& filepath, const std::size_t size) : writable_{true} {
+  const auto file = open(filepath.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);  // NOLINT(*-vararg)
+  if (file == -1) throw CreateMappingError(filepath);
+
+  // extending the file fills it with zeros which file systems store sparsely until pages are written
+  if (ftruncate(file, static_cast<off_t>(size)) == -1) {
+    close(file);
+    throw CreateMappingError(filepath);
+  }
+
+  // shared mappings write modified pages back to the file so they can be evicted under memory pressure
+  if (size > 0) {
+    auto* const data = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, file, 0);
+    if (data == MAP_FAILED) {
+      close(file);
+      throw CreateMappingError(filepath);
+    }
+    data_ = std::span{static_cast<std::byte*>(data), size};
+  }
+
+  close(file);
+}
+
+void MappedFile::Unmap() noexcept {
+  if (!data_.empty()) {
+    munmap(data_.data(), data_.size());
+    data_ = {};
+  }
+}
+
+MappedFile& MappedFile::operator=(MappedFile&& mapped_file) noexcept {
+  if (this != &mapped_file) {
+    Unmap();
+    data_ = std::exchange(mapped_file.data_, {});
+    writable_ = std::exchange(mapped_file.writable_, false);
+  }
+  return *this;
+}
+
+#endif
+
+}  // namespace gfx
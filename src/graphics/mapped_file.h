@@ -0,0 +1,72 @@
+#ifndef GRAPHICS_MAPPED_FILE_H_
+#define GRAPHICS_MAPPED_FILE_H_
+
+#include <cassert>
+#include <cstddef>
+#include <filesystem>
+#include <span>
+#include <utility>
+
+namespace gfx {
+
+/**
+ * \brief A view of a file mapped into the address space of the process.
+ * \details Pages are loaded on demand and may be evicted by the operating system under memory pressure which allows
+ *          files larger than physical memory to be accessed randomly without reading them into memory. Existing files
+ *          are mapped read-only while created files are mapped for writing and modified pages are written back to the
+ *          file rather than kept in memory.
+ */
+class MappedFile {
+public:
+  /**
+   * \brief Maps a file into memory.
+   * \param filepath The path of the file to map.
+   * \throw std::runtime_error Thrown if the file cannot be opened or mapped.
+   */
+  explicit MappedFile(const std::filesystem::path& filepath);
+
+  /**
+   * \brief Creates a zero-initialized file and maps it into memory for reading and writing.
+   * \param filepath The path of the file to create which is replaced if it already exists.
+   * \param size The size of the file in bytes.
+   * \throw std::runtime_error Thrown if the file cannot be created or mapped.
+   */
+  MappedFile(const std::filesystem::path& filepath, std::size_t size);
+
+  MappedFile(const MappedFile&) = delete;
+  MappedFile(MappedFile&& mapped_file) noexcept { *this = std::move(mapped_file); }
+
+  MappedFile& operator=(const MappedFile&) = delete;
+  MappedFile& operator=(MappedFile&& mapped_file) noexcept;
+
+  ~MappedFile() noexcept { Unmap(); }
+
+  /** \brief Gets the file contents. */
+  [[nodiscard]] std::span<const std::byte> data() const noexcept { return data_; }
+
+  /** \brief Gets the file contents as an array of trivially copyable objects. */
+  template <typename T>
+  [[nodiscard]] std::span<const T> data_as() const noexcept {
+    return std::span{reinterpret_cast<const T*>(data_.data()), data_.size() / sizeof(T)};  // NOLINT(*-reinterpret-cast)
+  }
+
+  /** \brief Gets the contents of a created file as a writable array of trivially copyable objects. */
+  template <typename T>
+  [[nodiscard]] std::span<T> writable_data_as() noexcept {
+    assert(writable_);
+    return std::span{reinterpret_cast<T*>(data_.data()), data_.size() / sizeof(T)};  // NOLINT(*-reinterpret-cast)
+  }
+
+private:
+  void Unmap() noexcept;
+
+  std::span<std::byte> data_;
+  bool writable_ = false;
+#ifdef _WIN32
+  void* file_mapping_ = nullptr;
+#endif
+};
+
+}  // namespace gfx
+
+#endif  // GRAPHICS_MAPPED_FILE_H_
@@ -5,14 +5,18 @@
 
 #include <vulkan/vulkan.hpp>
 
+#include "graphics/memory_allocator.h"
+
 namespace gfx {
 class Device;
 
+/** \brief A device memory allocation sub-allocated from a block owned by the device memory allocator. */
 class Memory {
 public:
   Memory(const Device& device,
          const vk::MemoryRequirements& memory_requirements,
-         vk::MemoryPropertyFlags memory_property_flags);
+         vk::MemoryPropertyFlags memory_property_flags,
+         MemoryAllocator::ResourceTiling resource_tiling);
 
   Memory(const Memory&) = delete;
   Memory(Memory&& memory) noexcept { *this = std::move(memory); }
@@ -20,17 +24,21 @@ public:
   Memory& operator=(const Memory&) = delete;
   Memory& operator=(Memory&& memory) noexcept;
 
-  ~Memory() noexcept { Unmap(); }
+  ~Memory() noexcept { Free(); }
+
+  [[nodiscard]] vk::DeviceMemory operator*() const noexcept { return allocation_.memory; }
 
-  [[nodiscard]] vk::DeviceMemory operator*() const noexcept { return *memory_; }
+  /** \brief Gets the offset of the allocation in its device memory block to bind resources at. */
+  [[nodiscard]] vk::DeviceSize offset() const noexcept { return allocation_.offset; }
 
-  [[nodiscard]] void* Map();
-  void Unmap() noexcept;
+  /** \brief Gets a host pointer to the allocation which remains valid for the lifetime of the allocation. */
+  [[nodiscard]] void* Map() const { return memory_allocator_->Map(allocation_); }
 
 private:
-  vk::Device device_;
-  vk::UniqueDeviceMemory memory_;
-  void* mapped_memory_ = nullptr;
+  void Free() noexcept;
+
+  MemoryAllocator* memory_allocator_ = nullptr;
+  MemoryAllocator::Allocation allocation_;
 };
 
 }  // namespace gfx
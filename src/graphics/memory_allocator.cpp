@@ -0,0 +1,122 @@
+#include "graphics/memory_allocator.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <stdexcept>
+
+namespace gfx {
+
+MemoryAllocator::MemoryAllocator(const vk::PhysicalDevice physical_device,
+                                 const vk::Device device,
+                                 const vk::DeviceSize block_size)
+    : device_{device},
+      memory_properties_{physical_device.getMemoryProperties()},
+      block_size_{block_size} {}
+
+MemoryAllocator::~MemoryAllocator() noexcept {
+#ifndef NDEBUG
+  for (const auto& memory_type_blocks : blocks_) {
+    for (const auto& block : memory_type_blocks) assert(block->free_list_allocator.empty());
+  }
+#endif
+}
+
+MemoryAllocator::Allocation MemoryAllocator::Allocate(const vk::MemoryRequirements& memory_requirements,
+                                                      const vk::MemoryPropertyFlags memory_property_flags,
+                                                      const ResourceTiling resource_tiling) {
+  const auto memory_type_index = FindMemoryTypeIndex(memory_requirements.memoryTypeBits, memory_property_flags);
+  const auto size = memory_requirements.size;
+  const auto alignment = memory_requirements.alignment;
+
+  const std::scoped_lock lock{mutex_};
+  auto& memory_type_blocks = blocks_[memory_type_index];  // NOLINT(cppcoreguidelines-pro-bounds-constant-array-index)
+
+  const auto is_dedicated = size > block_size_ / 2;
+  if (!is_dedicated) {
+    for (const auto& block : memory_type_blocks) {
+      // blocks never mix linear and optimal resources so allocations need no buffer-image granularity padding
+      if (block->is_dedicated || block->resource_tiling != resource_tiling) continue;
+      if (const auto offset = block->free_list_allocator.Allocate(size, alignment); offset.has_value()) {
+        return Allocation{.memory = *block->memory, .offset = *offset, .size = size, .block = block.get()};
+      }
+    }
+  }
+
+  const auto block_size = is_dedicated ? size : block_size_;
+  auto& block = memory_type_blocks.emplace_back(std::make_unique<Block>(Block{
+      .memory = device_.allocateMemoryUnique(
+          vk::MemoryAllocateInfo{.allocationSize = block_size, .memoryTypeIndex = memory_type_index}),
+      .free_list_allocator = FreeListAllocator{block_size},
+      .memory_type_index = memory_type_index,
+      .resource_tiling = resource_tiling,
+      .is_dedicated = is_dedicated}));
+
+  const auto offset = block->free_list_allocator.Allocate(size, alignment);
+  assert(offset.has_value());
+  return Allocation{.memory = *block->memory, .offset = *offset, .size = size, .block = block.get()};
+}
+
+void MemoryAllocator::Free(const Allocation& allocation) noexcept {
+  if (allocation.block == nullptr) return;
+
+  const std::scoped_lock lock{mutex_};
+  auto& block = *allocation.block;
+  block.free_list_allocator.Free(allocation.offset);
+  if (!block.free_list_allocator.empty()) return;
+
+  // keep one empty shared block per memory type and tiling to avoid reallocating device memory when resources are
+  // recreated
+  auto& memory_type_blocks = blocks_[block.memory_type_index];  // NOLINT(*-pro-bounds-constant-array-index)
+  const auto is_empty_shared_block = [&block](const auto& other_block) {
+    return other_block.get() != &block && !other_block->is_dedicated
+           && other_block->resource_tiling == block.resource_tiling && other_block->free_list_allocator.empty();
+  };
+  if (block.is_dedicated || std::ranges::any_of(memory_type_blocks, is_empty_shared_block)) {
+    std::erase_if(memory_type_blocks, [&block](const auto& other_block) { return other_block.get() == &block; });
+  }
+}
+
+void* MemoryAllocator::Map(const Allocation& allocation) {
+  assert(allocation.block != nullptr);
+  const std::scoped_lock lock{mutex_};
+  auto& block = *allocation.block;
+  if (block.mapped_memory == nullptr) {
+    block.mapped_memory = device_.mapMemory(*block.memory, 0, vk::WholeSize);
+    assert(block.mapped_memory != nullptr);
+  }
+  return static_cast<std::byte*>(block.mapped_memory) + allocation.offset;
+}
+
+MemoryStatistics MemoryAllocator::GetStatistics() const {
+  const std::scoped_lock lock{mutex_};
+  MemoryStatistics memory_statistics;
+  for (const auto& memory_type_blocks : blocks_) {
+    for (const auto& block : memory_type_blocks) {
+      const auto& free_list_allocator = block->free_list_allocator;
+      ++memory_statistics.block_count;
+      memory_statistics.allocation_count += free_list_allocator.allocation_count();
+      memory_statistics.block_size += free_list_allocator.size();
+      memory_statistics.allocated_size += free_list_allocator.allocated_size();
+      memory_statistics.free_range_count += free_list_allocator.free_range_count();
+      memory_statistics.largest_free_range_size =
+          std::max(memory_statistics.largest_free_range_size, free_list_allocator.largest_free_range_size());
+    }
+  }
+  return memory_statistics;
+}
+
+std::uint32_t MemoryAllocator::FindMemoryTypeIndex(const std::uint32_t memory_type_bits,
+                                                   const vk::MemoryPropertyFlags memory_property_flags) const {
+  for (std::uint32_t index = 0; index < memory_properties_.memoryTypeCount; ++index) {
+    const auto memory_type_bit = 1u << index;
+    const auto property_flags = memory_properties_.memoryTypes[index].propertyFlags;
+    if ((memory_type_bits & memory_type_bit) == memory_type_bit
+        && (memory_property_flags & property_flags) == memory_property_flags) {
+      return index;
+    }
+  }
+  throw std::runtime_error{"Unsupported memory type"};
+}
+
+}  // namespace gfx
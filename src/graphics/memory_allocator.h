@@ -0,0 +1,116 @@
+#ifndef GRAPHICS_MEMORY_ALLOCATOR_H_
+#define GRAPHICS_MEMORY_ALLOCATOR_H_
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <vulkan/vulkan.hpp>
+
+#include "graphics/free_list_allocator.h"
+
+namespace gfx {
+
+/** \brief Device memory usage across every block owned by a \ref MemoryAllocator. */
+struct MemoryStatistics {
+  std::size_t block_count = 0;
+  std::size_t allocation_count = 0;
+  vk::DeviceSize block_size = 0;
+  vk::DeviceSize allocated_size = 0;
+  std::size_t free_range_count = 0;
+
+  /** \brief The size of the largest free range in any block which is small relative to the free size if fragmented. */
+  vk::DeviceSize largest_free_range_size = 0;
+};
+
+/**
+ * \brief Sub-allocates buffer and image memory from large device memory blocks per memory type.
+ * \details Allocating device memory is slow and the number of allocations is limited by \c maxMemoryAllocationCount so
+ *          resources are placed in shared blocks managed by a \ref FreeListAllocator. Allocations larger than half a
+ *          block receive a dedicated block. Linear resources and optimal-tiling images are placed in separate blocks so
+ *          they never share a page within \c bufferImageGranularity without padding every allocation to it.
+ *          Host-visible blocks are mapped once when first requested and remain mapped until the block is freed. This
+ *          class is thread-safe.
+ */
+class MemoryAllocator {
+  struct Block;
+
+public:
+  /** \brief The default size of a shared device memory block in bytes. */
+  static constexpr vk::DeviceSize kDefaultBlockSize = vk::DeviceSize{64} << 20U;
+
+  /** \brief The tiling of a resource which determines the blocks it can share with other resources. */
+  enum class ResourceTiling { kLinear, kOptimal };
+
+  /** \brief A range of device memory in a block. */
+  struct Allocation {
+    vk::DeviceMemory memory;
+    vk::DeviceSize offset = 0;
+    vk::DeviceSize size = 0;
+    Block* block = nullptr;
+  };
+
+  /**
+   * \brief Initializes a memory allocator.
+   * \param physical_device The physical device whose memory types are allocated from.
+   * \param device The logical device to allocate memory with.
+   * \param block_size The size of shared device memory blocks in bytes.
+   */
+  MemoryAllocator(vk::PhysicalDevice physical_device,
+                  vk::Device device,
+                  vk::DeviceSize block_size = kDefaultBlockSize);
+
+  MemoryAllocator(const MemoryAllocator&) = delete;
+  MemoryAllocator(MemoryAllocator&&) = delete;
+
+  MemoryAllocator& operator=(const MemoryAllocator&) = delete;
+  MemoryAllocator& operator=(MemoryAllocator&&) = delete;
+
+  ~MemoryAllocator() noexcept;
+
+  /**
+   * \brief Allocates device memory.
+   * \param memory_requirements The size, alignment and supported memory types of the resource bound to the memory.
+   * \param memory_property_flags The required properties of the memory type.
+   * \param resource_tiling The tiling of the resource which is linear for buffers and linear-tiling images.
+   * \throw std::runtime_error Thrown if no memory type supports \p memory_property_flags.
+   */
+  [[nodiscard]] Allocation Allocate(const vk::MemoryRequirements& memory_requirements,
+                                    vk::MemoryPropertyFlags memory_property_flags,
+                                    ResourceTiling resource_tiling);
+
+  /** \brief Frees an allocation and releases its block if the block is no longer used. */
+  void Free(const Allocation& allocation) noexcept;
+
+  /** \brief Gets a host pointer to a host-visible allocation. */
+  [[nodiscard]] void* Map(const Allocation& allocation);
+
+  [[nodiscard]] MemoryStatistics GetStatistics() const;
+
+private:
+  struct Block {
+    vk::UniqueDeviceMemory memory;
+    FreeListAllocator free_list_allocator;
+    std::uint32_t memory_type_index = 0;
+    ResourceTiling resource_tiling = ResourceTiling::kLinear;
+    bool is_dedicated = false;
+    void* mapped_memory = nullptr;
+  };
+
+  std::uint32_t FindMemoryTypeIndex(std::uint32_t memory_type_bits,
+                                    vk::MemoryPropertyFlags memory_property_flags) const;
+
+  vk::Device device_;
+  vk::PhysicalDeviceMemoryProperties memory_properties_;
+  vk::DeviceSize block_size_;
+
+  std::array<std::vector<std::unique_ptr<Block>>, VK_MAX_MEMORY_TYPES> blocks_;
+  mutable std::mutex mutex_;
+};
+
+}  // namespace gfx
+
+#endif  // GRAPHICS_MEMORY_ALLOCATOR_H_
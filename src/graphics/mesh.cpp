@@ -1,46 +1,121 @@
 #include "graphics/mesh.h"
 
+#include <algorithm>
+#include <array>
 #include <cassert>
+#include <cstddef>
+#include <limits>
+#include <ranges>
+#include <span>
+#include <utility>
 
 #include "graphics/device.h"
 
 namespace {
 
-template <typename T>
-gfx::Buffer CreateDeviceLocalBuffer(const gfx::Device& device,
-                                    const vk::BufferUsageFlags buffer_usage_flags,
-                                    const std::vector<T>& data) {
-  const auto size_bytes = sizeof(T) * data.size();
-
-  gfx::Buffer host_visible_buffer{device,
-                                  size_bytes,
-                                  vk::BufferUsageFlagBits::eTransferSrc,
-                                  vk::MemoryPropertyFlagBits::eHostVisible};
-  host_visible_buffer.Copy<const T>(data);
-
-  gfx::Buffer device_local_buffer{device,
-                                  size_bytes,
-                                  buffer_usage_flags | vk::BufferUsageFlagBits::eTransferDst,
-                                  vk::MemoryPropertyFlagBits::eDeviceLocal};
-  device_local_buffer.Copy(device, host_visible_buffer);
+std::vector<glm::vec3> GetPositions(const std::vector<gfx::Mesh::Vertex>& vertices) {
+  return vertices | std::views::transform(&gfx::Mesh::Vertex::position) | std::ranges::to<std::vector>();
+}
 
-  return device_local_buffer;
+gfx::Buffer CreateVertexBuffer(const gfx::Device& device,
+                               const std::vector<gfx::Mesh::Vertex>& vertices,
+                               const gfx::QuantizationBounds& quantization_bounds) {
+  const auto packed_vertices = vertices | std::views::transform([&](const gfx::Mesh::Vertex& vertex) {
+                                 return gfx::PackVertex(vertex.position,
+                                                        vertex.texture_coordinates,
+                                                        vertex.normal,
+                                                        quantization_bounds);
+                               })
+                               | std::ranges::to<std::vector>();
+  return device.upload_queue().CreateBuffer(device, vk::BufferUsageFlagBits::eVertexBuffer, packed_vertices);
 }
 
 }  // namespace
 
 namespace gfx {
 
+vk::IndexType GetIndexType(const std::size_t vertex_count) noexcept {
+  // primitive restart is disabled so every 16-bit value including 0xFFFF is a valid vertex index
+  static constexpr std::size_t kMaxUint16VertexCount = std::numeric_limits<std::uint16_t>::max() + std::size_t{1};
+  return vertex_count <= kMaxUint16VertexCount ? vk::IndexType::eUint16 : vk::IndexType::eUint32;
+}
+
+Buffer CreateIndexBuffer(const Device& device,
+                         const std::vector<std::uint32_t>& indices,
+                         const vk::IndexType index_type) {
+  auto& upload_queue = device.upload_queue();
+  if (index_type == vk::IndexType::eUint32) {
+    return upload_queue.CreateBuffer(device, vk::BufferUsageFlagBits::eIndexBuffer, indices);
+  }
+  const auto uint16_indices =
+      indices | std::views::transform([](const auto index) { return static_cast<std::uint16_t>(index); })
+      | std::ranges::to<std::vector>();
+  return upload_queue.CreateBuffer(device, vk::BufferUsageFlagBits::eIndexBuffer, uint16_indices);
+}
+
 Mesh::Mesh(const Device& device,
-           const std::vector<Vertex>& vertices,
-           const std::vector<std::uint32_t>& indices,
+           std::vector<Vertex> vertices,
+           std::vector<std::uint32_t> indices,
            const glm::mat4& transform)
-    : vertices_{vertices},
-      indices_{indices},
+    : vertices_{std::move(vertices)},
+      indices_{std::move(indices)},
       transform_{transform},
-      vertex_buffer_{CreateDeviceLocalBuffer(device, vk::BufferUsageFlagBits::eVertexBuffer, vertices_)},
-      index_buffer_{CreateDeviceLocalBuffer(device, vk::BufferUsageFlagBits::eIndexBuffer, indices_)} {
+      quantization_bounds_{CreateQuantizationBounds(GetPositions(vertices_))},
+      index_type_{GetIndexType(vertices_.size())},
+      vertex_buffer_{CreateVertexBuffer(device, vertices_, quantization_bounds_)},
+      index_buffer_{CreateIndexBuffer(device, indices_, index_type_)} {
   assert(indices_.size() % 3 == 0);
+  auto& upload_queue = device.upload_queue();
+  pending_upload_ = PendingUpload{upload_queue, upload_queue.Submit()};
+}
+
+void Mesh::BuildMeshlets() {
+  const std::array index_ranges{IndexRange{.index_count = static_cast<std::uint32_t>(indices_.size())}};
+  BuildMeshlets(index_ranges);
+}
+
+void Mesh::BuildMeshlets(const std::span<const IndexRange> index_ranges) {
+  const auto positions = GetPositions(vertices_);
+  meshlets_.clear();
+  for (const auto& index_range : index_ranges) {
+    assert(index_range.first_index + index_range.index_count <= indices_.size());
+    const auto range_indices = std::span{indices_}.subspan(index_range.first_index, index_range.index_count);
+    for (auto meshlet : CreateMeshlets(positions, range_indices)) {
+      meshlet.first_index += index_range.first_index;
+      meshlets_.push_back(meshlet);
+    }
+  }
+  std::ranges::sort(meshlets_, {}, &Meshlet::first_index);
+}
+
+void Mesh::Render(const vk::CommandBuffer command_buffer,
+                  const IndexRange& index_range,
+                  const MeshletCuller& meshlet_culler) const {
+  // meshlets are stored in index buffer order so the meshlets of a range are found with a binary search
+  const auto end_index = index_range.first_index + index_range.index_count;
+  const auto range_begin = std::ranges::lower_bound(meshlets_, index_range.first_index, {}, &Meshlet::first_index);
+  const auto range_end = std::ranges::lower_bound(range_begin, meshlets_.end(), end_index, {}, &Meshlet::first_index);
+  if (range_begin == range_end) {
+    Render(command_buffer, index_range.first_index, index_range.index_count);
+    return;
+  }
+
+  command_buffer.bindVertexBuffers(0, *vertex_buffer_, static_cast<vk::DeviceSize>(0));
+  command_buffer.bindIndexBuffer(*index_buffer_, 0, index_type_);
+
+  // consecutive visible meshlets form a single contiguous index range
+  std::uint32_t first_index = 0;
+  std::uint32_t index_count = 0;
+  for (const auto& meshlet : std::ranges::subrange(range_begin, range_end)) {
+    if (!meshlet_culler.IsVisible(meshlet)) continue;
+    if (first_index + index_count != meshlet.first_index) {
+      if (index_count > 0) command_buffer.drawIndexed(index_count, 1, first_index, 0, 0);
+      first_index = meshlet.first_index;
+      index_count = 0;
+    }
+    index_count += meshlet.index_count;
+  }
+  if (index_count > 0) command_buffer.drawIndexed(index_count, 1, first_index, 0, 0);
 }
 
 }  // namespace gfx
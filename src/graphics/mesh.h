@@ -1,6 +1,9 @@
 #ifndef GRAPHICS_MESH_H_
 #define GRAPHICS_MESH_H_
 
+#include <cstddef>
+#include <cstdint>
+#include <span>
 #include <vector>
 
 #include <glm/gtc/matrix_transform.hpp>
@@ -8,10 +11,19 @@
 #include <vulkan/vulkan.hpp>
 
 #include "graphics/buffer.h"
+#include "graphics/meshlet.h"
+#include "graphics/packed_vertex.h"
+#include "graphics/upload_queue.h"
 
 namespace gfx {
 class Device;
 
+/** \brief A range of a mesh index buffer that renders one level of detail. */
+struct IndexRange {
+  std::uint32_t first_index = 0;
+  std::uint32_t index_count = 0;
+};
+
 class Mesh {
 public:
   struct Vertex {
@@ -21,32 +33,104 @@ public:
   };
 
   Mesh(const Device& device,
-       const std::vector<Vertex>& vertices,
-       const std::vector<std::uint32_t>& indices,
+       std::vector<Vertex> vertices,
+       std::vector<std::uint32_t> indices,
        const glm::mat4& transform = glm::mat4{1.0f});
 
+  Mesh(const Mesh&) = delete;
+  Mesh(Mesh&&) noexcept = default;
+
+  Mesh& operator=(const Mesh&) = delete;
+  Mesh& operator=(Mesh&&) noexcept = default;
+
+  ~Mesh() noexcept { pending_upload_.Wait(); }
+
   [[nodiscard]] const std::vector<Vertex>& vertices() const noexcept { return vertices_; }
   [[nodiscard]] const std::vector<std::uint32_t>& indices() const noexcept { return indices_; }
   [[nodiscard]] const glm::mat4& transform() const noexcept { return transform_; }
 
+  /**
+   * \brief Gets the meshlets which partition the index buffer into ranges that can be culled independently.
+   * \details Meshlets are empty until \ref BuildMeshlets is called.
+   */
+  [[nodiscard]] const std::vector<Meshlet>& meshlets() const noexcept { return meshlets_; }
+
+  /** \brief Gets the bounds used to quantize positions in the device-local vertex buffer. */
+  [[nodiscard]] const QuantizationBounds& quantization_bounds() const noexcept { return quantization_bounds_; }
+
+  /**
+   * \brief Determines if the mesh has been copied to device-local buffers and can be rendered.
+   * \details Meshes are uploaded asynchronously on the device upload queue. Destroying or reassigning a mesh blocks
+   *          until its upload completes.
+   */
+  [[nodiscard]] bool IsUploaded() const { return pending_upload_.IsComplete(); }
+
+  /**
+   * \brief Partitions the index buffer into meshlets which allows the mesh to be rendered with meshlet culling.
+   * \details Meshlets are only built on request since most meshes such as simplification intermediates are never
+   *          rendered through the culling path.
+   */
+  void BuildMeshlets();
+
+  /**
+   * \brief Partitions each range of the index buffer into meshlets such that no meshlet spans two ranges.
+   * \param index_ranges Non-overlapping ranges of the index buffer such as the levels of detail in a shared index
+   *                     buffer.
+   */
+  void BuildMeshlets(std::span<const IndexRange> index_ranges);
+
   void Translate(const glm::vec3& translation) { transform_ = glm::translate(transform_, translation); }
   void Rotate(const glm::vec3& axis, const float angle) { transform_ = glm::rotate(transform_, angle, axis); }
   void Scale(const glm::vec3& scale) { transform_ = glm::scale(transform_, scale); }
 
   void Render(const vk::CommandBuffer command_buffer) const {
+    Render(command_buffer, 0, static_cast<std::uint32_t>(indices_.size()));
+  }
+
+  /** \brief Renders a contiguous range of triangles such as a single level of detail in a shared index buffer. */
+  void Render(const vk::CommandBuffer command_buffer,
+              const std::uint32_t first_index,
+              const std::uint32_t index_count) const {
     command_buffer.bindVertexBuffers(0, *vertex_buffer_, static_cast<vk::DeviceSize>(0));
-    command_buffer.bindIndexBuffer(*index_buffer_, 0, vk::IndexType::eUint32);
-    command_buffer.drawIndexed(static_cast<std::uint32_t>(indices_.size()), 1, 0, 0, 0);
+    command_buffer.bindIndexBuffer(*index_buffer_, 0, index_type_);
+    command_buffer.drawIndexed(index_count, 1, first_index, 0, 0);
+  }
+
+  /** \brief Renders meshlets that are not culled where adjacent visible meshlets are merged into a single draw. */
+  void Render(const vk::CommandBuffer command_buffer, const MeshletCuller& meshlet_culler) const {
+    Render(command_buffer, IndexRange{.index_count = static_cast<std::uint32_t>(indices_.size())}, meshlet_culler);
   }
 
+  /**
+   * \brief Renders the meshlets of a range of the index buffer that are not culled.
+   * \details If no meshlets were built for the range, the entire range is rendered without culling.
+   */
+  void Render(vk::CommandBuffer command_buffer,
+              const IndexRange& index_range,
+              const MeshletCuller& meshlet_culler) const;
+
 private:
   std::vector<Vertex> vertices_;
   std::vector<std::uint32_t> indices_;
   glm::mat4 transform_;
+  std::vector<Meshlet> meshlets_;
+  QuantizationBounds quantization_bounds_;
+  vk::IndexType index_type_;
+
+  /** \brief The pending upload to the buffers below which is reassigned before the buffers when moving a mesh. */
+  PendingUpload pending_upload_;
   Buffer vertex_buffer_;
   Buffer index_buffer_;
 };
 
+/** \brief Gets the smallest index type that can reference \p vertex_count vertices. */
+[[nodiscard]] vk::IndexType GetIndexType(std::size_t vertex_count) noexcept;
+
+/** \brief Creates a device-local index buffer and uploads \p indices converted to \p index_type. */
+[[nodiscard]] Buffer CreateIndexBuffer(const Device& device,
+                                       const std::vector<std::uint32_t>& indices,
+                                       vk::IndexType index_type);
+
 }  // namespace gfx
 
 #endif  // GRAPHICS_MESH_H_
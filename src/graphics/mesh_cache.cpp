@@ -0,0 +1,104 @@
+#include "graphics/mesh_cache.h"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <format>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <glm/mat4x4.hpp>
+
+#include "graphics/atomic_file.h"
+#include "graphics/mapped_file.h"
+#include "graphics/mesh.h"
+
+namespace {
+
+constexpr std::array kMagic{'G', 'F', 'X', 'M'};
+
+// increment when the header or the vertex layout changes to invalidate existing cache files
+constexpr std::uint32_t kVersion = 1;
+
+struct Header {
+  std::array<char, 4> magic{};
+  std::uint32_t version = 0;
+  std::uint32_t vertex_size = 0;
+  std::uint32_t index_size = 0;
+  std::uint64_t vertex_count = 0;
+  std::uint64_t index_count = 0;
+  glm::mat4 transform{1.0f};
+};
+
+static_assert(std::is_trivially_copyable_v<Header>);
+static_assert(std::is_trivially_copyable_v<gfx::Mesh::Vertex>);
+
+/** \brief Copies an array out of the file mapping without assuming its elements are aligned. */
+template <typename T>
+std::vector<T> Read(const std::span<const std::byte> data, const std::size_t count) {
+  std::vector<T> values(count);
+  std::memcpy(values.data(), data.data(), sizeof(T) * count);
+  return values;
+}
+
+}  // namespace
+
+namespace gfx {
+
+void mesh_cache::SaveMesh(const Mesh& mesh, const std::filesystem::path& filepath) {
+  const auto& vertices = mesh.vertices();
+  const auto& indices = mesh.indices();
+  const Header header{.magic = kMagic,
+                      .version = kVersion,
+                      .vertex_size = sizeof(Mesh::Vertex),
+                      .index_size = sizeof(std::uint32_t),
+                      .vertex_count = vertices.size(),
+                      .index_count = indices.size(),
+                      .transform = mesh.transform()};
+
+  // an interrupted or concurrent write must never leave a partial cache file that is newer than its source file
+  WriteFileAtomically(
+      filepath,
+      {std::as_bytes(std::span{&header, 1}), std::as_bytes(std::span{vertices}), std::as_bytes(std::span{indices})});
+}
+
+Mesh mesh_cache::LoadMesh(const Device& device, const std::filesystem::path& filepath) {
+  const MappedFile mapped_file{filepath};
+  const auto data = mapped_file.data();
+
+  if (data.size() < sizeof(Header)) {
+    throw std::runtime_error{std::format("Invalid mesh cache file {}", filepath.string())};
+  }
+  Header header;
+  std::memcpy(&header, data.data(), sizeof(Header));
+
+  if (header.magic != kMagic || header.version != kVersion || header.vertex_size != sizeof(Mesh::Vertex)
+      || header.index_size != sizeof(std::uint32_t)) {
+    throw std::runtime_error{std::format("Incompatible mesh cache file {}", filepath.string())};
+  }
+
+  const auto vertex_data = data.subspan(sizeof(Header));
+  if (header.vertex_count > vertex_data.size() / sizeof(Mesh::Vertex)) {
+    throw std::runtime_error{std::format("Invalid mesh cache file {}", filepath.string())};
+  }
+  const auto index_data = vertex_data.subspan(header.vertex_count * sizeof(Mesh::Vertex));
+  if (header.index_count != index_data.size() / sizeof(std::uint32_t)
+      || index_data.size() % sizeof(std::uint32_t) != 0 || header.index_count % 3 != 0) {
+    throw std::runtime_error{std::format("Invalid mesh cache file {}", filepath.string())};
+  }
+
+  auto indices = Read<std::uint32_t>(index_data, header.index_count);
+  if (std::ranges::any_of(indices, [&](const auto index) { return index >= header.vertex_count; })) {
+    throw std::runtime_error{std::format("Invalid mesh cache file {}", filepath.string())};
+  }
+
+  return Mesh{device, Read<Mesh::Vertex>(vertex_data, header.vertex_count), std::move(indices), header.transform};
+}
+
+}  // namespace gfx
@@ -0,0 +1,37 @@
+#ifndef GRAPHICS_MESH_CACHE_H_
+#define GRAPHICS_MESH_CACHE_H_
+
+#include <filesystem>
+
+namespace gfx {
+class Device;
+class Mesh;
+
+namespace mesh_cache {
+
+/**
+ * \brief Saves a mesh to a binary mesh cache file.
+ * \details The file consists of a versioned header followed by the raw vertex and index arrays of the mesh in native
+ *          byte order which allows the mesh to be loaded without parsing. Cache files are therefore not portable across
+ *          platforms with different byte orders or vertex layouts. The file is written to a temporary file which is
+ *          then renamed so that a partially written cache file is never observed at the given path.
+ * \param mesh The mesh to save.
+ * \param filepath The path of the mesh cache file to write.
+ * \throw std::runtime_error Thrown if the mesh cache file cannot be written.
+ */
+void SaveMesh(const Mesh& mesh, const std::filesystem::path& filepath);
+
+/**
+ * \brief Loads a mesh from a binary mesh cache file.
+ * \param device The graphics device used to load mesh data into GPU memory.
+ * \param filepath The path of the mesh cache file to load.
+ * \return The mesh saved in the mesh cache file.
+ * \throw std::runtime_error Thrown if the mesh cache file cannot be opened, was written by an incompatible version, is
+ *                           truncated, or contains an index which does not reference a vertex.
+ */
+Mesh LoadMesh(const Device& device, const std::filesystem::path& filepath);
+
+}  // namespace mesh_cache
+}  // namespace gfx
+
+#endif  // GRAPHICS_MESH_CACHE_H_
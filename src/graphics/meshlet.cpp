@@ -0,0 +1,138 @@
+#include "graphics/meshlet.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+
+#include <glm/glm.hpp>
+
+namespace {
+
+/** \brief Computes the bounding sphere and normal cone of a range of triangles. */
+gfx::Meshlet CreateMeshlet(const std::span<const glm::vec3> positions,
+                           const std::span<const std::uint32_t> indices,
+                           const std::uint32_t first_index,
+                           const std::uint32_t index_count) {
+  const auto meshlet_indices = indices.subspan(first_index, index_count);
+
+  // bound the meshlet with a sphere centered at its axis-aligned bounding box
+  auto min_position = glm::vec3{std::numeric_limits<float>::max()};
+  auto max_position = glm::vec3{std::numeric_limits<float>::lowest()};
+  for (const auto index : meshlet_indices) {
+    min_position = glm::min(min_position, positions[index]);
+    max_position = glm::max(max_position, positions[index]);
+  }
+  const auto center = (min_position + max_position) / 2.0f;
+  auto radius = 0.0f;
+  for (const auto index : meshlet_indices) radius = std::max(radius, glm::distance(center, positions[index]));
+
+  // bound triangle normals with a cone around their average direction
+  const auto for_each_normal = [&](const auto& function) {
+    for (std::size_t i = 0; i < meshlet_indices.size(); i += 3) {
+      const auto& p0 = positions[meshlet_indices[i]];
+      const auto& p1 = positions[meshlet_indices[i + 1]];
+      const auto& p2 = positions[meshlet_indices[i + 2]];
+      if (const auto normal = glm::cross(p1 - p0, p2 - p0); glm::length(normal) > 0.0f) {
+        function(glm::normalize(normal));
+      }
+    }
+  };
+
+  auto meshlet =
+      gfx::Meshlet{.first_index = first_index, .index_count = index_count, .center = center, .radius = radius};
+  auto normal_sum = glm::vec3{0.0f};
+  for_each_normal([&](const glm::vec3& normal) { normal_sum += normal; });
+  const auto normal_sum_length = glm::length(normal_sum);
+  if (normal_sum_length == 0.0f) return meshlet;
+
+  meshlet.cone_axis = normal_sum / normal_sum_length;
+  auto min_dot = 1.0f;
+  for_each_normal([&](const glm::vec3& normal) { min_dot = std::min(min_dot, glm::dot(normal, meshlet.cone_axis)); });
+
+  // a cone spanning a hemisphere or more contains normals facing every direction and can never be backface culled
+  meshlet.cone_cutoff = min_dot <= 0.0f ? 1.0f : std::sqrt(1.0f - min_dot * min_dot);
+  return meshlet;
+}
+
+}  // namespace
+
+namespace gfx {
+
+std::vector<Meshlet> CreateMeshlets(const std::span<const glm::vec3> positions,
+                                    const std::span<const std::uint32_t> indices,
+                                    const std::uint32_t max_vertex_count,
+                                    const std::uint32_t max_triangle_count) {
+  assert(indices.size() % 3 == 0);
+  assert(max_vertex_count >= 3 && max_triangle_count >= 1);
+
+  // mark vertices with the ID of the meshlet that last referenced them to count unique vertices per meshlet
+  std::vector<std::uint32_t> vertex_meshlets(positions.size(), std::numeric_limits<std::uint32_t>::max());
+  std::vector<Meshlet> meshlets;
+  std::uint32_t first_index = 0;
+  std::uint32_t vertex_count = 0;
+
+  const auto count_new_vertices = [&](const std::span<const std::uint32_t> triangle, const std::uint32_t meshlet_id) {
+    auto new_vertex_count = 0u;
+    for (std::size_t i = 0; i < triangle.size(); ++i) {
+      const auto vertex = triangle[i];
+      const auto is_repeated = std::ranges::find(triangle.first(i), vertex) != triangle.first(i).end();
+      if (vertex_meshlets[vertex] != meshlet_id && !is_repeated) ++new_vertex_count;
+    }
+    return new_vertex_count;
+  };
+
+  for (std::uint32_t index = 0; index < indices.size(); index += 3) {
+    const auto triangle = indices.subspan(index, 3);
+    auto meshlet_id = static_cast<std::uint32_t>(meshlets.size());
+    auto new_vertex_count = count_new_vertices(triangle, meshlet_id);
+
+    if (const auto triangle_count = (index - first_index) / 3;
+        triangle_count > 0
+        && (vertex_count + new_vertex_count > max_vertex_count || triangle_count == max_triangle_count)) {
+      meshlets.push_back(CreateMeshlet(positions, indices, first_index, index - first_index));
+      first_index = index;
+      vertex_count = 0;
+      new_vertex_count = count_new_vertices(triangle, ++meshlet_id);
+    }
+
+    for (const auto vertex : triangle) vertex_meshlets[vertex] = meshlet_id;
+    vertex_count += new_vertex_count;
+  }
+
+  if (first_index < indices.size()) {
+    meshlets.push_back(
+        CreateMeshlet(positions, indices, first_index, static_cast<std::uint32_t>(indices.size()) - first_index));
+  }
+
+  return meshlets;
+}
+
+MeshletCuller::MeshletCuller(const glm::mat4& model_view_transform, const glm::mat4& projection_transform) {
+  // extract frustum planes from the rows of the model-view-projection transform which yields planes in model space
+  const auto transform = projection_transform * model_view_transform;
+  const auto row = [&](const glm::length_t i) {
+    return glm::vec4{transform[0][i], transform[1][i], transform[2][i], transform[3][i]};
+  };
+  frustum_planes_ = {row(3) + row(0), row(3) - row(0), row(3) + row(1), row(3) - row(1), row(2), row(3) - row(2)};
+  for (auto& plane : frustum_planes_) plane /= glm::length(glm::vec3{plane});
+
+  camera_position_ = glm::vec3{glm::inverse(model_view_transform)[3]};
+}
+
+bool MeshletCuller::IsVisible(const Meshlet& meshlet) const noexcept {
+  if (std::ranges::any_of(frustum_planes_, [&](const glm::vec4& plane) {
+        return glm::dot(glm::vec3{plane}, meshlet.center) + plane.w < -meshlet.radius;
+      })) {
+    return false;
+  }
+
+  // the meshlet faces away from the camera if the camera is behind the plane of every triangle which holds when the
+  // direction to the camera from any point in the bounding sphere is outside the dual of the normal cone
+  const auto view_direction = meshlet.center - camera_position_;
+  return glm::dot(view_direction, meshlet.cone_axis)
+         < meshlet.cone_cutoff * glm::length(view_direction) + meshlet.radius;
+}
+
+}  // namespace gfx
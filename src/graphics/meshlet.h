@@ -0,0 +1,76 @@
+#ifndef GRAPHICS_MESHLET_H_
+#define GRAPHICS_MESHLET_H_
+
+#include <array>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include <glm/mat4x4.hpp>
+#include <glm/vec3.hpp>
+#include <glm/vec4.hpp>
+
+namespace gfx {
+
+/** \brief The default maximum number of unique vertices referenced by a meshlet. */
+inline constexpr std::uint32_t kMaxMeshletVertexCount = 64;
+
+/** \brief The default maximum number of triangles in a meshlet. */
+inline constexpr std::uint32_t kMaxMeshletTriangleCount = 124;
+
+/** \brief A contiguous range of triangles in an index buffer with bounds used to cull the range as a unit. */
+struct Meshlet {
+  std::uint32_t first_index = 0;
+  std::uint32_t index_count = 0;
+
+  /** \brief The center of a sphere in model space that bounds every triangle in the meshlet. */
+  glm::vec3 center{0.0f};
+  float radius = 0.0f;
+
+  /** \brief The average unit normal of the meshlet triangles. */
+  glm::vec3 cone_axis{0.0f};
+
+  /**
+   * \brief The sine of the maximum angle between a triangle normal and the cone axis or 1 if the normals span a
+   *        hemisphere or more in which case the meshlet is never backface culled.
+   */
+  float cone_cutoff = 1.0f;
+};
+
+/**
+ * \brief Partitions an index buffer into meshlets of consecutive triangles.
+ * \details Triangles are added to a meshlet in index buffer order until the next triangle would exceed either bound so
+ *          meshlets are most compact when the index buffer is ordered for vertex locality.
+ * \param positions The vertex positions referenced by \p indices.
+ * \param indices The vertex indices of each triangle in counter-clockwise order.
+ * \param max_vertex_count The maximum number of unique vertices referenced by a meshlet.
+ * \param max_triangle_count The maximum number of triangles in a meshlet.
+ * \return Meshlets which cover \p indices in order.
+ */
+std::vector<Meshlet> CreateMeshlets(std::span<const glm::vec3> positions,
+                                    std::span<const std::uint32_t> indices,
+                                    std::uint32_t max_vertex_count = kMaxMeshletVertexCount,
+                                    std::uint32_t max_triangle_count = kMaxMeshletTriangleCount);
+
+/** \brief Determines which meshlets are outside the view frustum or face away from the camera. */
+class MeshletCuller {
+public:
+  /**
+   * \brief Initializes a meshlet culler.
+   * \param model_view_transform The transform from model space to view space.
+   * \param projection_transform The transform from view space to clip space with a depth range of [0, 1].
+   */
+  MeshletCuller(const glm::mat4& model_view_transform, const glm::mat4& projection_transform);
+
+  /** \brief Determines if any triangle in a meshlet may be visible. */
+  [[nodiscard]] bool IsVisible(const Meshlet& meshlet) const noexcept;
+
+private:
+  /** \brief The view frustum planes in model space normalized such that points inside have positive distance. */
+  std::array<glm::vec4, 6> frustum_planes_{};
+  glm::vec3 camera_position_{0.0f};
+};
+
+}  // namespace gfx
+
+#endif  // GRAPHICS_MESHLET_H_
@@ -7,10 +7,15 @@
 #include <cstdint>
 #include <format>
 #include <fstream>
+#include <iostream>
 #include <limits>
+#include <print>
+#include <ranges>
 #include <stdexcept>
 #include <string>
 #include <string_view>
+#include <system_error>
+#include <thread>
 #include <unordered_map>
 #include <utility>
 #include <vector>
@@ -18,11 +23,15 @@
 #include <glm/glm.hpp>
 #include <glm/gtx/hash.hpp>
 
+#include "concurrency/parallel_for.h"
+#include "graphics/mapped_file.h"
+#include "graphics/mesh_cache.h"
 #include "graphics/mesh.h"
 
 namespace {
 
 constexpr auto kInvalidIndex = -1;
+constexpr auto kCacheExtension = ".mesh";
 
 constexpr std::string_view Trim(std::string_view line, const std::string_view delimiter = " ") {
   line.remove_prefix(std::min(line.find_first_not_of(delimiter), line.size()));
@@ -30,14 +39,22 @@ constexpr std::string_view Trim(std::string_view line, const std::string_view de
   return line;
 }
 
-constexpr std::vector<std::string_view> Split(const std::string_view line, const std::string_view delimiter = " ") {
-  std::vector<std::string_view> tokens;
-  for (auto i = line.find_first_not_of(delimiter); i < line.size();) {
+/**
+ * \brief Splits a string into tokens without allocating memory.
+ * \tparam N The maximum number of tokens to store.
+ * \return The first \p N tokens in the string and the total number of tokens in the string.
+ */
+template <std::size_t N>
+constexpr std::pair<std::array<std::string_view, N>, std::size_t> Split(const std::string_view line,
+                                                                        const std::string_view delimiter = " ") {
+  std::array<std::string_view, N> tokens;
+  std::size_t token_count = 0;
+  for (auto i = line.find_first_not_of(delimiter); i < line.size(); ++token_count) {
     const auto j = std::min(line.find_first_of(delimiter, i), line.size());
-    tokens.push_back(line.substr(i, j - i));
+    if (token_count < N) tokens[token_count] = line.substr(i, j - i);
     i = line.find_first_not_of(delimiter, j);
   }
-  return tokens;
+  return {tokens, token_count};
 }
 
 template <typename T>
@@ -51,7 +68,7 @@ constexpr T ParseToken(const std::string_view token) {
 
 template <typename T, glm::length_t N>
 constexpr glm::vec<N, T> ParseLine(const std::string_view line) {
-  if (const auto tokens = Split(line); tokens.size() == N + 1) {
+  if (const auto [tokens, token_count] = Split<N + 1>(line); token_count == N + 1) {
     glm::vec<N, T> vec{0.0f};
     for (glm::length_t i = 0; i < N; ++i) {
       const auto j = static_cast<std::size_t>(i) + 1;
@@ -66,7 +83,8 @@ glm::ivec3 ParseIndexGroup(const std::string_view token) {
   static constexpr auto kDelimiter = "/";
   const auto delimiter_count = std::ranges::count(token, *kDelimiter);
 
-  switch (const auto tokens = Split(token, kDelimiter); tokens.size()) {
+  const auto [tokens, token_count] = Split<3>(token, kDelimiter);
+  switch (token_count) {
     case 1:
       // case: f v0 v1 v2
       if (delimiter_count == 0) {
@@ -105,7 +123,7 @@ glm::ivec3 ParseIndexGroup(const std::string_view token) {
 }
 
 std::array<glm::ivec3, 3> ParseFace(const std::string_view line) {
-  if (const auto tokens = Split(line); tokens.size() == 4) {
+  if (const auto [tokens, token_count] = Split<4>(line); token_count == 4) {
     return std::array{ParseIndexGroup(tokens[1]), ParseIndexGroup(tokens[2]), ParseIndexGroup(tokens[3])};
   }
   throw std::invalid_argument{std::format("Unsupported format {}", line)};
@@ -120,31 +138,88 @@ constexpr glm::vec<N, T> Get(const std::vector<glm::vec<N, T>>& data, const int
   return glm::vec<N, T>{0.0f};
 }
 
-gfx::Mesh LoadMesh(const gfx::Device& device, std::istream& istream) {
+/** \brief The vertex attributes and faces of an .obj file in the order they appear in the file. */
+struct ObjData {
   std::vector<glm::vec3> positions;
-  std::vector<glm::vec3> normals;
   std::vector<glm::vec2> texture_coordinates;
+  std::vector<glm::vec3> normals;
   std::vector<std::array<glm::ivec3, 3>> faces;
+};
 
-  for (std::string line; getline(istream, line);) {
-    if (const auto line_view = Trim(line); !line_view.empty() && !line_view.starts_with('#')) {
-      if (line_view.starts_with("v ")) {
-        positions.push_back(ParseLine<float, 3>(line_view));
-      } else if (line_view.starts_with("vt ")) {
-        texture_coordinates.push_back(ParseLine<float, 2>(line_view));
-      } else if (line_view.starts_with("vn ")) {
-        const auto normal = ParseLine<float, 3>(line_view);
+void ParseObjLine(const std::string_view line, ObjData& obj_data) {
+  if (const auto line_view = Trim(line); !line_view.empty() && !line_view.starts_with('#')) {
+    if (line_view.starts_with("v ")) {
+      obj_data.positions.push_back(ParseLine<float, 3>(line_view));
+    } else if (line_view.starts_with("vt ")) {
+      obj_data.texture_coordinates.push_back(ParseLine<float, 2>(line_view));
+    } else if (line_view.starts_with("vn ")) {
+      const auto normal = ParseLine<float, 3>(line_view);
 #ifndef NDEBUG
-        // normals assumed to have unit length in the .obj file
-        static constexpr auto kEpsilon = 1.0e-6f;
-        assert(std::abs(glm::length(normal) - 1.0f) < kEpsilon);
+      // normals assumed to have unit length in the .obj file
+      static constexpr auto kEpsilon = 1.0e-6f;
+      assert(std::abs(glm::length(normal) - 1.0f) < kEpsilon);
 #endif
-        normals.push_back(normal);
-      } else if (line_view.starts_with("f ")) {
-        faces.push_back(ParseFace(line_view));
-      }
+      obj_data.normals.push_back(normal);
+    } else if (line_view.starts_with("f ")) {
+      obj_data.faces.push_back(ParseFace(line_view));
     }
   }
+}
+
+ObjData ReadObj(std::istream& istream) {
+  ObjData obj_data;
+  for (std::string line; getline(istream, line);) {
+    ParseObjLine(line, obj_data);
+  }
+  return obj_data;
+}
+
+/**
+ * \brief Reads the contents of an .obj file by parsing contiguous ranges of lines in parallel.
+ * \details The contents are split into byte ranges of equal size where each range owns the lines starting in it.
+ *          Lines are parsed in place and the attributes and faces of each range are concatenated in file order which
+ *          produces the same result as reading the file one line at a time.
+ * \param contents The contents of the .obj file.
+ * \param range_count The number of ranges to split the contents into.
+ * \return The vertex attributes and faces of the .obj file.
+ */
+ObjData ReadObj(const std::string_view contents, const std::size_t range_count) {
+  std::vector<ObjData> range_data(range_count);
+
+  gfx::ParallelFor(
+      range_count,
+      [&](const std::size_t begin, const std::size_t end) {
+        for (auto range = begin; range < end; ++range) {
+          const auto range_begin = contents.size() * range / range_count;
+          const auto range_end = contents.size() * (range + 1) / range_count;
+
+          // each range owns the lines which start in it
+          auto line_begin = range_begin;
+          if (range_begin > 0) line_begin = std::min(contents.find('\n', range_begin - 1), contents.size() - 1) + 1;
+
+          while (line_begin < range_end) {
+            const auto line_end = std::min(contents.find('\n', line_begin), contents.size());
+            ParseObjLine(contents.substr(line_begin, line_end - line_begin), range_data[range]);
+            line_begin = line_end + 1;
+          }
+        }
+      },
+      1);
+
+  auto& [positions, texture_coordinates, normals, faces] = range_data.front();
+  for (const auto& data : range_data | std::views::drop(1)) {
+    positions.insert(positions.end(), data.positions.begin(), data.positions.end());
+    texture_coordinates.insert(texture_coordinates.end(),
+                               data.texture_coordinates.begin(),
+                               data.texture_coordinates.end());
+    normals.insert(normals.end(), data.normals.begin(), data.normals.end());
+    faces.insert(faces.end(), data.faces.begin(), data.faces.end());
+  }
+  return std::move(range_data.front());
+}
+
+gfx::Mesh CreateMesh(const gfx::Device& device, const ObjData& obj_data) {
+  const auto& [positions, texture_coordinates, normals, faces] = obj_data;
 
   std::vector<gfx::Mesh::Vertex> vertices;
   vertices.reserve(positions.size());
@@ -166,18 +241,85 @@ gfx::Mesh LoadMesh(const gfx::Device& device, std::istream& istream) {
     }
   }
 
-  return gfx::Mesh{device, vertices, indices};
+  return gfx::Mesh{device, std::move(vertices), std::move(indices)};
 }
 
-}  // namespace
-
-namespace gfx {
+gfx::Mesh LoadMesh(const gfx::Device& device, std::istream& istream) { return CreateMesh(device, ReadObj(istream)); }
 
-Mesh obj_loader::LoadMesh(const Device& device, const std::filesystem::path& filepath) {
+gfx::Mesh LoadMesh(const gfx::Device& device, const std::filesystem::path& filepath, const bool parallel) {
+  if (parallel) {
+    // ranges must be large enough to amortize the cost of thread creation and concatenating results
+    static constexpr std::size_t kMinRangeSize = std::size_t{1} << 20u;
+    const gfx::MappedFile mapped_file{filepath};
+    const auto contents = mapped_file.data_as<char>();
+    const auto range_count = std::clamp<std::size_t>(contents.size() / kMinRangeSize,
+                                                     1,
+                                                     std::max(std::thread::hardware_concurrency(), 1u));
+    return CreateMesh(device, ReadObj(std::string_view{contents.data(), contents.size()}, range_count));
+  }
   if (std::ifstream ifstream{filepath}) {
     return ::LoadMesh(device, ifstream);
   }
   throw std::runtime_error{std::format("Unable to open {}", filepath.string())};
 }
 
+std::uint32_t GetPositionIndex(const glm::ivec3& index_group) {
+  if (index_group[0] < 0) {
+    throw std::invalid_argument{std::format("Invalid position index {}", index_group[0] + 1)};
+  }
+  return static_cast<std::uint32_t>(index_group[0]);
+}
+
+}  // namespace
+
+namespace gfx {
+
+Mesh obj_loader::LoadMesh(const Device& device, const std::filesystem::path& filepath, const LoadOptions& options) {
+  if (!options.use_cache) {
+    return ::LoadMesh(device, filepath, options.parallel);
+  }
+
+  auto cache_filepath = filepath;
+  cache_filepath.replace_extension(kCacheExtension);
+
+  // last_write_time returns file_time_type::min() if the cache file does not exist
+  if (std::error_code error_code;
+      std::filesystem::last_write_time(cache_filepath, error_code) > std::filesystem::last_write_time(filepath)) {
+    try {
+      return mesh_cache::LoadMesh(device, cache_filepath);
+    } catch (const std::runtime_error& e) {
+      // fall back to parsing the .obj file which overwrites a cache file written by an incompatible version
+      std::println(std::clog, "{}", e.what());
+    }
+  }
+
+  auto mesh = ::LoadMesh(device, filepath, options.parallel);
+  try {
+    mesh_cache::SaveMesh(mesh, cache_filepath);
+  } catch (const std::runtime_error& e) {
+    std::println(std::clog, "{}", e.what());  // failing to write the cache should not prevent the mesh from loading
+  }
+  return mesh;
+}
+
+void obj_loader::ReadPositions(const std::filesystem::path& filepath,
+                               const std::function<void(const glm::vec3&)>& on_position,
+                               const std::function<void(const std::array<std::uint32_t, 3>&)>& on_face) {
+  std::ifstream ifstream{filepath};
+  if (!ifstream) {
+    throw std::runtime_error{std::format("Unable to open {}", filepath.string())};
+  }
+
+  for (std::string line; getline(ifstream, line);) {
+    if (const auto line_view = Trim(line); line_view.starts_with("v ")) {
+      on_position(ParseLine<float, 3>(line_view));
+    } else if (line_view.starts_with("f ")) {
+      const auto& [index_group0, index_group1, index_group2] = ParseFace(line_view);
+      on_face(std::array{GetPositionIndex(index_group0),  //
+                         GetPositionIndex(index_group1),
+                         GetPositionIndex(index_group2)});
+    }
+  }
+}
+
 }  // namespace gfx
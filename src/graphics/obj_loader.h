@@ -1,7 +1,12 @@
 #ifndef GRAPHICS_OBJ_LOADER_H_
 #define GRAPHICS_OBJ_LOADER_H_
 
+#include <array>
+#include <cstdint>
 #include <filesystem>
+#include <functional>
+
+#include <glm/vec3.hpp>
 
 namespace gfx {
 class Device;
@@ -9,7 +14,46 @@ class Mesh;
 
 namespace obj_loader {
 
-Mesh LoadMesh(const Device& device, const std::filesystem::path& filepath);
+/** \brief Options used to configure .obj file loading. */
+struct LoadOptions {
+  /**
+   * \brief Determines if the file is memory-mapped and parsed concurrently.
+   * \details The file is split into newline-aligned ranges which are parsed in place on all hardware threads and then
+   *          merged in file order. The loaded mesh is identical to the one produced by reading the file sequentially.
+   */
+  bool parallel = false;
+
+  /**
+   * \brief Determines if a binary mesh cache file is used to avoid parsing the .obj file.
+   * \details The cache file has the same path as the .obj file with the extension replaced by ".mesh". It is loaded
+   *          instead of the .obj file when it is newer than the .obj file, otherwise the .obj file is parsed and the
+   *          cache file is rewritten.
+   */
+  bool use_cache = false;
+};
+
+/**
+ * \brief Loads a triangle mesh from an .obj file.
+ * \param device The graphics device used to load mesh data into GPU memory.
+ * \param filepath The path of the .obj file to load.
+ * \param options Options used to configure .obj file loading.
+ * \return A triangle mesh with a vertex for each unique index group in the .obj file.
+ * \throw std::invalid_argument Thrown if the .obj file contains an unsupported or invalid line.
+ * \throw std::runtime_error Thrown if the .obj file cannot be opened.
+ */
+Mesh LoadMesh(const Device& device, const std::filesystem::path& filepath, const LoadOptions& options = {});
+
+/**
+ * \brief Reads vertex positions and triangle position indices from an .obj file one line at a time.
+ * \details Texture coordinates and normals are ignored and no mesh data is retained which allows files larger than
+ *          available memory to be processed.
+ * \param filepath The path of the .obj file to read.
+ * \param on_position The function to invoke with each vertex position in the order it appears in the file.
+ * \param on_face The function to invoke with the zero-based position indices of each triangle.
+ */
+void ReadPositions(const std::filesystem::path& filepath,
+                   const std::function<void(const glm::vec3&)>& on_position,
+                   const std::function<void(const std::array<std::uint32_t, 3>&)>& on_face);
 
 }  // namespace obj_loader
 }  // namespace gfx
@@ -0,0 +1,76 @@
+#include "graphics/packed_vertex.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include <glm/glm.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+#include <glm/gtc/packing.hpp>
+
+namespace {
+
+float SignNotZero(const float value) noexcept { return value >= 0.0f ? 1.0f : -1.0f; }
+
+}  // namespace
+
+namespace gfx {
+
+glm::mat4 QuantizationBounds::GetDequantizationTransform() const noexcept {
+  return glm::scale(glm::translate(glm::mat4{1.0f}, origin), glm::vec3{extent});
+}
+
+QuantizationBounds CreateQuantizationBounds(const std::span<const glm::vec3> positions) {
+  if (positions.empty()) return QuantizationBounds{};
+
+  auto min_position = glm::vec3{std::numeric_limits<float>::max()};
+  auto max_position = glm::vec3{std::numeric_limits<float>::lowest()};
+  for (const auto& position : positions) {
+    min_position = glm::min(min_position, position);
+    max_position = glm::max(max_position, position);
+  }
+
+  const auto size = max_position - min_position;
+  const auto extent = std::max({size.x, size.y, size.z});
+  return QuantizationBounds{.origin = min_position, .extent = extent > 0.0f ? extent : 1.0f};
+}
+
+glm::vec2 EncodeOctahedral(const glm::vec3& normal) noexcept {
+  const auto l1_norm = std::abs(normal.x) + std::abs(normal.y) + std::abs(normal.z);
+  if (l1_norm == 0.0f) return glm::vec2{0.0f};
+
+  const auto octahedron_normal = normal / l1_norm;
+  if (octahedron_normal.z >= 0.0f) return glm::vec2{octahedron_normal.x, octahedron_normal.y};
+
+  // reflect the lower hemisphere across the diagonals of the square so it fills the corners around the upper hemisphere
+  return glm::vec2{(1.0f - std::abs(octahedron_normal.y)) * SignNotZero(octahedron_normal.x),
+                   (1.0f - std::abs(octahedron_normal.x)) * SignNotZero(octahedron_normal.y)};
+}
+
+glm::vec3 DecodeOctahedral(const glm::vec2& encoded_normal) noexcept {
+  auto normal =
+      glm::vec3{encoded_normal.x, encoded_normal.y, 1.0f - std::abs(encoded_normal.x) - std::abs(encoded_normal.y)};
+  const auto t = std::max(-normal.z, 0.0f);
+  normal.x -= t * SignNotZero(normal.x);
+  normal.y -= t * SignNotZero(normal.y);
+  return glm::normalize(normal);
+}
+
+PackedVertex PackVertex(const glm::vec3& position,
+                        const glm::vec2& texture_coordinates,
+                        const glm::vec3& normal,
+                        const QuantizationBounds& quantization_bounds) noexcept {
+  const auto quantized_position = (position - quantization_bounds.origin) / quantization_bounds.extent;
+  const auto encoded_normal = EncodeOctahedral(normal);
+
+  return PackedVertex{.position = {glm::packUnorm1x16(quantized_position.x),
+                                   glm::packUnorm1x16(quantized_position.y),
+                                   glm::packUnorm1x16(quantized_position.z),
+                                   0},
+                      .normal = {static_cast<std::int16_t>(glm::packSnorm1x16(encoded_normal.x)),
+                                 static_cast<std::int16_t>(glm::packSnorm1x16(encoded_normal.y))},
+                      .texture_coordinates = {glm::packHalf1x16(texture_coordinates.x),
+                                              glm::packHalf1x16(texture_coordinates.y)}};
+}
+
+}  // namespace gfx
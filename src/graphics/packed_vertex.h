@@ -0,0 +1,61 @@
+#ifndef GRAPHICS_PACKED_VERTEX_H_
+#define GRAPHICS_PACKED_VERTEX_H_
+
+#include <array>
+#include <cstdint>
+#include <span>
+
+#include <glm/mat4x4.hpp>
+#include <glm/vec2.hpp>
+#include <glm/vec3.hpp>
+
+namespace gfx {
+
+/**
+ * \brief A compact vertex layout for device-local vertex buffers.
+ * \details Positions are 16-bit unsigned normalized coordinates relative to the mesh bounds, normals are 16-bit signed
+ *          normalized octahedral coordinates and texture coordinates are half-precision floats.
+ */
+struct PackedVertex {
+  /** \brief The quantized position where the last component pads the attribute to a widely supported vertex format. */
+  std::array<std::uint16_t, 4> position{};
+  std::array<std::int16_t, 2> normal{};
+  std::array<std::uint16_t, 2> texture_coordinates{};
+};
+
+static_assert(sizeof(PackedVertex) == 16);
+
+/**
+ * \brief A cube that bounds mesh positions such that quantized positions in [0, 1] map back to model space.
+ * \details The cube has a uniform scale so dequantizing positions does not distort normals transformed by the same
+ *          model-view transform.
+ */
+struct QuantizationBounds {
+  glm::vec3 origin{0.0f};
+  float extent = 1.0f;
+
+  /** \brief Gets the transform from quantized coordinates to model space. */
+  [[nodiscard]] glm::mat4 GetDequantizationTransform() const noexcept;
+};
+
+/** \brief Creates the smallest cube with a minimum corner aligned to the bounding box of \p positions. */
+[[nodiscard]] QuantizationBounds CreateQuantizationBounds(std::span<const glm::vec3> positions);
+
+/**
+ * \brief Maps a unit vector to a point in the square [-1, 1]^2 by projecting it onto an octahedron and unfolding the
+ *        lower hemisphere over the upper one.
+ */
+[[nodiscard]] glm::vec2 EncodeOctahedral(const glm::vec3& normal) noexcept;
+
+/** \brief Maps a point in the square [-1, 1]^2 encoded by \ref EncodeOctahedral back to a unit vector. */
+[[nodiscard]] glm::vec3 DecodeOctahedral(const glm::vec2& encoded_normal) noexcept;
+
+/** \brief Packs vertex attributes into a \ref PackedVertex. */
+[[nodiscard]] PackedVertex PackVertex(const glm::vec3& position,
+                                      const glm::vec2& texture_coordinates,
+                                      const glm::vec3& normal,
+                                      const QuantizationBounds& quantization_bounds) noexcept;
+
+}  // namespace gfx
+
+#endif  // GRAPHICS_PACKED_VERTEX_H_
@@ -19,21 +19,30 @@ std::optional<gfx::QueueFamilyIndices> FindQueueFamilyIndices(const vk::Physical
                                                               const vk::SurfaceKHR surface) {
   std::optional<std::uint32_t> maybe_graphics_index;
   std::optional<std::uint32_t> maybe_present_index;
+  std::optional<std::uint32_t> maybe_transfer_index;
 
   for (std::uint32_t index = 0; const auto& queue_family_properties : physical_device.getQueueFamilyProperties()) {
-    if (queue_family_properties.queueFlags & vk::QueueFlagBits::eGraphics) {
-      maybe_graphics_index = index;
+    const auto queue_flags = queue_family_properties.queueFlags;
+    if (!maybe_graphics_index.has_value() || !maybe_present_index.has_value()) {
+      if (queue_flags & vk::QueueFlagBits::eGraphics) {
+        maybe_graphics_index = index;
+      }
+      if (physical_device.getSurfaceSupportKHR(index, surface) == vk::True) {
+        maybe_present_index = index;
+      }
     }
-    if (physical_device.getSurfaceSupportKHR(index, surface) == vk::True) {
-      maybe_present_index = index;
-    }
-    if (maybe_graphics_index.has_value() && maybe_present_index.has_value()) {
-      return gfx::QueueFamilyIndices{.graphics_index = *maybe_graphics_index, .present_index = *maybe_present_index};
+    // queue families supporting transfer but not graphics or compute operations typically map to dedicated DMA engines
+    if (!maybe_transfer_index.has_value() && (queue_flags & vk::QueueFlagBits::eTransfer)
+        && !(queue_flags & (vk::QueueFlagBits::eGraphics | vk::QueueFlagBits::eCompute))) {
+      maybe_transfer_index = index;
     }
     ++index;
   }
 
-  return std::nullopt;
+  if (!maybe_graphics_index.has_value() || !maybe_present_index.has_value()) return std::nullopt;
+  return gfx::QueueFamilyIndices{.graphics_index = *maybe_graphics_index,
+                                 .present_index = *maybe_present_index,
+                                 .transfer_index = maybe_transfer_index.value_or(*maybe_graphics_index)};
 }
 
 RankedPhysicalDevice GetRankedPhysicalDevice(const vk::PhysicalDevice physical_device, const vk::SurfaceKHR surface) {
@@ -74,6 +83,7 @@ PhysicalDevice::PhysicalDevice(const vk::Instance instance, const vk::SurfaceKHR
   physical_device_ = physical_device;
   physical_device_limits_ = limits;
   queue_family_indices_ = queue_family_indices;
+  physical_device_features_ = physical_device.getFeatures();
   // NOLINTEND(cppcoreguidelines-prefer-member-initializer)
 }
 
@@ -10,6 +10,9 @@ namespace gfx {
 struct QueueFamilyIndices {
   std::uint32_t graphics_index = 0;
   std::uint32_t present_index = 0;
+
+  /** \brief A queue family dedicated to transfer operations if available, otherwise the graphics queue family. */
+  std::uint32_t transfer_index = 0;
 };
 
 class PhysicalDevice {
@@ -20,11 +23,15 @@ public:
   [[nodiscard]] const vk::PhysicalDevice* operator->() const noexcept { return &physical_device_; }
 
   [[nodiscard]] const vk::PhysicalDeviceLimits& limits() const noexcept { return physical_device_limits_; }
+
+  /** \brief Gets the features supported by the physical device. */
+  [[nodiscard]] const vk::PhysicalDeviceFeatures& features() const noexcept { return physical_device_features_; }
   [[nodiscard]] QueueFamilyIndices queue_family_indices() const noexcept { return queue_family_indices_; }
 
 private:
   vk::PhysicalDevice physical_device_;
   vk::PhysicalDeviceLimits physical_device_limits_;
+  vk::PhysicalDeviceFeatures physical_device_features_;
   QueueFamilyIndices queue_family_indices_;
 };
 
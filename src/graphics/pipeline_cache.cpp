@@ -0,0 +1,85 @@
+#include "graphics/pipeline_cache.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <exception>
+#include <format>
+#include <fstream>
+#include <ios>
+#include <iostream>
+#include <print>
+#include <span>
+#include <stdexcept>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+#include "graphics/atomic_file.h"
+#include "graphics/device.h"
+
+namespace {
+
+std::vector<std::byte> ReadFile(const std::filesystem::path& filepath) {
+  std::ifstream ifstream{filepath, std::ios::binary | std::ios::ate};
+  if (!ifstream) return {};  // the pipeline cache has not been saved yet
+
+  const std::streamsize size = ifstream.tellg();
+  std::vector<std::byte> data(static_cast<std::size_t>(size));
+  ifstream.seekg(0, std::ios::beg);
+  if (!ifstream.read(reinterpret_cast<char*>(data.data()), size)) return {};  // NOLINT(*-reinterpret-cast)
+  return data;
+}
+
+}  // namespace
+
+namespace gfx {
+
+PipelineCache::PipelineCache(const Device& device, std::filesystem::path filepath)
+    : device_{*device}, filepath_{std::move(filepath)} {
+  auto data = ReadFile(filepath_);
+  if (!IsCompatible(data, device.physical_device()->getProperties())) {
+    data.clear();
+  }
+  pipeline_cache_ = device_.createPipelineCacheUnique(
+      vk::PipelineCacheCreateInfo{.initialDataSize = data.size(), .pInitialData = data.data()});
+}
+
+// drivers may crash or return corrupt pipelines when given data from a different device or driver version
+bool PipelineCache::IsCompatible(const std::span<const std::byte> data,
+                                 const vk::PhysicalDeviceProperties& physical_device_properties) noexcept {
+  vk::PipelineCacheHeaderVersionOne header{};
+  if (data.size() < sizeof(header)) return false;
+  std::memcpy(&header, data.data(), sizeof(header));
+
+  return header.headerSize >= sizeof(header) && header.headerSize <= data.size()
+         && header.headerVersion == vk::PipelineCacheHeaderVersion::eOne
+         && header.vendorID == physical_device_properties.vendorID
+         && header.deviceID == physical_device_properties.deviceID
+         && std::ranges::equal(header.pipelineCacheUUID, physical_device_properties.pipelineCacheUUID);
+}
+
+PipelineCache::~PipelineCache() noexcept {
+  try {
+    Save();
+  } catch (const std::exception& e) {
+    std::println(std::clog, "{}", e.what());
+  }
+}
+
+void PipelineCache::Save() const {
+  const auto data = device_.getPipelineCacheData(*pipeline_cache_);
+
+  std::error_code error_code;
+  if (const auto directory = filepath_.parent_path(); !directory.empty()) {
+    std::filesystem::create_directories(directory, error_code);
+    if (error_code) {
+      throw std::runtime_error{std::format("Unable to create {}: {}", directory.string(), error_code.message())};
+    }
+  }
+
+  // a concurrent process must never load a partially written pipeline cache
+  WriteFileAtomically(filepath_, {std::as_bytes(std::span{data})});
+}
+
+}  // namespace gfx
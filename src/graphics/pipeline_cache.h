@@ -0,0 +1,63 @@
+#ifndef GRAPHICS_PIPELINE_CACHE_H_
+#define GRAPHICS_PIPELINE_CACHE_H_
+
+#include <cstddef>
+#include <filesystem>
+#include <span>
+
+#include <vulkan/vulkan.hpp>
+
+namespace gfx {
+class Device;
+
+/**
+ * \brief A Vulkan pipeline cache persisted to disk between runs.
+ * \details Drivers use the pipeline cache to skip compiling device-specific pipeline code they have compiled before.
+ *          Cache data is only loaded if its header matches the vendor, device and pipeline cache UUID of the physical
+ *          device which changes with driver updates. Otherwise the pipeline cache starts empty.
+ */
+class PipelineCache {
+public:
+  /**
+   * \brief Initializes a pipeline cache with the data saved in a file if it is compatible with the device.
+   * \param device The device to create the pipeline cache with.
+   * \param filepath The path of the file to load the pipeline cache from and save it to.
+   */
+  PipelineCache(const Device& device, std::filesystem::path filepath);
+
+  PipelineCache(const PipelineCache&) = delete;
+  PipelineCache(PipelineCache&&) noexcept = delete;
+
+  PipelineCache& operator=(const PipelineCache&) = delete;
+  PipelineCache& operator=(PipelineCache&&) noexcept = delete;
+
+  /** \brief Saves the pipeline cache. Errors are logged because destructors cannot propagate exceptions. */
+  ~PipelineCache() noexcept;
+
+  [[nodiscard]] vk::PipelineCache operator*() const noexcept { return *pipeline_cache_; }
+
+  /**
+   * \brief Checks if saved pipeline cache data can be loaded on a physical device.
+   * \param data The pipeline cache data including its header.
+   * \param physical_device_properties The properties of the physical device to load the pipeline cache data on.
+   * \return \c true if \p data contains a complete header whose vendor, device and pipeline cache UUID match the
+   *         physical device, otherwise \c false.
+   */
+  [[nodiscard]] static bool IsCompatible(std::span<const std::byte> data,
+                                         const vk::PhysicalDeviceProperties& physical_device_properties) noexcept;
+
+  /**
+   * \brief Saves the pipeline cache including all pipelines created with it since it was loaded.
+   * \throw std::runtime_error Thrown if the pipeline cache file cannot be written.
+   */
+  void Save() const;
+
+private:
+  vk::Device device_;
+  std::filesystem::path filepath_;
+  vk::UniquePipelineCache pipeline_cache_;
+};
+
+}  // namespace gfx
+
+#endif  // GRAPHICS_PIPELINE_CACHE_H_
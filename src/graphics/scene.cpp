@@ -0,0 +1,148 @@
+#include "graphics/scene.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <ranges>
+#include <stdexcept>
+#include <tuple>
+
+#include "graphics/device.h"
+#include "graphics/packed_vertex.h"
+
+namespace {
+
+std::vector<gfx::IndexRange> GetLods(const gfx::SceneMesh& mesh) {
+  if (!mesh.lods.empty()) return mesh.lods;
+  return {gfx::IndexRange{.first_index = 0, .index_count = static_cast<std::uint32_t>(mesh.indices.size())}};
+}
+
+bool IsMultiDrawIndirectSupported(const gfx::Device& device) {
+  // instances are located by the first instance of their draw command which is otherwise required to be zero
+  const auto& physical_device_features = device.physical_device().features();
+  if (physical_device_features.drawIndirectFirstInstance == vk::False) {
+    throw std::runtime_error{"Indirect draws with a first instance are unsupported"};
+  }
+  return physical_device_features.multiDrawIndirect == vk::True;
+}
+
+}  // namespace
+
+namespace gfx {
+
+/** \brief The contents of the scene buffers. */
+struct Scene::Data {
+  std::vector<PackedVertex> vertices;
+  std::vector<std::uint32_t> indices;
+  std::vector<InstanceData> instances;
+  std::vector<vk::DrawIndexedIndirectCommand> draw_commands;
+  vk::IndexType index_type = vk::IndexType::eUint32;
+};
+
+Scene::Scene(const Device& device,
+             const std::span<const SceneMesh> meshes,
+             const std::span<const SceneInstance> instances)
+    : Scene{device, CreateData(meshes, instances)} {}
+
+Scene::Scene(const Device& device, const Data& data)
+    : index_type_{data.index_type},
+      instance_count_{static_cast<std::uint32_t>(data.instances.size())},
+      draw_count_{static_cast<std::uint32_t>(data.draw_commands.size())},
+      is_multi_draw_indirect_supported_{IsMultiDrawIndirectSupported(device)},
+      vertex_buffer_{
+          device.upload_queue().CreateBuffer(device, vk::BufferUsageFlagBits::eVertexBuffer, data.vertices)},
+      index_buffer_{CreateIndexBuffer(device, data.indices, data.index_type)},
+      instance_buffer_{
+          device.upload_queue().CreateBuffer(device, vk::BufferUsageFlagBits::eStorageBuffer, data.instances)},
+      indirect_buffer_{
+          device.upload_queue().CreateBuffer(device, vk::BufferUsageFlagBits::eIndirectBuffer, data.draw_commands)} {
+  auto& upload_queue = device.upload_queue();
+  pending_upload_ = PendingUpload{upload_queue, upload_queue.Submit()};
+}
+
+Scene::Data Scene::CreateData(const std::span<const SceneMesh> meshes,
+                              const std::span<const SceneInstance> instances) {
+  assert(!meshes.empty() && !instances.empty());
+  Data data;
+
+  // pack meshes into shared buffers where indices remain relative to the first vertex of their mesh
+  struct MeshRange {
+    std::int32_t vertex_offset = 0;
+    std::uint32_t first_index = 0;
+    glm::mat4 dequantization_transform{1.0f};
+    std::vector<IndexRange> lods;
+  };
+  std::vector<MeshRange> mesh_ranges;
+  mesh_ranges.reserve(meshes.size());
+  std::size_t max_vertex_count = 0;
+
+  for (const auto& mesh : meshes) {
+    const auto positions =
+        mesh.vertices | std::views::transform(&Mesh::Vertex::position) | std::ranges::to<std::vector>();
+    const auto quantization_bounds = CreateQuantizationBounds(positions);
+    mesh_ranges.push_back(
+        MeshRange{.vertex_offset = static_cast<std::int32_t>(data.vertices.size()),
+                  .first_index = static_cast<std::uint32_t>(data.indices.size()),
+                  .dequantization_transform = quantization_bounds.GetDequantizationTransform(),
+                  .lods = GetLods(mesh)});
+    max_vertex_count = std::max(max_vertex_count, mesh.vertices.size());
+
+    for (const auto& vertex : mesh.vertices) {
+      data.vertices.push_back(
+          PackVertex(vertex.position, vertex.texture_coordinates, vertex.normal, quantization_bounds));
+    }
+    data.indices.insert(data.indices.end(), mesh.indices.begin(), mesh.indices.end());
+  }
+  data.index_type = GetIndexType(max_vertex_count);
+
+  // sort instances by mesh and level of detail so each group is drawn by a single instanced command
+  std::vector<std::uint32_t> instance_order(instances.size());
+  std::iota(instance_order.begin(), instance_order.end(), 0);
+  std::ranges::stable_sort(instance_order, {}, [instances](const auto instance_index) {
+    const auto& instance = instances[instance_index];
+    return std::tie(instance.mesh_index, instance.lod_index);
+  });
+
+  data.instances.reserve(instances.size());
+  for (std::size_t i = 0; i < instance_order.size(); ++i) {
+    const auto& instance = instances[instance_order[i]];
+    assert(instance.mesh_index < mesh_ranges.size());
+    const auto& mesh_range = mesh_ranges[instance.mesh_index];
+    assert(instance.lod_index < mesh_range.lods.size());
+    const auto& lod = mesh_range.lods[instance.lod_index];
+
+    if (const auto* prev_instance = i == 0 ? nullptr : &instances[instance_order[i - 1]];
+        prev_instance != nullptr && prev_instance->mesh_index == instance.mesh_index
+        && prev_instance->lod_index == instance.lod_index) {
+      ++data.draw_commands.back().instanceCount;
+    } else {
+      data.draw_commands.push_back(
+          vk::DrawIndexedIndirectCommand{.indexCount = lod.index_count,
+                                         .instanceCount = 1,
+                                         .firstIndex = mesh_range.first_index + lod.first_index,
+                                         .vertexOffset = mesh_range.vertex_offset,
+                                         .firstInstance = static_cast<std::uint32_t>(data.instances.size())});
+    }
+    data.instances.push_back(
+        InstanceData{.model_transform = instance.transform * mesh_range.dequantization_transform});
+  }
+  return data;
+}
+
+void Scene::Render(const vk::CommandBuffer command_buffer) const {
+  command_buffer.bindVertexBuffers(0, *vertex_buffer_, static_cast<vk::DeviceSize>(0));
+  command_buffer.bindIndexBuffer(*index_buffer_, 0, index_type_);
+
+  static constexpr auto kStride = static_cast<std::uint32_t>(sizeof(vk::DrawIndexedIndirectCommand));
+  if (is_multi_draw_indirect_supported_) {
+    command_buffer.drawIndexedIndirect(*indirect_buffer_, 0, draw_count_, kStride);
+  } else {
+    for (std::uint32_t draw_index = 0; draw_index < draw_count_; ++draw_index) {
+      command_buffer.drawIndexedIndirect(*indirect_buffer_, vk::DeviceSize{draw_index} * kStride, 1, kStride);
+    }
+  }
+}
+
+}  // namespace gfx
@@ -0,0 +1,101 @@
+#ifndef GRAPHICS_SCENE_H_
+#define GRAPHICS_SCENE_H_
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include <glm/mat4x4.hpp>
+#include <vulkan/vulkan.hpp>
+
+#include "graphics/buffer.h"
+#include "graphics/mesh.h"
+#include "graphics/upload_queue.h"
+
+namespace gfx {
+class Device;
+
+/** \brief The geometry of a mesh that may be instanced many times in a \ref Scene. */
+struct SceneMesh {
+  std::span<const Mesh::Vertex> vertices;
+  std::span<const std::uint32_t> indices;
+
+  /** \brief The levels of detail in order of decreasing detail or empty if the mesh has a single level of detail. */
+  std::vector<IndexRange> lods;
+};
+
+/** \brief A placement of a scene mesh at a single level of detail. */
+struct SceneInstance {
+  glm::mat4 transform{1.0f};
+  std::uint32_t mesh_index = 0;
+  std::uint32_t lod_index = 0;
+};
+
+/**
+ * \brief Many mesh instances that are rendered with a constant number of commands regardless of the instance count.
+ * \details The geometry of every mesh is packed into shared vertex and index buffers and per-instance transforms are
+ *          stored in a storage buffer indexed by the instance index in the vertex shader. Instances are grouped by mesh
+ *          and level of detail so each group is a single indexed indirect draw command and the scene is rendered with
+ *          one multi-draw indirect call when supported.
+ */
+class Scene {
+public:
+  /** \brief The per-instance data read by the scene vertex shader. */
+  struct InstanceData {
+    /** \brief The transform from quantized mesh coordinates to world space. */
+    glm::mat4 model_transform{1.0f};
+  };
+
+  /**
+   * \brief Initializes a scene and asynchronously uploads its geometry and instances.
+   * \param device The device used to create scene buffers.
+   * \param meshes The meshes referenced by \p instances.
+   * \param instances The mesh instances to render.
+   * \throw std::runtime_error Thrown if the device does not support indirect draws with a nonzero first instance.
+   */
+  Scene(const Device& device, std::span<const SceneMesh> meshes, std::span<const SceneInstance> instances);
+
+  Scene(const Scene&) = delete;
+  Scene(Scene&&) noexcept = default;
+
+  Scene& operator=(const Scene&) = delete;
+  Scene& operator=(Scene&&) noexcept = default;
+
+  ~Scene() noexcept { pending_upload_.Wait(); }
+
+  /** \brief Gets the storage buffer of \ref InstanceData ordered by mesh and level of detail. */
+  [[nodiscard]] vk::Buffer instance_buffer() const noexcept { return *instance_buffer_; }
+
+  [[nodiscard]] std::uint32_t instance_count() const noexcept { return instance_count_; }
+
+  /** \brief Gets the number of indirect draw commands which is the number of distinct instanced levels of detail. */
+  [[nodiscard]] std::uint32_t draw_count() const noexcept { return draw_count_; }
+
+  /** \brief Determines if the scene has been copied to device-local buffers and can be rendered. */
+  [[nodiscard]] bool IsUploaded() const { return pending_upload_.IsComplete(); }
+
+  /** \brief Records draw commands for every instance with the scene pipeline and instance buffer already bound. */
+  void Render(vk::CommandBuffer command_buffer) const;
+
+private:
+  struct Data;
+  Scene(const Device& device, const Data& data);
+
+  static Data CreateData(std::span<const SceneMesh> meshes, std::span<const SceneInstance> instances);
+
+  vk::IndexType index_type_;
+  std::uint32_t instance_count_ = 0;
+  std::uint32_t draw_count_ = 0;
+  bool is_multi_draw_indirect_supported_ = false;
+
+  /** \brief The pending upload to the buffers below which is reassigned before the buffers when moving a scene. */
+  PendingUpload pending_upload_;
+  Buffer vertex_buffer_;
+  Buffer index_buffer_;
+  Buffer instance_buffer_;
+  Buffer indirect_buffer_;
+};
+
+}  // namespace gfx
+
+#endif  // GRAPHICS_SCENE_H_
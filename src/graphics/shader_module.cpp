@@ -1,14 +1,22 @@
 #include "graphics/shader_module.h"
 
+#include <cstddef>
+#include <exception>
 #include <format>
 #include <fstream>
 #include <ios>
+#include <iostream>
+#include <optional>
+#include <print>
 #include <stdexcept>
 #include <string>
+#include <utility>
 
 #include <glslang/Include/glslang_c_shader_types.h>
 
+#include "concurrency/parallel_for.h"
 #include "graphics/glslang_compiler.h"
+#include "graphics/spirv_cache.h"
 
 namespace {
 
@@ -58,16 +66,46 @@ std::string ReadFile(const std::filesystem::path& glsl_filepath) {
 
 namespace gfx {
 
-ShaderModule::ShaderModule(const vk::Device device,
-                           const vk::ShaderStageFlagBits shader_stage,
-                           const std::filesystem::path& glsl_filepath) {
-  const auto glsl_source = ReadFile(glsl_filepath);
-  const auto glslang_stage = GetGlslangStage(shader_stage);
-  const auto spirv = glslang::Compile(glslang_stage, glsl_source.c_str());
+ShaderModule::ShaderModule(const vk::Device device, const std::span<const std::uint32_t> spirv)
+    : shader_module_{device.createShaderModuleUnique(
+          vk::ShaderModuleCreateInfo{.codeSize = spirv.size_bytes(), .pCode = spirv.data()})} {}
 
-  shader_module_ = device.createShaderModuleUnique(
-      vk::ShaderModuleCreateInfo{.codeSize = spirv.size() * sizeof(decltype(spirv)::value_type),
-                                 .pCode = spirv.data()});
+std::vector<ShaderModule> CreateShaderModules(const vk::Device device,
+                                              const std::span<const ShaderStage> shader_stages,
+                                              const std::filesystem::path& spirv_cache_directory) {
+  std::vector<std::vector<std::uint32_t>> spirvs(shader_stages.size());
+
+  // each shader stage is compiled on its own thread because compilation dominates startup time on a cache miss
+  ParallelFor(
+      shader_stages.size(),
+      [&](const std::size_t begin, const std::size_t end) {
+        for (auto i = begin; i < end; ++i) {
+          const auto& [shader_stage, glsl_filepath] = shader_stages[i];
+          const auto glsl_source = ReadFile(glsl_filepath);
+          const auto glslang_stage = GetGlslangStage(shader_stage);
+          const auto key = spirv_cache::GetKey(glsl_source, glslang::GetCompileOptions(glslang_stage));
+
+          if (auto spirv = spirv_cache::LoadSpirv(spirv_cache_directory, key)) {
+            spirvs[i] = *std::move(spirv);
+            continue;
+          }
+
+          spirvs[i] = glslang::Compile(glslang_stage, glsl_source);
+          try {
+            spirv_cache::SaveSpirv(spirv_cache_directory, key, spirvs[i]);
+          } catch (const std::exception& e) {
+            std::println(std::clog, "{}", e.what());  // failing to write the cache should not prevent shader creation
+          }
+        }
+      },
+      1);
+
+  std::vector<ShaderModule> shader_modules;
+  shader_modules.reserve(shader_stages.size());
+  for (const auto& spirv : spirvs) {
+    shader_modules.emplace_back(device, spirv);
+  }
+  return shader_modules;
 }
 
 }  // namespace gfx
@@ -1,7 +1,10 @@
 #ifndef GRAPHICS_SHADER_MODULE_H_
 #define GRAPHICS_SHADER_MODULE_H_
 
+#include <cstdint>
 #include <filesystem>
+#include <span>
+#include <vector>
 
 #include <vulkan/vulkan.hpp>
 
@@ -9,7 +12,7 @@ namespace gfx {
 
 class ShaderModule {
 public:
-  ShaderModule(vk::Device device, vk::ShaderStageFlagBits shader_stage, const std::filesystem::path& glsl_filepath);
+  ShaderModule(vk::Device device, std::span<const std::uint32_t> spirv);
 
   [[nodiscard]] vk::ShaderModule operator*() const noexcept { return *shader_module_; }
 
@@ -17,6 +20,26 @@ private:
   vk::UniqueShaderModule shader_module_;
 };
 
+/** \brief A GLSL shader to compile for a shader stage. */
+struct ShaderStage {
+  vk::ShaderStageFlagBits stage{};
+  std::filesystem::path glsl_filepath;
+};
+
+/**
+ * \brief Creates shader modules from GLSL source files with compiled SPIR-V cached on disk.
+ * \details SPIR-V is looked up in the cache by a hash of the GLSL source and compile options so edited shaders are
+ *          recompiled automatically. Shader stages that miss the cache are compiled in parallel and the resulting
+ *          SPIR-V is saved for subsequent runs. Failing to save the cache does not prevent shader module creation.
+ * \param device The device to create the shader modules with.
+ * \param shader_stages The shader stages to create shader modules for.
+ * \param spirv_cache_directory The directory to load and save compiled SPIR-V in.
+ * \return The shader modules in the order of \p shader_stages.
+ */
+[[nodiscard]] std::vector<ShaderModule> CreateShaderModules(vk::Device device,
+                                                            std::span<const ShaderStage> shader_stages,
+                                                            const std::filesystem::path& spirv_cache_directory);
+
 }  // namespace gfx
 
 #endif  // GRAPHICS_SHADER_MODULE_H_
@@ -0,0 +1,96 @@
+#include "graphics/spirv_cache.h"
+
+#include <array>
+#include <format>
+#include <fstream>
+#include <ios>
+#include <span>
+#include <stdexcept>
+#include <system_error>
+#include <type_traits>
+
+#include "graphics/atomic_file.h"
+
+namespace {
+
+constexpr std::array kMagic{'G', 'F', 'X', 'S'};
+
+// increment when the header changes to invalidate existing cache files
+constexpr std::uint32_t kVersion = 1;
+
+struct Header {
+  std::array<char, 4> magic{};
+  std::uint32_t version = 0;
+  std::uint64_t key = 0;
+  std::uint64_t word_count = 0;
+};
+
+static_assert(std::is_trivially_copyable_v<Header>);
+
+std::filesystem::path GetCacheFilepath(const std::filesystem::path& cache_directory, const std::uint64_t key) {
+  return cache_directory / std::format("{:016x}.spv", key);
+}
+
+}  // namespace
+
+namespace gfx {
+
+std::uint64_t spirv_cache::GetKey(const std::string_view glsl_source, const std::string_view compile_options) noexcept {
+  static constexpr std::uint64_t kFnvOffsetBasis = 0xcbf29ce484222325;
+  static constexpr std::uint64_t kFnvPrime = 0x100000001b3;
+
+  auto hash = kFnvOffsetBasis;
+  const auto hash_bytes = [&hash](const std::string_view bytes) {
+    for (const auto byte : bytes) {
+      hash ^= static_cast<unsigned char>(byte);
+      hash *= kFnvPrime;
+    }
+  };
+  hash_bytes(compile_options);
+  hash_bytes(std::string_view{"\0", 1});  // separate the options from the source so their boundary affects the hash
+  hash_bytes(glsl_source);
+  return hash;
+}
+
+void spirv_cache::SaveSpirv(const std::filesystem::path& cache_directory,
+                            const std::uint64_t key,
+                            const std::span<const std::uint32_t> spirv) {
+  std::error_code error_code;
+  std::filesystem::create_directories(cache_directory, error_code);
+  if (error_code) {
+    throw std::runtime_error{std::format("Unable to create {}: {}", cache_directory.string(), error_code.message())};
+  }
+
+  const Header header{.magic = kMagic, .version = kVersion, .key = key, .word_count = spirv.size()};
+  WriteFileAtomically(GetCacheFilepath(cache_directory, key),
+                      {std::as_bytes(std::span{&header, 1}), std::as_bytes(spirv)});
+}
+
+std::optional<std::vector<std::uint32_t>> spirv_cache::LoadSpirv(const std::filesystem::path& cache_directory,
+                                                                 const std::uint64_t key) {
+  std::ifstream ifstream{GetCacheFilepath(cache_directory, key), std::ios::binary};
+  if (!ifstream) return std::nullopt;
+
+  Header header;
+  ifstream.read(reinterpret_cast<char*>(&header), sizeof(Header));  // NOLINT(*-reinterpret-cast)
+  if (!ifstream || header.magic != kMagic || header.version != kVersion || header.key != key) return std::nullopt;
+
+  // compare against the remaining file size before allocating to reject corrupt word counts
+  const auto data_begin = ifstream.tellg();
+  ifstream.seekg(0, std::ios::end);
+  const auto data_size = static_cast<std::uint64_t>(ifstream.tellg() - data_begin);
+  if (header.word_count == 0 || header.word_count != data_size / sizeof(std::uint32_t)
+      || data_size % sizeof(std::uint32_t) != 0) {
+    return std::nullopt;
+  }
+
+  std::vector<std::uint32_t> spirv(header.word_count);
+  ifstream.seekg(data_begin);
+  ifstream.read(reinterpret_cast<char*>(spirv.data()),  // NOLINT(*-reinterpret-cast)
+                static_cast<std::streamsize>(spirv.size() * sizeof(std::uint32_t)));
+  if (!ifstream) return std::nullopt;
+
+  return spirv;
+}
+
+}  // namespace gfx
@@ -0,0 +1,45 @@
+#ifndef GRAPHICS_SPIRV_CACHE_H_
+#define GRAPHICS_SPIRV_CACHE_H_
+
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <span>
+#include <string_view>
+#include <vector>
+
+namespace gfx::spirv_cache {
+
+/**
+ * \brief Gets the key of compiled SPIR-V in a SPIR-V cache directory.
+ * \param glsl_source The GLSL source code the SPIR-V is compiled from.
+ * \param compile_options A description of the shader stage, compiler version and compiler options which must change
+ *                        whenever the SPIR-V compiled from the same source would change.
+ * \return A 64-bit FNV-1a hash of \p glsl_source and \p compile_options which is stable across processes and builds.
+ */
+[[nodiscard]] std::uint64_t GetKey(std::string_view glsl_source, std::string_view compile_options) noexcept;
+
+/**
+ * \brief Saves SPIR-V to a cache directory.
+ * \details The cache file is written to a temporary file that is renamed to its final path so concurrent processes
+ *          compiling the same shader never observe a partially written cache file.
+ * \param cache_directory The directory to save the cache file in which is created if it does not exist.
+ * \param key The key returned by \ref GetKey for the source and options the SPIR-V is compiled from.
+ * \param spirv The SPIR-V to save.
+ * \throw std::runtime_error Thrown if the cache file cannot be written.
+ */
+void SaveSpirv(const std::filesystem::path& cache_directory, std::uint64_t key, std::span<const std::uint32_t> spirv);
+
+/**
+ * \brief Loads SPIR-V from a cache directory.
+ * \param cache_directory The directory the cache file was saved in.
+ * \param key The key returned by \ref GetKey for the source and options the SPIR-V is compiled from.
+ * \return The cached SPIR-V or \c std::nullopt if the cache file does not exist, was written by an incompatible
+ *         version, or is truncated.
+ */
+[[nodiscard]] std::optional<std::vector<std::uint32_t>> LoadSpirv(const std::filesystem::path& cache_directory,
+                                                                  std::uint64_t key);
+
+}  // namespace gfx::spirv_cache
+
+#endif  // GRAPHICS_SPIRV_CACHE_H_
@@ -76,7 +76,7 @@ std::tuple<vk::UniqueSwapchainKHR, vk::Format, vk::Extent2D> CreateSwapchain(con
                                                    .presentMode = GetSwapchainPresentMode(*physical_device, surface),
                                                    .clipped = vk::True};
 
-  const auto [graphics_index, present_index] = physical_device.queue_family_indices();
+  const auto [graphics_index, present_index, _] = physical_device.queue_family_indices();
   const std::array queue_family_indices{graphics_index, present_index};
   if (graphics_index != present_index) {
     swapchain_create_info.imageSharingMode = vk::SharingMode::eConcurrent;
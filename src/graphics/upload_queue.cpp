@@ -0,0 +1,144 @@
+#include "graphics/upload_queue.h"
+
+#include <algorithm>
+#include <cassert>
+#include <limits>
+#include <ranges>
+#include <utility>
+
+#include "graphics/device.h"
+
+namespace {
+
+std::vector<std::uint32_t> GetQueueFamilyIndices(const gfx::QueueFamilyIndices& queue_family_indices) {
+  const auto [graphics_index, _, transfer_index] = queue_family_indices;
+  if (graphics_index == transfer_index) return std::vector{graphics_index};
+  return std::vector{graphics_index, transfer_index};
+}
+
+}  // namespace
+
+namespace gfx {
+
+UploadQueue::UploadQueue(const Device& device, const vk::DeviceSize staging_buffer_size)
+    : device_{*device},
+      transfer_queue_{device.transfer_queue()},
+      queue_family_indices_{GetQueueFamilyIndices(device.physical_device().queue_family_indices())},
+      command_pool_{device->createCommandPoolUnique(vk::CommandPoolCreateInfo{
+          .flags = vk::CommandPoolCreateFlagBits::eTransient,
+          .queueFamilyIndex = device.physical_device().queue_family_indices().transfer_index})},
+      staging_buffer_{device,
+                      staging_buffer_size,
+                      vk::BufferUsageFlagBits::eTransferSrc,
+                      vk::MemoryPropertyFlagBits::eHostVisible | vk::MemoryPropertyFlagBits::eHostCoherent} {}
+
+UploadQueue::~UploadQueue() noexcept {
+  if (submitted_batches_.empty()) return;
+  const auto fences = submitted_batches_
+                      | std::views::transform([](const auto& batch) { return *batch.fence; })
+                      | std::ranges::to<std::vector>();
+  const auto result = device_.waitForFences(fences, vk::True, std::numeric_limits<std::uint64_t>::max());
+  assert(result == vk::Result::eSuccess);
+}
+
+std::uint64_t UploadQueue::Upload(const std::span<const std::byte> data,
+                                  const vk::Buffer dst_buffer,
+                                  const vk::DeviceSize dst_offset) {
+  for (vk::DeviceSize offset = 0; offset < data.size();) {
+    const auto copy_size = std::min<vk::DeviceSize>(data.size() - offset, staging_buffer_.size());
+    const auto staging_offset = Allocate(copy_size);
+    staging_buffer_.Copy<std::byte>(data.subspan(offset, copy_size), staging_offset);
+
+    if (!batch_.command_buffer) {
+      batch_.command_buffer = std::move(device_.allocateCommandBuffersUnique(
+          vk::CommandBufferAllocateInfo{.commandPool = *command_pool_,
+                                        .level = vk::CommandBufferLevel::ePrimary,
+                                        .commandBufferCount = 1})[0]);
+      batch_.command_buffer->begin(vk::CommandBufferBeginInfo{.flags = vk::CommandBufferUsageFlagBits::eOneTimeSubmit});
+    }
+    batch_.command_buffer->copyBuffer(
+        *staging_buffer_,
+        dst_buffer,
+        vk::BufferCopy{.srcOffset = staging_offset, .dstOffset = dst_offset + offset, .size = copy_size});
+    offset += copy_size;
+  }
+
+  // the batch recording copies is assigned the next batch ID when it is submitted
+  return batch_.command_buffer ? next_batch_id_ : next_batch_id_ - 1;
+}
+
+std::uint64_t UploadQueue::Submit() {
+  if (!batch_.command_buffer) return next_batch_id_ - 1;
+
+  batch_.command_buffer->end();
+  batch_.id = next_batch_id_++;
+  batch_.fence = device_.createFenceUnique(vk::FenceCreateInfo{});
+  batch_.staging_end = staging_end_;
+
+  const auto command_buffer = *batch_.command_buffer;
+  transfer_queue_.submit(vk::SubmitInfo{.commandBufferCount = 1, .pCommandBuffers = &command_buffer}, *batch_.fence);
+  submitted_batches_.push_back(std::exchange(batch_, Batch{}));
+  return next_batch_id_ - 1;
+}
+
+bool UploadQueue::IsComplete(const std::uint64_t batch_id) {
+  ReleaseCompletedBatches();
+  return batch_id <= completed_batch_id_;
+}
+
+void UploadQueue::Wait(const std::uint64_t batch_id) {
+  assert(batch_id <= next_batch_id_);
+  if (batch_id == next_batch_id_) Submit();
+  while (completed_batch_id_ < batch_id) WaitForOldestBatch();
+}
+
+vk::DeviceSize UploadQueue::Allocate(const vk::DeviceSize size) {
+  const auto capacity = staging_buffer_.size();
+  assert(size <= capacity);
+
+  for (;;) {
+    // allocations are contiguous so skip to the start of the ring buffer if the allocation would wrap around its end
+    const auto offset = staging_end_ % capacity;
+    const auto padding = offset + size > capacity ? capacity - offset : 0;
+
+    if (staging_begin_ == staging_end_) {
+      staging_begin_ = staging_end_ += padding;
+    } else if (staging_end_ + padding + size - staging_begin_ > capacity) {
+      // submit the recording batch if it holds the only staging memory in use so there is a batch to wait for
+      if (submitted_batches_.empty()) Submit();
+      WaitForOldestBatch();
+      continue;
+    } else {
+      staging_end_ += padding;
+    }
+
+    const auto allocation_offset = staging_end_ % capacity;
+    staging_end_ += size;
+    return allocation_offset;
+  }
+}
+
+void UploadQueue::ReleaseOldestBatch() {
+  const auto& batch = submitted_batches_.front();
+  staging_begin_ = batch.staging_end;
+  completed_batch_id_ = batch.id;
+  submitted_batches_.pop_front();
+}
+
+void UploadQueue::ReleaseCompletedBatches() {
+  while (!submitted_batches_.empty()
+         && device_.getFenceStatus(*submitted_batches_.front().fence) == vk::Result::eSuccess) {
+    ReleaseOldestBatch();
+  }
+}
+
+void UploadQueue::WaitForOldestBatch() {
+  assert(!submitted_batches_.empty());
+  const auto result = device_.waitForFences(*submitted_batches_.front().fence,
+                                            vk::True,
+                                            std::numeric_limits<std::uint64_t>::max());
+  vk::resultCheck(result, "Upload fence failed to enter a signaled state");
+  ReleaseOldestBatch();
+}
+
+}  // namespace gfx
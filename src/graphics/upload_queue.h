@@ -0,0 +1,163 @@
+#ifndef GRAPHICS_UPLOAD_QUEUE_H_
+#define GRAPHICS_UPLOAD_QUEUE_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include <vulkan/vulkan.hpp>
+
+#include "graphics/buffer.h"
+
+namespace gfx {
+class Device;
+
+/**
+ * \brief Asynchronously copies data to device-local buffers through a persistently mapped staging ring buffer.
+ * \details Copies are recorded into a batch which is submitted to the transfer queue without waiting for completion.
+ *          Each submitted batch signals a fence that is polled to determine when its copies have completed and its
+ *          staging memory can be reused. Staging memory is only waited on when the ring buffer is full. This class is
+ *          not thread-safe and must be externally synchronized with other submissions when the transfer queue falls
+ *          back to the graphics queue.
+ */
+class UploadQueue {
+public:
+  /** \brief The default staging ring buffer size in bytes. */
+  static constexpr vk::DeviceSize kDefaultStagingBufferSize = vk::DeviceSize{64} << 20U;
+
+  /**
+   * \brief Initializes an upload queue.
+   * \param device The device whose transfer queue copies are submitted to.
+   * \param staging_buffer_size The size of the staging ring buffer in bytes. Uploads larger than the ring buffer are
+   *                            split into multiple copies.
+   */
+  explicit UploadQueue(const Device& device, vk::DeviceSize staging_buffer_size = kDefaultStagingBufferSize);
+
+  UploadQueue(const UploadQueue&) = delete;
+  UploadQueue(UploadQueue&&) = delete;
+
+  UploadQueue& operator=(const UploadQueue&) = delete;
+  UploadQueue& operator=(UploadQueue&&) = delete;
+
+  /** \brief Waits for submitted batches to complete before their command buffers and fences are destroyed. */
+  ~UploadQueue() noexcept;
+
+  /** \brief Gets the queue families that must share buffers written by this queue and read by the graphics queue. */
+  [[nodiscard]] std::span<const std::uint32_t> queue_family_indices() const noexcept { return queue_family_indices_; }
+
+  /**
+   * \brief Records a copy of \p data to \p dst_buffer in the current batch.
+   * \details \p data is copied to the staging buffer before returning so it does not need to outlive the upload.
+   *          \p dst_buffer must remain valid until the returned batch completes.
+   * \return The ID of the batch that performs the copy.
+   */
+  std::uint64_t Upload(std::span<const std::byte> data, vk::Buffer dst_buffer, vk::DeviceSize dst_offset = 0);
+
+  /**
+   * \brief Creates a device-local buffer shared with the graphics queue and records a copy of \p data to it.
+   * \details The buffer must not be accessed by the device until the batch that performs the copy completes.
+   */
+  template <typename T>
+  [[nodiscard]] Buffer CreateBuffer(const Device& device,
+                                    const vk::BufferUsageFlags buffer_usage_flags,
+                                    const std::vector<T>& data) {
+    Buffer buffer{device,
+                  sizeof(T) * data.size(),
+                  buffer_usage_flags | vk::BufferUsageFlagBits::eTransferDst,
+                  vk::MemoryPropertyFlagBits::eDeviceLocal,
+                  queue_family_indices_};
+    Upload(std::as_bytes(std::span{data}), *buffer);
+    return buffer;
+  }
+
+  /**
+   * \brief Submits the current batch if it has recorded copies.
+   * \return The ID of the last submitted batch which completes after every copy recorded so far.
+   */
+  std::uint64_t Submit();
+
+  /** \brief Determines if every copy in a batch has completed without blocking. */
+  [[nodiscard]] bool IsComplete(std::uint64_t batch_id);
+
+  /** \brief Submits and blocks until every copy in a batch has completed. */
+  void Wait(std::uint64_t batch_id);
+
+private:
+  struct Batch {
+    std::uint64_t id = 0;
+    vk::UniqueCommandBuffer command_buffer;
+    vk::UniqueFence fence;
+    std::uint64_t staging_end = 0;
+  };
+
+  /** \brief Allocates contiguous staging memory and returns its offset in the staging buffer. */
+  vk::DeviceSize Allocate(vk::DeviceSize size);
+
+  void ReleaseOldestBatch();
+  void ReleaseCompletedBatches();
+  void WaitForOldestBatch();
+
+  vk::Device device_;
+  vk::Queue transfer_queue_;
+  std::vector<std::uint32_t> queue_family_indices_;
+  vk::UniqueCommandPool command_pool_;
+  Buffer staging_buffer_;
+
+  /** \brief The batch recording copies or an empty batch if there are no copies since the last submission. */
+  Batch batch_;
+  std::deque<Batch> submitted_batches_;
+  std::uint64_t next_batch_id_ = 1;
+  std::uint64_t completed_batch_id_ = 0;
+
+  /**
+   * \brief Monotonically increasing byte counters whose difference is the staging memory in use and whose values
+   *        modulo the staging buffer size are offsets in the ring buffer.
+   */
+  std::uint64_t staging_begin_ = 0;
+  std::uint64_t staging_end_ = 0;
+};
+
+/**
+ * \brief A handle to an upload queue batch that waits for the batch to complete when destroyed or reassigned.
+ * \details Owners of buffers written by an upload queue hold this handle so their buffers outlive pending copies.
+ */
+class PendingUpload {
+public:
+  PendingUpload() noexcept = default;
+  PendingUpload(UploadQueue& upload_queue, const std::uint64_t batch_id) noexcept
+      : upload_queue_{&upload_queue}, batch_id_{batch_id} {}
+
+  PendingUpload(const PendingUpload&) = delete;
+  PendingUpload(PendingUpload&& pending_upload) noexcept { *this = std::move(pending_upload); }
+
+  PendingUpload& operator=(const PendingUpload&) = delete;
+  PendingUpload& operator=(PendingUpload&& pending_upload) noexcept {
+    if (this != &pending_upload) {
+      Wait();
+      upload_queue_ = std::exchange(pending_upload.upload_queue_, nullptr);
+      batch_id_ = pending_upload.batch_id_;
+    }
+    return *this;
+  }
+
+  ~PendingUpload() noexcept { Wait(); }
+
+  /** \brief Determines if the upload has completed without blocking. */
+  [[nodiscard]] bool IsComplete() const { return upload_queue_ == nullptr || upload_queue_->IsComplete(batch_id_); }
+
+  /** \brief Blocks until the upload has completed. */
+  void Wait() {
+    if (upload_queue_ != nullptr) std::exchange(upload_queue_, nullptr)->Wait(batch_id_);
+  }
+
+private:
+  UploadQueue* upload_queue_ = nullptr;
+  std::uint64_t batch_id_ = 0;
+};
+
+}  // namespace gfx
+
+#endif  // GRAPHICS_UPLOAD_QUEUE_H_
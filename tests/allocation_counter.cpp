@@ -0,0 +1,81 @@
+#include "tests/allocation_counter.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+#ifdef _WIN32
+#include <malloc.h>
+#endif
+
+namespace {
+
+std::atomic<std::size_t> allocation_count = 0;
+
+// NOLINTBEGIN(*-no-malloc, *-owning-memory)
+void* AlignedAlloc(const std::size_t size, const std::align_val_t alignment) noexcept {
+  const auto alignment_bytes = static_cast<std::size_t>(alignment);
+#ifdef _WIN32
+  return _aligned_malloc(size == 0 ? 1 : size, alignment_bytes);
+#else
+  // aligned_alloc requires the size to be a multiple of the alignment
+  const auto aligned_size = (std::max(size, std::size_t{1}) + alignment_bytes - 1) / alignment_bytes * alignment_bytes;
+  return std::aligned_alloc(alignment_bytes, aligned_size);
+#endif
+}
+
+void AlignedFree(void* const memory) noexcept {
+#ifdef _WIN32
+  _aligned_free(memory);
+#else
+  std::free(memory);
+#endif
+}
+// NOLINTEND(*-no-malloc, *-owning-memory)
+
+}  // namespace
+
+// NOLINTBEGIN(*-no-malloc, *-owning-memory)
+void* operator new(const std::size_t size) {
+  allocation_count.fetch_add(1, std::memory_order_relaxed);
+  if (auto* const memory = std::malloc(size == 0 ? 1 : size); memory != nullptr) return memory;
+  throw std::bad_alloc{};
+}
+
+void* operator new(const std::size_t size, const std::nothrow_t& /*tag*/) noexcept {
+  allocation_count.fetch_add(1, std::memory_order_relaxed);
+  return std::malloc(size == 0 ? 1 : size);
+}
+
+void operator delete(void* const memory) noexcept { std::free(memory); }
+
+void operator delete(void* const memory, const std::nothrow_t& /*tag*/) noexcept { std::free(memory); }
+
+void operator delete(void* const memory, std::size_t /*size*/) noexcept { std::free(memory); }
+
+// over-aligned allocations are counted too so that they cannot bypass an allocation counter
+void* operator new(const std::size_t size, const std::align_val_t alignment) {
+  allocation_count.fetch_add(1, std::memory_order_relaxed);
+  if (auto* const memory = AlignedAlloc(size, alignment); memory != nullptr) return memory;
+  throw std::bad_alloc{};
+}
+
+void* operator new(const std::size_t size, const std::align_val_t alignment, const std::nothrow_t& /*tag*/) noexcept {
+  allocation_count.fetch_add(1, std::memory_order_relaxed);
+  return AlignedAlloc(size, alignment);
+}
+
+void operator delete(void* const memory, std::align_val_t /*alignment*/) noexcept { AlignedFree(memory); }
+
+void operator delete(void* const memory, std::align_val_t /*alignment*/, const std::nothrow_t& /*tag*/) noexcept {
+  AlignedFree(memory);
+}
+
+void operator delete(void* const memory, std::size_t /*size*/, std::align_val_t /*alignment*/) noexcept {
+  AlignedFree(memory);
+}
+// NOLINTEND(*-no-malloc, *-owning-memory)
+
+std::size_t gfx::test::GetAllocationCount() noexcept { return allocation_count.load(std::memory_order_relaxed); }
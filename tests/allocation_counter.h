@@ -0,0 +1,30 @@
+#ifndef TESTS_ALLOCATION_COUNTER_H_
+#define TESTS_ALLOCATION_COUNTER_H_
+
+#include <cstddef>
+
+namespace gfx::test {
+
+/** \brief Gets the number of calls to global operator new made by any thread since the test executable started. */
+std::size_t GetAllocationCount() noexcept;
+
+/**
+ * \brief Counts the heap allocations made through global operator new while it is in scope.
+ * \details Global operator new including its over-aligned overloads is replaced for the entire test executable so that
+ *          allocations made by the standard library containers used throughout the project are counted. Allocations
+ *          made by other threads while the counter is in scope are included in the count.
+ */
+class AllocationCounter {
+public:
+  AllocationCounter() noexcept : initial_count_{GetAllocationCount()} {}
+
+  /** \brief Gets the number of allocations made since the counter was created. */
+  [[nodiscard]] std::size_t count() const noexcept { return GetAllocationCount() - initial_count_; }
+
+private:
+  std::size_t initial_count_;
+};
+
+}  // namespace gfx::test
+
+#endif  // TESTS_ALLOCATION_COUNTER_H_
@@ -0,0 +1,62 @@
+#include "concurrency/parallel_for.h"
+
+#include <atomic>
+#include <cstddef>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace {
+
+constexpr std::size_t kSize = 10'000;
+constexpr std::size_t kMinChunkSize = 16;
+
+TEST(ParallelForTest, ProcessesEachElementExactlyOnce) {
+  std::vector<int> counts(kSize, 0);
+  gfx::ParallelFor(
+      kSize,
+      [&](const std::size_t begin, const std::size_t end) {
+        for (auto i = begin; i < end; ++i) ++counts[i];
+      },
+      kMinChunkSize);
+  EXPECT_EQ(counts, std::vector<int>(kSize, 1));
+}
+
+TEST(ParallelForTest, EmptyRangeProcessesNoElements) {
+  auto invocation_count = 0;
+  gfx::ParallelFor(0, [&](const std::size_t begin, const std::size_t end) {
+    invocation_count += static_cast<int>(end - begin);
+  });
+  EXPECT_EQ(0, invocation_count);
+}
+
+TEST(ParallelForTest, NestedInvocationProcessesRangeOnTheCallingThread) {
+  std::atomic<int> nested_thread_count = 0;
+  gfx::ParallelFor(
+      kSize,
+      [&](const std::size_t, const std::size_t) {
+        const auto thread_id = std::this_thread::get_id();
+        gfx::ParallelFor(
+            kSize,
+            [&](const std::size_t, const std::size_t) {
+              if (std::this_thread::get_id() != thread_id) ++nested_thread_count;
+            },
+            kMinChunkSize);
+      },
+      kMinChunkSize);
+  EXPECT_EQ(0, nested_thread_count);
+}
+
+TEST(ParallelForTest, ExceptionIsRethrownOnTheCallingThread) {
+  EXPECT_THROW(gfx::ParallelFor(
+                   kSize,
+                   [](const std::size_t begin, const std::size_t end) {
+                     if (begin <= kSize - 1 && kSize - 1 < end) throw std::runtime_error{"Invalid element"};
+                   },
+                   kMinChunkSize),
+               std::runtime_error);
+}
+
+}  // namespace
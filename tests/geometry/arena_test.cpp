@@ -0,0 +1,47 @@
+#include "geometry/arena.h"
+
+#include <ranges>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace {
+
+TEST(ArenaTest, InsertReturnsConsecutiveIndices) {
+  gfx::Arena<int> arena;
+  EXPECT_EQ(0, arena.Insert(42));
+  EXPECT_EQ(1, arena.Insert(43));
+  EXPECT_EQ(2, arena.size());
+  EXPECT_EQ(42, arena[0]);
+  EXPECT_EQ(43, arena[1]);
+}
+
+TEST(ArenaTest, EraseLeavesATombstoneAndPreservesRemainingIndices) {
+  gfx::Arena<int> arena;
+  for (const auto value : {0, 1, 2}) arena.Insert(value);
+  arena.Erase(1);
+
+  EXPECT_EQ(2, arena.size());
+  EXPECT_EQ(3, arena.slot_count());
+  EXPECT_FALSE(arena.contains(1));
+  EXPECT_EQ(2, arena[2]);
+  EXPECT_EQ(arena.indices() | std::ranges::to<std::vector>(), (std::vector{0u, 2u}));
+}
+
+#ifndef NDEBUG
+
+TEST(ArenaTest, GetErasedElementCausesProgramExit) {
+  gfx::Arena<int> arena;
+  arena.Erase(arena.Insert(42));
+  EXPECT_DEATH({ std::ignore = arena[0]; }, "");  // NOLINT(whitespace/newline)
+}
+
+TEST(ArenaTest, EraseErasedElementCausesProgramExit) {
+  gfx::Arena<int> arena;
+  arena.Erase(arena.Insert(42));
+  EXPECT_DEATH(arena.Erase(0), "");  // NOLINT(whitespace/newline)
+}
+
+#endif
+
+}  // namespace
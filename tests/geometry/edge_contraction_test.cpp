@@ -0,0 +1,343 @@
+#include "geometry/edge_contraction.h"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <ranges>
+#include <span>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include <glm/glm.hpp>
+#include <gtest/gtest.h>
+
+#include "geometry/half_edge_mesh.h"
+#include "geometry/vertex_attributes.h"
+#include "graphics/mesh.h"
+#include "tests/allocation_counter.h"
+#include "tests/device.h"
+#include "tests/geometry/sphere.h"
+
+namespace {
+
+constexpr auto kEpsilon = 1.0e-3f;
+
+/** \brief Creates a unit sphere whose texture coordinates and normals are linear functions of position. */
+gfx::Mesh CreateSphere(const int subdivision_count) {
+  // linear attributes are preserved exactly by the attribute quadrics
+  return gfx::test::CreateSphereMesh(subdivision_count, [](const glm::vec3& position) {
+    return gfx::Mesh::Vertex{.position = position,
+                             .texture_coordinates = glm::vec2{position.x, position.y} / 2.0f + 0.5f,
+                             .normal = position};
+  });
+}
+
+/** \brief The tangent, bitangent, and outward normal of each face of a cube centered at the origin. */
+constexpr std::array<std::array<glm::vec3, 3>, 6> kCubeFaceFrames{{{{{0, 1, 0}, {0, 0, 1}, {1, 0, 0}}},
+                                                                  {{{0, 0, 1}, {0, 1, 0}, {-1, 0, 0}}},
+                                                                  {{{0, 0, 1}, {1, 0, 0}, {0, 1, 0}}},
+                                                                  {{{1, 0, 0}, {0, 0, 1}, {0, -1, 0}}},
+                                                                  {{{1, 0, 0}, {0, 1, 0}, {0, 0, 1}}},
+                                                                  {{{0, 1, 0}, {1, 0, 0}, {0, 0, -1}}}}};
+
+/**
+ * \brief Creates a cube spanning [-1, 1] whose faces are subdivided into a grid.
+ * \details Each cube face has its own vertices with texture coordinates spanning [0, 1] and the face normal so that
+ *          vertices are split along every cube edge as they are by an OBJ loader for a mesh with a texture seam.
+ */
+gfx::Mesh CreateSeamedCube(const int subdivision_count) {
+  std::vector<gfx::Mesh::Vertex> vertices;
+  std::vector<std::uint32_t> indices;
+  const auto row_size = static_cast<std::uint32_t>(subdivision_count + 1);
+
+  for (const auto& [tangent, bitangent, normal] : kCubeFaceFrames) {
+    const auto first_vertex = static_cast<std::uint32_t>(vertices.size());
+    for (auto i = 0; i <= subdivision_count; ++i) {
+      for (auto j = 0; j <= subdivision_count; ++j) {
+        const auto texture_coordinates = glm::vec2{j, i} / static_cast<float>(subdivision_count);
+        vertices.push_back(
+            gfx::Mesh::Vertex{.position = normal + (2.0f * texture_coordinates.x - 1.0f) * tangent
+                                          + (2.0f * texture_coordinates.y - 1.0f) * bitangent,
+                              .texture_coordinates = texture_coordinates,
+                              .normal = normal});
+      }
+    }
+    for (std::uint32_t i = 0; i + 1 < row_size; ++i) {
+      for (std::uint32_t j = 0; j + 1 < row_size; ++j) {
+        const auto v00 = first_vertex + i * row_size + j;
+        const auto v01 = v00 + 1;
+        const auto v10 = v00 + row_size;
+        const auto v11 = v10 + 1;
+        indices.insert(indices.end(), {v00, v01, v11, v00, v11, v10});
+      }
+    }
+  }
+  return gfx::Mesh{gfx::test::Device::Get(), std::move(vertices), std::move(indices)};
+}
+
+/**
+ * \brief Extracts the faces of a mesh whose centroid is above the xy-plane as a mesh region.
+ * \details Vertices also referenced by faces below the plane are locked and every face below the plane incident to one
+ *          of those vertices is included as a halo face.
+ */
+gfx::MeshRegion CreateUpperRegion(const gfx::Mesh& mesh) {
+  const auto& vertices = mesh.vertices();
+  const auto& indices = mesh.indices();
+  const auto face_count = indices.size() / 3;
+  const auto is_upper_face = [&](const std::size_t face) {
+    return vertices[indices[3 * face]].position.z + vertices[indices[3 * face + 1]].position.z
+               + vertices[indices[3 * face + 2]].position.z
+           > 0.0f;
+  };
+
+  std::vector<std::uint8_t> is_upper_vertex(vertices.size(), 0);
+  std::vector<std::uint8_t> is_lower_vertex(vertices.size(), 0);
+  for (std::size_t face = 0; face < face_count; ++face) {
+    auto& is_face_vertex = is_upper_face(face) ? is_upper_vertex : is_lower_vertex;
+    for (std::size_t i = 0; i < 3; ++i) is_face_vertex[indices[3 * face + i]] = 1;
+  }
+
+  gfx::MeshRegion region;
+  std::vector<std::uint32_t> region_ids(vertices.size(), gfx::kInvalidIndex);
+  const auto add_face = [&](const std::size_t face) {
+    for (std::size_t i = 0; i < 3; ++i) {
+      const auto id = indices[3 * face + i];
+      if (region_ids[id] == gfx::kInvalidIndex) {
+        region_ids[id] = static_cast<std::uint32_t>(region.positions.size());
+        region.positions.push_back(vertices[id].position);
+        region.locked_vertices.push_back(is_lower_vertex[id]);
+      }
+      region.indices.push_back(region_ids[id]);
+    }
+  };
+
+  for (std::size_t face = 0; face < face_count; ++face) {
+    if (is_upper_face(face)) add_face(face);
+  }
+  region.face_count = region.indices.size() / 3;
+  region.closed_vertex_count = static_cast<std::uint32_t>(region.positions.size());
+
+  for (std::size_t face = 0; face < face_count; ++face) {
+    if (!is_upper_face(face) && std::ranges::any_of(std::span{indices}.subspan(3 * face, 3), [&](const auto id) {
+          return is_upper_vertex[id] != 0 && is_lower_vertex[id] != 0;
+        })) {
+      add_face(face);
+    }
+  }
+  return region;
+}
+
+TEST(EdgeContractionTest, ContractEdgesDoesNotAllocateForEachEdgeContraction) {
+  const auto sphere = CreateSphere(4);
+  const auto count_allocations = [&](const float target_face_count) {
+    gfx::HalfEdgeMesh half_edge_mesh{sphere};
+    auto quadrics = gfx::CreateErrorQuadrics(half_edge_mesh, half_edge_mesh.vertices().slot_count());
+    auto edge_contractions = gfx::CreateEdgeContractions(half_edge_mesh, quadrics, {});
+
+    const gfx::test::AllocationCounter allocation_counter;
+    gfx::ContractEdges(
+        half_edge_mesh, quadrics, edge_contractions, {}, gfx::VertexPlacement::kOptimal, target_face_count);
+    return allocation_counter.count();
+  };
+
+  // only scratch storage allocated once per call is permitted regardless of the number of edges contracted
+  EXPECT_EQ(count_allocations(2040.0f), count_allocations(200.0f));
+}
+
+TEST(EdgeContractionTest, ContractIndependentEdgesProducesAClosedManifoldMeshWithTheTargetFaceCount) {
+  const auto sphere = CreateSphere(4);
+  gfx::HalfEdgeMesh half_edge_mesh{sphere};
+  auto quadrics = gfx::CreateErrorQuadrics(half_edge_mesh, half_edge_mesh.vertices().slot_count());
+  gfx::ContractIndependentEdges(half_edge_mesh, quadrics, {}, 200.0f);
+
+  const auto& vertices = half_edge_mesh.vertices();
+  const auto& edges = half_edge_mesh.edges();
+  const auto& faces = half_edge_mesh.faces();
+  EXPECT_LT(faces.size(), 200);
+  EXPECT_GE(faces.size(), 196);
+  EXPECT_EQ(quadrics.size(), vertices.slot_count());
+
+  // the Euler characteristic of a sphere is preserved and every half-edge is consistently connected
+  EXPECT_EQ(vertices.size() + faces.size(), edges.size() / 2 + 2);
+  for (const auto edge : edges.indices()) {
+    ASSERT_TRUE(edges.contains(edges[edge].flip()));
+    EXPECT_EQ(edges[edges[edge].flip()].flip(), edge);
+    EXPECT_EQ(edges[edges[edges[edge].next()].next()].next(), edge);
+    EXPECT_TRUE(faces.contains(edges[edge].face()));
+    EXPECT_TRUE(vertices.contains(edges[edge].vertex()));
+  }
+  for (const auto id : vertices.indices()) {
+    EXPECT_NEAR(glm::length(vertices[id].position()), 1.0f, 0.1f);  // NOLINT(*-magic-numbers)
+  }
+}
+
+TEST(EdgeContractionTest, ContractEdgesWithEachVertexPlacementReducesTheFaceCountToTheTarget) {
+  const auto sphere = CreateSphere(3);
+
+  for (const auto placement : {gfx::VertexPlacement::kOptimal,
+                               gfx::VertexPlacement::kOptimalLineSearch,
+                               gfx::VertexPlacement::kMidpoint,
+                               gfx::VertexPlacement::kEndpoint}) {
+    gfx::HalfEdgeMesh half_edge_mesh{sphere};
+    auto quadrics = gfx::CreateErrorQuadrics(half_edge_mesh, half_edge_mesh.vertices().slot_count());
+    gfx::ContractEdges(half_edge_mesh, quadrics, {}, 128.0f, placement);
+    EXPECT_LT(half_edge_mesh.faces().size(), 128);
+  }
+}
+
+TEST(EdgeContractionTest, ContractEdgesWithEndpointPlacementOnlyReferencesInputPositions) {
+  const auto sphere = CreateSphere(3);
+  gfx::HalfEdgeMesh half_edge_mesh{sphere};
+  auto quadrics = gfx::CreateErrorQuadrics(half_edge_mesh, half_edge_mesh.vertices().slot_count());
+  gfx::ContractEdges(half_edge_mesh, quadrics, {}, 128.0f, gfx::VertexPlacement::kEndpoint);
+
+  const auto& vertices = half_edge_mesh.vertices();
+  for (const auto id : vertices.indices()) {
+    EXPECT_TRUE(std::ranges::any_of(sphere.vertices(), [&](const gfx::Mesh::Vertex& vertex) {
+      return vertex.position == vertices[id].position();
+    }));
+  }
+}
+
+TEST(EdgeContractionTest, SimplifyWithAttributesReducesTheFaceCountToTheTarget) {
+  const auto sphere = CreateSphere(3);
+
+  for (const auto attributes : {gfx::VertexAttributes::kPosition,
+                                gfx::VertexAttributes::kPositionNormal,
+                                gfx::VertexAttributes::kPositionTextureCoordinates,
+                                gfx::VertexAttributes::kPositionNormalTextureCoordinates}) {
+    const auto simplified_mesh = gfx::SimplifyWithAttributes(sphere.vertices(), sphere.indices(), attributes, 128.0f);
+    EXPECT_LT(simplified_mesh.indices.size() / 3, 128);
+    EXPECT_TRUE(std::ranges::all_of(simplified_mesh.indices,
+                                    [&](const auto index) { return index < simplified_mesh.vertices.size(); }));
+  }
+}
+
+TEST(EdgeContractionTest, SimplifyWithTextureCoordinatesPreservesLinearTextureCoordinates) {
+  const auto sphere = CreateSphere(3);
+  const auto simplified_mesh = gfx::SimplifyWithAttributes(
+      sphere.vertices(), sphere.indices(), gfx::VertexAttributes::kPositionTextureCoordinates, 128.0f);
+
+  for (const auto& vertex : simplified_mesh.vertices) {
+    const auto expected_texture_coordinates = glm::vec2{vertex.position.x, vertex.position.y} / 2.0f + 0.5f;
+    EXPECT_NEAR(vertex.texture_coordinates.x, expected_texture_coordinates.x, kEpsilon);
+    EXPECT_NEAR(vertex.texture_coordinates.y, expected_texture_coordinates.y, kEpsilon);
+  }
+}
+
+TEST(EdgeContractionTest, SimplifyWithNormalsProducesUnitNormals) {
+  const auto sphere = CreateSphere(3);
+  const auto simplified_mesh = gfx::SimplifyWithAttributes(
+      sphere.vertices(), sphere.indices(), gfx::VertexAttributes::kPositionNormal, 128.0f);
+
+  for (const auto& vertex : simplified_mesh.vertices) {
+    EXPECT_NEAR(glm::length(vertex.normal), 1.0f, kEpsilon);
+    EXPECT_GT(glm::dot(vertex.normal, glm::normalize(vertex.position)), 0.99f);  // NOLINT(*-magic-numbers)
+  }
+}
+
+TEST(EdgeContractionTest, SimplifyWithAttributesPreservesTextureSeams) {
+  const auto cube = CreateSeamedCube(4);
+  ASSERT_EQ(cube.vertices().size(), 6 * 5 * 5);
+
+  for (const auto attributes :
+       {gfx::VertexAttributes::kPositionTextureCoordinates, gfx::VertexAttributes::kPositionNormalTextureCoordinates}) {
+    const auto simplified_mesh = gfx::SimplifyWithAttributes(cube.vertices(), cube.indices(), attributes, 24.0f);
+    ASSERT_LT(simplified_mesh.indices.size() / 3, 24);
+
+    // each triangle remains within a single cube face where it keeps the texture coordinates and normal of that face
+    auto area = 0.0f;
+    for (std::size_t i = 0; i < simplified_mesh.indices.size(); i += 3) {
+      const auto& vertex0 = simplified_mesh.vertices[simplified_mesh.indices[i]];
+      const auto& vertex1 = simplified_mesh.vertices[simplified_mesh.indices[i + 1]];
+      const auto& vertex2 = simplified_mesh.vertices[simplified_mesh.indices[i + 2]];
+      const auto normal = glm::cross(vertex1.position - vertex0.position, vertex2.position - vertex0.position);
+      area += glm::length(normal) / 2.0f;
+
+      const auto frame = std::ranges::find_if(kCubeFaceFrames, [&](const auto& cube_face_frame) {
+        return glm::dot(glm::normalize(normal), cube_face_frame[2]) > 1.0f - kEpsilon;
+      });
+      ASSERT_NE(frame, kCubeFaceFrames.end());
+      const auto& [tangent, bitangent, face_normal] = *frame;
+
+      for (const auto* vertex : {&vertex0, &vertex1, &vertex2}) {
+        EXPECT_NEAR(glm::dot(vertex->position, face_normal), 1.0f, kEpsilon);
+        EXPECT_NEAR(vertex->texture_coordinates.x, (glm::dot(vertex->position, tangent) + 1.0f) / 2.0f, kEpsilon);
+        EXPECT_NEAR(vertex->texture_coordinates.y, (glm::dot(vertex->position, bitangent) + 1.0f) / 2.0f, kEpsilon);
+        EXPECT_NEAR(glm::dot(vertex->normal, face_normal), 1.0f, kEpsilon);
+      }
+    }
+    EXPECT_NEAR(area, 24.0f, kEpsilon);  // NOLINT(*-magic-numbers)
+  }
+}
+
+TEST(EdgeContractionTest, SimplifyWithAttributesThrowsAnExceptionForAnOpenMesh) {
+  const auto cube = CreateSeamedCube(2);
+  const auto open_indices = std::span{cube.indices()}.subspan(0, cube.indices().size() - 3);
+  EXPECT_THROW((void)gfx::SimplifyWithAttributes(
+                   cube.vertices(), open_indices, gfx::VertexAttributes::kPositionTextureCoordinates, 4.0f),
+               std::invalid_argument);
+}
+
+TEST(EdgeContractionTest, SimplifyRegionWithoutReductionReturnsTheFacesOwnedByTheRegion) {
+  const auto region = CreateUpperRegion(CreateSphere(3));
+  ASSERT_GT(region.indices.size(), 3 * region.face_count);
+
+  // edges are contracted until the face count is below the target so at most one edge contraction is performed
+  const auto simplified_region = gfx::SimplifyRegion(region, 0.0f);
+  EXPECT_LE(simplified_region.indices.size(), 3 * region.face_count);
+  EXPECT_GE(simplified_region.indices.size(), 3 * (region.face_count - 2));
+  EXPECT_EQ(simplified_region.quadrics.size(), simplified_region.positions.size());
+  EXPECT_EQ(simplified_region.locked_vertex_ids.size(), simplified_region.positions.size());
+}
+
+TEST(EdgeContractionTest, SimplifyRegionKeepsLockedVerticesFixed) {
+  const auto region = CreateUpperRegion(CreateSphere(3));
+  const auto simplified_region = gfx::SimplifyRegion(region, 0.9f);
+
+  // locked vertices are never removed so every locked vertex of an owned face remains in the simplified region
+  const auto locked_vertex_count =
+      std::ranges::count(region.locked_vertices | std::views::take(region.closed_vertex_count), std::uint8_t{1});
+  EXPECT_EQ(std::ranges::count_if(simplified_region.locked_vertex_ids,
+                                  [](const auto id) { return id != gfx::kInvalidIndex; }),
+            locked_vertex_count);
+
+  for (std::size_t i = 0; i < simplified_region.positions.size(); ++i) {
+    if (const auto id = simplified_region.locked_vertex_ids[i]; id != gfx::kInvalidIndex) {
+      ASSERT_LT(id, region.closed_vertex_count);
+      EXPECT_EQ(region.locked_vertices[id], 1);
+      EXPECT_EQ(simplified_region.positions[i], region.positions[id]);
+    }
+  }
+}
+
+TEST(EdgeContractionTest, SimplifyRegionExcludesHaloFaces) {
+  const auto region = CreateUpperRegion(CreateSphere(3));
+  const auto simplified_region = gfx::SimplifyRegion(region, 0.9f);
+  EXPECT_LT(simplified_region.indices.size(), 3 * region.face_count);
+
+  // halo faces only reference locked vertices so they would appear in the output with their original positions
+  const auto get_triangle = [](const std::span<const glm::vec3> positions, const auto& index_group) {
+    auto triangle = index_group | std::views::transform([&](const auto index) {
+                      const auto& position = positions[index];
+                      return std::array{position.x, position.y, position.z};
+                    })
+                    | std::ranges::to<std::vector>();
+    std::ranges::sort(triangle);
+    return triangle;
+  };
+  const auto halo_triangles = region.indices | std::views::drop(3 * region.face_count) | std::views::chunk(3)
+                              | std::views::transform([&](const auto& index_group) {
+                                  return get_triangle(region.positions, index_group);
+                                })
+                              | std::ranges::to<std::vector>();
+
+  for (const auto& index_group : simplified_region.indices | std::views::chunk(3)) {
+    const auto triangle = get_triangle(simplified_region.positions, index_group);
+    EXPECT_EQ(std::ranges::find(halo_triangles, triangle), halo_triangles.end());
+  }
+}
+
+}  // namespace
@@ -4,9 +4,6 @@
 
 #include <gtest/gtest.h>
 
-#include "geometry/face.h"
-#include "geometry/half_edge.h"
-#include "geometry/vertex.h"
 #include "graphics/mesh.h"
 #include "tests/device.h"
 
@@ -45,25 +42,28 @@ gfx::HalfEdgeMesh CreateHalfEdgeMesh() {
   return gfx::HalfEdgeMesh{mesh};
 }
 
-void VerifyEdge(const std::shared_ptr<gfx::Vertex>& v0,
-                const std::shared_ptr<gfx::Vertex>& v1,
-                const std::unordered_map<std::size_t, std::shared_ptr<gfx::HalfEdge>>& edges) {
-  const auto edge01_iterator = edges.find(hash_value(*v0, *v1));
-  const auto edge10_iterator = edges.find(hash_value(*v1, *v0));
-  ASSERT_NE(edge01_iterator, edges.cend());
-  ASSERT_NE(edge10_iterator, edges.cend());
-
-  const auto& edge01 = edge01_iterator->second;
-  const auto& edge10 = edge10_iterator->second;
+std::uint32_t FindEdge(const gfx::HalfEdgeMesh& half_edge_mesh, const std::uint32_t v0, const std::uint32_t v1) {
+  const auto& edges = half_edge_mesh.edges();
+  for (const auto edge01 : edges.indices()) {
+    if (edges[edge01].vertex() == v1 && edges[edges[edge01].flip()].vertex() == v0) {
+      return edge01;
+    }
+  }
+  return gfx::kInvalidIndex;
+}
 
-  EXPECT_EQ(v0, edge10->vertex());
-  EXPECT_EQ(v1, edge01->vertex());
+void VerifyEdge(const gfx::HalfEdgeMesh& half_edge_mesh, const std::uint32_t v0, const std::uint32_t v1) {
+  const auto& edges = half_edge_mesh.edges();
+  const auto edge01 = FindEdge(half_edge_mesh, v0, v1);
+  const auto edge10 = FindEdge(half_edge_mesh, v1, v0);
+  ASSERT_TRUE(edges.contains(edge01));
+  ASSERT_TRUE(edges.contains(edge10));
 
-  EXPECT_EQ(edge01, edge10->flip());
-  EXPECT_EQ(edge10, edge01->flip());
+  EXPECT_EQ(v0, edges[edge10].vertex());
+  EXPECT_EQ(v1, edges[edge01].vertex());
 
-  EXPECT_EQ(edge01, edge01->flip()->flip());
-  EXPECT_EQ(edge10, edge10->flip()->flip());
+  EXPECT_EQ(edge01, edges[edge10].flip());
+  EXPECT_EQ(edge10, edges[edge01].flip());
 }
 
 void VerifyTriangles(const gfx::HalfEdgeMesh& half_edge_mesh, const std::vector<std::uint32_t>& indices) {
@@ -72,34 +72,29 @@ void VerifyTriangles(const gfx::HalfEdgeMesh& half_edge_mesh, const std::vector<
   const auto& faces = half_edge_mesh.faces();
 
   for (std::size_t i = 0; i < indices.size(); i += 3) {
-    const auto v0_iterator = vertices.find(indices[i]);
-    const auto v1_iterator = vertices.find(indices[i + 1]);
-    const auto v2_iterator = vertices.find(indices[i + 2]);
-    ASSERT_NE(v0_iterator, vertices.cend());
-    ASSERT_NE(v1_iterator, vertices.cend());
-    ASSERT_NE(v2_iterator, vertices.cend());
-
-    const auto& v0 = v0_iterator->second;
-    const auto& v1 = v1_iterator->second;
-    const auto& v2 = v2_iterator->second;
-    VerifyEdge(v0, v1, edges);
-    VerifyEdge(v1, v2, edges);
-    VerifyEdge(v2, v0, edges);
-
-    const auto edge01 = edges.at(hash_value(*v0, *v1));
-    const auto edge12 = edges.at(hash_value(*v1, *v2));
-    const auto edge20 = edges.at(hash_value(*v2, *v0));
-    EXPECT_EQ(edge01->next(), edge12);
-    EXPECT_EQ(edge12->next(), edge20);
-    EXPECT_EQ(edge20->next(), edge01);
-
-    const auto face012_iterator = faces.find(hash_value(*v0, *v1, *v2));
-    ASSERT_NE(face012_iterator, faces.cend());
-
-    const auto face012 = face012_iterator->second;
-    EXPECT_EQ(edge01->face(), face012);
-    EXPECT_EQ(edge12->face(), face012);
-    EXPECT_EQ(edge20->face(), face012);
+    const auto v0 = indices[i];
+    const auto v1 = indices[i + 1];
+    const auto v2 = indices[i + 2];
+    ASSERT_TRUE(vertices.contains(v0));
+    ASSERT_TRUE(vertices.contains(v1));
+    ASSERT_TRUE(vertices.contains(v2));
+
+    VerifyEdge(half_edge_mesh, v0, v1);
+    VerifyEdge(half_edge_mesh, v1, v2);
+    VerifyEdge(half_edge_mesh, v2, v0);
+
+    const auto edge01 = FindEdge(half_edge_mesh, v0, v1);
+    const auto edge12 = FindEdge(half_edge_mesh, v1, v2);
+    const auto edge20 = FindEdge(half_edge_mesh, v2, v0);
+    EXPECT_EQ(edges[edge01].next(), edge12);
+    EXPECT_EQ(edges[edge12].next(), edge20);
+    EXPECT_EQ(edges[edge20].next(), edge01);
+
+    const auto face012 = edges[edge01].face();
+    ASSERT_TRUE(faces.contains(face012));
+    EXPECT_EQ(faces[face012], (gfx::Face{vertices[v0], vertices[v1], vertices[v2]}));
+    EXPECT_EQ(edges[edge12].face(), face012);
+    EXPECT_EQ(edges[edge20].face(), face012);
   }
 }
 
@@ -114,20 +109,60 @@ TEST(HalfEdgeMeshTest, CreateHalfEdgeMeshHasCorrectVerticesEdgesFacesAndIndices)
   VerifyTriangles(half_edge_mesh, mesh.indices());
 }
 
+TEST(HalfEdgeMeshTest, CreateHalfEdgeMeshFromPositionsHasCorrectVerticesEdgesFacesAndIndices) {
+  const auto mesh = CreateValidMesh();
+  std::vector<glm::vec3> positions;
+  for (const auto& vertex : mesh.vertices()) positions.push_back(vertex.position);
+  const gfx::HalfEdgeMesh half_edge_mesh{positions, mesh.indices()};
+
+  EXPECT_EQ(10, half_edge_mesh.vertices().size());
+  EXPECT_EQ(38, half_edge_mesh.edges().size());
+  EXPECT_EQ(10, half_edge_mesh.faces().size());
+
+  VerifyTriangles(half_edge_mesh, mesh.indices());
+}
+
 TEST(HalfEdgeMeshTest, ContractEdgeAttachesIndicentEdgesToNewVertex) {
   auto half_edge_mesh = CreateHalfEdgeMesh();
   const auto& vertices = half_edge_mesh.vertices();
-  const auto& edges = half_edge_mesh.edges();
 
-  const auto& v0 = vertices.at(0);
-  const auto& v1 = vertices.at(1);
-  const auto& edge01 = edges.at(hash_value(*v0, *v1));
+  const auto edge01 = FindEdge(half_edge_mesh, 0, 1);
+  const auto position = (vertices[0].position() + vertices[1].position()) / 2.0f;
+  const auto v_new = half_edge_mesh.Contract(edge01, position);
+
+  EXPECT_EQ(10, v_new);
+  EXPECT_EQ(position, vertices[v_new].position());
+  EXPECT_FALSE(vertices.contains(0));
+  EXPECT_FALSE(vertices.contains(1));
+
+  EXPECT_EQ(9, half_edge_mesh.vertices().size());
+  EXPECT_EQ(32, half_edge_mesh.edges().size());
+  EXPECT_EQ(8, half_edge_mesh.faces().size());
+
+  // NOLINTBEGIN(*-magic-numbers)
+  VerifyTriangles(half_edge_mesh, std::vector{2u, 3u,  10u,   // f0
+                                              3u, 4u,  10u,   // f1
+                                              4u, 5u,  10u,   // f2
+                                              5u, 6u,  10u,   // f3
+                                              6u, 7u,  10u,   // f4
+                                              7u, 8u,  10u,   // f5
+                                              8u, 9u,  10u,   // f6
+                                              2u, 10u, 9u});  // f7
+  // NOLINTEND(*-magic-numbers)
+}
+
+TEST(HalfEdgeMeshTest, ContractEdgeBatchEqualsSequentialEdgeContraction) {
+  auto half_edge_mesh = CreateHalfEdgeMesh();
+  const auto& vertices = half_edge_mesh.vertices();
 
-  const auto id = static_cast<std::uint32_t>(half_edge_mesh.vertices().size());
-  const auto position = (v0->position() + v1->position()) / 2.0f;
-  const gfx::Vertex v_new{id, position};
+  const std::vector edges{FindEdge(half_edge_mesh, 0, 1)};
+  const std::vector positions{(vertices[0].position() + vertices[1].position()) / 2.0f};
+  const auto v_first = half_edge_mesh.Contract(edges, positions);
 
-  half_edge_mesh.Contract(*edge01, std::make_shared<gfx::Vertex>(v_new));
+  EXPECT_EQ(10, v_first);
+  EXPECT_EQ(positions.front(), vertices[v_first].position());
+  EXPECT_FALSE(vertices.contains(0));
+  EXPECT_FALSE(vertices.contains(1));
 
   EXPECT_EQ(9, half_edge_mesh.vertices().size());
   EXPECT_EQ(32, half_edge_mesh.edges().size());
@@ -147,24 +182,18 @@ TEST(HalfEdgeMeshTest, ContractEdgeAttachesIndicentEdgesToNewVertex) {
 
 #ifndef NDEBUG
 
-TEST(HalfEdgeMeshTest, ContractHalfEdgeWithExistingMeshVertexCausesProgramExit) {
+TEST(HalfEdgeMeshTest, ContractDeletedHalfEdgeCausesProgramExit) {
   auto half_edge_mesh = CreateHalfEdgeMesh();
-  const auto& v0 = half_edge_mesh.vertices().at(0);
-  const auto& v1 = half_edge_mesh.vertices().at(1);
-  const auto& edge01 = half_edge_mesh.edges().at(hash_value(*v0, *v1));
-  EXPECT_DEATH(half_edge_mesh.Contract(*edge01, v0), "");  // NOLINT(whitespace/newline)
+  const auto edge01 = FindEdge(half_edge_mesh, 0, 1);
+  static constexpr glm::vec3 kPosition{1.5f, 0.0f, 0.0f};
+  half_edge_mesh.Contract(edge01, kPosition);
+  EXPECT_DEATH(half_edge_mesh.Contract(edge01, kPosition), "");  // NOLINT(whitespace/newline)
 }
 
 TEST(HalfEdgeMeshTest, ContractNonexistentHalfEdgeCausesProgramExit) {
   auto half_edge_mesh = CreateHalfEdgeMesh();
-  const auto next_vertex_id = static_cast<int>(half_edge_mesh.vertices().size());
-  const auto v_invalid0 = std::make_shared<gfx::Vertex>(next_vertex_id, glm::vec3{0.0f});
-  const auto v_invalid1 = std::make_shared<gfx::Vertex>(next_vertex_id + 1, glm::vec3{0.0f});
-  const auto v_new = std::make_shared<gfx::Vertex>(42, glm::vec3{0.0f});
-  const auto edge_invalid01 = std::make_shared<gfx::HalfEdge>(v_invalid1);
-  const auto edge_invalid10 = std::make_shared<gfx::HalfEdge>(v_invalid0);
-  edge_invalid01->set_flip(edge_invalid10);
-  EXPECT_DEATH(half_edge_mesh.Contract(*edge_invalid01, v_new), "");  // NOLINT(whitespace/newline)
+  const auto edge_invalid = half_edge_mesh.edges().slot_count();
+  EXPECT_DEATH(half_edge_mesh.Contract(edge_invalid, glm::vec3{0.0f}), "");  // NOLINT(whitespace/newline)
 }
 
 #endif
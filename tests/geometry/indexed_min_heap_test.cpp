@@ -0,0 +1,108 @@
+#include "geometry/indexed_min_heap.h"
+
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace {
+
+std::vector<std::uint32_t> PopAll(gfx::IndexedMinHeap& heap) {
+  std::vector<std::uint32_t> keys;
+  while (!heap.empty()) keys.push_back(heap.Pop());
+  return keys;
+}
+
+TEST(IndexedMinHeapTest, PopReturnsKeysInOrderOfIncreasingPriority) {
+  gfx::IndexedMinHeap heap{5};
+  // NOLINTBEGIN(*-magic-numbers)
+  heap.Push(0, 3.0f);
+  heap.Push(1, 1.0f);
+  heap.Push(2, 4.0f);
+  heap.Push(3, 0.5f);
+  heap.Push(4, 2.0f);
+  // NOLINTEND(*-magic-numbers)
+  EXPECT_EQ(5, heap.size());
+  EXPECT_EQ(PopAll(heap), (std::vector{3u, 1u, 4u, 0u, 2u}));
+}
+
+TEST(IndexedMinHeapTest, PushExistingKeyUpdatesItsPriority) {
+  gfx::IndexedMinHeap heap{3};
+  // NOLINTBEGIN(*-magic-numbers)
+  heap.Push(0, 1.0f);
+  heap.Push(1, 2.0f);
+  heap.Push(2, 3.0f);
+  heap.Push(2, 0.0f);
+  heap.Push(0, 4.0f);
+  // NOLINTEND(*-magic-numbers)
+  EXPECT_EQ(3, heap.size());
+  EXPECT_EQ(PopAll(heap), (std::vector{2u, 1u, 0u}));
+}
+
+TEST(IndexedMinHeapTest, EraseRemovesTheKeyFromTheHeap) {
+  gfx::IndexedMinHeap heap{4};
+  // NOLINTBEGIN(*-magic-numbers)
+  heap.Push(0, 1.0f);
+  heap.Push(1, 2.0f);
+  heap.Push(2, 3.0f);
+  heap.Push(3, 4.0f);
+  // NOLINTEND(*-magic-numbers)
+  heap.Erase(0);
+  heap.Erase(2);
+  EXPECT_FALSE(heap.contains(0));
+  EXPECT_FALSE(heap.contains(2));
+  EXPECT_EQ(PopAll(heap), (std::vector{1u, 3u}));
+}
+
+TEST(IndexedMinHeapTest, HeapifyInsertsKeysInOrderOfIncreasingPriority) {
+  gfx::IndexedMinHeap heap{6};
+  // NOLINTNEXTLINE(*-magic-numbers)
+  heap.Heapify(std::vector<std::pair<std::uint32_t, float>>{{0, 3.0f}, {2, 1.0f}, {3, 4.0f}, {4, 0.5f}, {5, 2.0f}});
+  EXPECT_EQ(5, heap.size());
+  EXPECT_FALSE(heap.contains(1));
+  EXPECT_EQ(PopAll(heap), (std::vector{4u, 2u, 5u, 0u, 3u}));
+}
+
+TEST(IndexedMinHeapTest, PushAfterHeapifyUpdatesKeyPriorities) {
+  gfx::IndexedMinHeap heap{4};
+  // NOLINTBEGIN(*-magic-numbers)
+  heap.Heapify(std::vector<std::pair<std::uint32_t, float>>{{0, 1.0f}, {1, 2.0f}, {2, 3.0f}});
+  heap.Push(2, 0.0f);
+  heap.Push(3, 1.5f);
+  // NOLINTEND(*-magic-numbers)
+  EXPECT_EQ(PopAll(heap), (std::vector{2u, 0u, 3u, 1u}));
+}
+
+TEST(IndexedMinHeapTest, TopPriorityReturnsTheMinimumPriority) {
+  gfx::IndexedMinHeap heap{3};
+  // NOLINTBEGIN(*-magic-numbers)
+  heap.Push(0, 2.0f);
+  heap.Push(1, 0.5f);
+  heap.Push(2, 1.0f);
+  EXPECT_EQ(heap.top_priority(), 0.5f);
+  heap.Pop();
+  EXPECT_EQ(heap.top_priority(), 1.0f);
+  // NOLINTEND(*-magic-numbers)
+}
+
+#ifndef NDEBUG
+
+TEST(IndexedMinHeapTest, HeapifyDuplicateKeysCausesProgramExit) {
+  gfx::IndexedMinHeap heap{1};
+  const std::vector<std::pair<std::uint32_t, float>> entries{{0, 1.0f}, {0, 2.0f}};
+  EXPECT_DEATH(heap.Heapify(entries), "");  // NOLINT(whitespace/newline)
+}
+
+TEST(IndexedMinHeapTest, EraseMissingKeyCausesProgramExit) {
+  gfx::IndexedMinHeap heap{1};
+  EXPECT_DEATH(heap.Erase(0), "");  // NOLINT(whitespace/newline)
+}
+
+TEST(IndexedMinHeapTest, GetTopOfEmptyHeapCausesProgramExit) {
+  const gfx::IndexedMinHeap heap{1};
+  EXPECT_DEATH({ std::ignore = heap.top(); }, "");  // NOLINT(whitespace/newline)
+}
+
+#endif
+
+}  // namespace
@@ -0,0 +1,62 @@
+#include "geometry/lod_chain.h"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <span>
+
+#include <gtest/gtest.h>
+
+#include "graphics/mesh.h"
+#include "tests/device.h"
+#include "tests/geometry/sphere.h"
+
+namespace {
+
+TEST(LodChainTest, CreateLodChainEmitsALevelOfDetailForEachTargetFaceCount) {
+  const auto sphere = gfx::test::CreateSphereMesh(4);
+  static constexpr std::array kTargets{gfx::mesh::LodTarget{.face_count = 1024},
+                                       gfx::mesh::LodTarget{.face_count = 256},
+                                       gfx::mesh::LodTarget{.face_count = 64}};
+  const auto lod_chain = gfx::mesh::CreateLodChain(gfx::test::Device::Get(), sphere, kTargets);
+  const auto& indices = lod_chain.mesh.indices();
+
+  // every level of detail references the vertices of the original mesh
+  EXPECT_EQ(lod_chain.mesh.vertices().size(), sphere.vertices().size());
+  EXPECT_TRUE(std::ranges::all_of(indices, [&](const auto index) { return index < sphere.vertices().size(); }));
+
+  ASSERT_EQ(lod_chain.lods.size(), kTargets.size() + 1);
+  EXPECT_EQ(lod_chain.lods[0].first_index, 0);
+  EXPECT_EQ(lod_chain.lods[0].index_count, sphere.indices().size());
+  EXPECT_EQ(lod_chain.lods[0].max_error, 0.0f);
+  EXPECT_TRUE(std::ranges::equal(std::span{indices}.first(sphere.indices().size()), sphere.indices()));
+
+  for (std::size_t i = 0; i < kTargets.size(); ++i) {
+    const auto& previous_lod = lod_chain.lods[i];
+    const auto& lod = lod_chain.lods[i + 1];
+    EXPECT_EQ(lod.first_index, previous_lod.first_index + previous_lod.index_count);
+    EXPECT_LE(lod.index_count, 3 * kTargets[i].face_count);
+    EXPECT_GE(lod.index_count + 6, 3 * kTargets[i].face_count);
+    EXPECT_GE(lod.max_error, previous_lod.max_error);
+  }
+  EXPECT_EQ(lod_chain.lods.back().first_index + lod_chain.lods.back().index_count, indices.size());
+}
+
+TEST(LodChainTest, CreateLodChainStopsAtTheTargetError) {
+  const auto sphere = gfx::test::CreateSphereMesh(4);
+  static constexpr std::array kFaceCountTargets{gfx::mesh::LodTarget{.face_count = 256}};
+  const auto face_count_lod = gfx::mesh::CreateLodChain(gfx::test::Device::Get(), sphere, kFaceCountTargets).lods[1];
+
+  // edge contraction continues past the face count target until the next edge contraction exceeds the target error
+  const std::array error_targets{gfx::mesh::LodTarget{.max_error = face_count_lod.max_error}};
+  const auto lod_chain = gfx::mesh::CreateLodChain(gfx::test::Device::Get(), sphere, error_targets);
+
+  ASSERT_EQ(lod_chain.lods.size(), 2);
+  const auto& lod = lod_chain.lods[1];
+  EXPECT_GT(lod.max_error, 0.0f);
+  EXPECT_LE(lod.max_error, face_count_lod.max_error);
+  EXPECT_LE(lod.index_count, face_count_lod.index_count);
+  EXPECT_GT(lod.index_count, 0);
+}
+
+}  // namespace
@@ -0,0 +1,140 @@
+#include "geometry/mesh_optimizer.h"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <span>
+#include <vector>
+
+#include <glm/glm.hpp>
+#include <gtest/gtest.h>
+
+#include "graphics/mesh.h"
+#include "tests/device.h"
+
+namespace {
+
+constexpr std::uint32_t kGridSize = 64;
+
+/** \brief Creates a square grid of triangles in the xy-plane whose triangles are in random order. */
+std::vector<std::uint32_t> CreateShuffledGridIndices() {
+  std::vector<std::array<std::uint32_t, 3>> triangles;
+  for (std::uint32_t y = 0; y < kGridSize - 1; ++y) {
+    for (std::uint32_t x = 0; x < kGridSize - 1; ++x) {
+      const auto v00 = y * kGridSize + x;
+      const auto v10 = v00 + 1;
+      const auto v01 = v00 + kGridSize;
+      const auto v11 = v01 + 1;
+      triangles.push_back({v00, v10, v11});
+      triangles.push_back({v00, v11, v01});
+    }
+  }
+
+  std::mt19937 random_engine{1};  // NOLINT(cert-msc32-c, cert-msc51-cpp): deterministic test input
+  std::ranges::shuffle(triangles, random_engine);
+
+  std::vector<std::uint32_t> indices;
+  for (const auto& triangle : triangles) indices.insert(indices.end(), triangle.begin(), triangle.end());
+  return indices;
+}
+
+std::vector<glm::vec3> CreateGridPositions() {
+  std::vector<glm::vec3> positions;
+  for (std::uint32_t y = 0; y < kGridSize; ++y) {
+    for (std::uint32_t x = 0; x < kGridSize; ++x) {
+      positions.emplace_back(static_cast<float>(x), static_cast<float>(y), 0.0f);
+    }
+  }
+  return positions;
+}
+
+/** \brief Gets the triangles of an index buffer in sorted order to compare triangle sets independent of order. */
+std::vector<std::array<std::uint32_t, 3>> GetSortedTriangles(const std::span<const std::uint32_t> indices) {
+  std::vector<std::array<std::uint32_t, 3>> triangles;
+  for (std::size_t i = 0; i < indices.size(); i += 3) triangles.push_back({indices[i], indices[i + 1], indices[i + 2]});
+  std::ranges::sort(triangles);
+  return triangles;
+}
+
+TEST(MeshOptimizerTest, AnalyzeVertexCacheOfASingleTriangleTransformsEachVertexOnce) {
+  const std::vector<std::uint32_t> indices{0, 1, 2};
+  const auto statistics = gfx::AnalyzeVertexCache(indices, 3);
+  EXPECT_EQ(statistics.acmr, 3.0f);
+  EXPECT_EQ(statistics.atvr, 1.0f);
+}
+
+TEST(MeshOptimizerTest, AnalyzeVertexCacheCountsVerticesEvictedFromTheCache) {
+  // with a cache of three vertices, the second triangle evicts vertex 0 before the third triangle references it
+  const std::vector<std::uint32_t> indices{0, 1, 2, 3, 4, 5, 0, 1, 2};
+  const auto statistics = gfx::AnalyzeVertexCache(indices, 6, 3);
+  EXPECT_EQ(statistics.acmr, 3.0f);
+  EXPECT_EQ(statistics.atvr, 1.5f);
+}
+
+TEST(MeshOptimizerTest, OptimizeVertexCacheReducesTheCacheMissRatioAndPreservesTriangles) {
+  const auto indices = CreateShuffledGridIndices();
+  const auto vertex_count = static_cast<std::size_t>(kGridSize) * kGridSize;
+  const auto optimized_indices = gfx::OptimizeVertexCache(indices, vertex_count);
+
+  const auto statistics = gfx::AnalyzeVertexCache(indices, vertex_count);
+  const auto optimized_statistics = gfx::AnalyzeVertexCache(optimized_indices, vertex_count);
+  EXPECT_GT(statistics.acmr, 2.0f);
+  EXPECT_LT(optimized_statistics.acmr, 0.8f);
+  EXPECT_LT(optimized_statistics.atvr, 1.6f);
+  EXPECT_EQ(GetSortedTriangles(indices), GetSortedTriangles(optimized_indices));
+}
+
+TEST(MeshOptimizerTest, OptimizeOverdrawPreservesTrianglesAndMostVertexCacheReuse) {
+  const auto positions = CreateGridPositions();
+  const auto cache_optimized_indices = gfx::OptimizeVertexCache(CreateShuffledGridIndices(), positions.size());
+  const auto optimized_indices = gfx::OptimizeOverdraw(cache_optimized_indices, positions);
+
+  const auto statistics = gfx::AnalyzeVertexCache(cache_optimized_indices, positions.size());
+  const auto optimized_statistics = gfx::AnalyzeVertexCache(optimized_indices, positions.size());
+  EXPECT_LT(optimized_statistics.acmr, 1.2f * statistics.acmr);
+  EXPECT_EQ(GetSortedTriangles(cache_optimized_indices), GetSortedTriangles(optimized_indices));
+}
+
+TEST(MeshOptimizerTest, OptimizeVertexFetchOrdersVerticesByFirstUseAndRemovesUnusedVertices) {
+  std::vector<gfx::Mesh::Vertex> vertices;
+  for (auto i = 0; i < 5; ++i) vertices.push_back(gfx::Mesh::Vertex{.position = glm::vec3{static_cast<float>(i)}});
+  std::vector<std::uint32_t> indices{4, 2, 0, 0, 2, 3};
+
+  gfx::OptimizeVertexFetch(vertices, indices);
+
+  ASSERT_EQ(vertices.size(), 4);
+  EXPECT_EQ(indices, (std::vector<std::uint32_t>{0, 1, 2, 2, 1, 3}));
+  EXPECT_EQ(vertices[0].position, glm::vec3{4.0f});
+  EXPECT_EQ(vertices[1].position, glm::vec3{2.0f});
+  EXPECT_EQ(vertices[2].position, glm::vec3{0.0f});
+  EXPECT_EQ(vertices[3].position, glm::vec3{3.0f});
+}
+
+TEST(MeshOptimizerTest, OptimizeMeshPreservesTrianglePositions) {
+  const auto positions = CreateGridPositions();
+  std::vector<gfx::Mesh::Vertex> vertices;
+  for (const auto& position : positions) vertices.push_back(gfx::Mesh::Vertex{.position = position});
+  const gfx::Mesh mesh{gfx::test::Device::Get(), std::move(vertices), CreateShuffledGridIndices()};
+
+  const auto optimized_mesh = gfx::mesh::Optimize(gfx::test::Device::Get(), mesh);
+
+  const auto get_triangle_positions = [](const gfx::Mesh& triangle_mesh) {
+    std::vector<std::array<float, 9>> triangles;
+    const auto& indices = triangle_mesh.indices();
+    for (std::size_t i = 0; i < indices.size(); i += 3) {
+      std::array<float, 9> triangle{};
+      for (std::size_t j = 0; j < 3; ++j) {
+        const auto& position = triangle_mesh.vertices()[indices[i + j]].position;
+        std::ranges::copy(std::array{position.x, position.y, position.z}, triangle.begin() + 3 * j);
+      }
+      triangles.push_back(triangle);
+    }
+    std::ranges::sort(triangles);
+    return triangles;
+  };
+  EXPECT_EQ(get_triangle_positions(mesh), get_triangle_positions(optimized_mesh));
+}
+
+}  // namespace
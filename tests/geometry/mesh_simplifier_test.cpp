@@ -0,0 +1,113 @@
+#include "geometry/mesh_simplifier.h"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <ranges>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include <glm/glm.hpp>
+#include <gtest/gtest.h>
+
+#include "geometry/mesh_optimizer.h"
+#include "graphics/mesh.h"
+#include "tests/device.h"
+#include "tests/geometry/sphere.h"
+
+namespace {
+
+/** \brief Verifies a mesh is a closed manifold with the topology of a sphere and no duplicate vertices. */
+void VerifyClosedManifoldSphere(const gfx::Mesh& mesh) {
+  const auto positions =
+      mesh.vertices() | std::views::transform(&gfx::Mesh::Vertex::position) | std::ranges::to<std::vector>();
+  const auto face_count = static_cast<std::ptrdiff_t>(mesh.indices().size() / 3);
+
+  // each directed edge of a closed manifold mesh is used by exactly one face and its opposite edge by another face
+  std::map<std::pair<std::uint32_t, std::uint32_t>, int> directed_edges;
+  for (std::size_t i = 0; i < mesh.indices().size(); i += 3) {
+    for (std::size_t j = 0; j < 3; ++j) {
+      ++directed_edges[{mesh.indices()[i + j], mesh.indices()[i + (j + 1) % 3]}];
+    }
+  }
+  for (const auto& [edge, count] : directed_edges) {
+    EXPECT_EQ(count, 1);
+    EXPECT_TRUE(directed_edges.contains({edge.second, edge.first}));
+  }
+
+  // the Euler characteristic of a sphere is two which would not hold if seams were duplicated or left open
+  const auto vertex_count = static_cast<std::ptrdiff_t>(positions.size());
+  const auto edge_count = static_cast<std::ptrdiff_t>(directed_edges.size() / 2);
+  EXPECT_EQ(vertex_count - edge_count + face_count, 2);
+
+  // vertices shared by adjacent regions are merged into a single vertex when regions are stitched together
+  auto sorted_positions = positions | std::views::transform([](const auto& position) {
+                            return std::array{position.x, position.y, position.z};
+                          })
+                          | std::ranges::to<std::vector>();
+  std::ranges::sort(sorted_positions);
+  EXPECT_EQ(std::ranges::adjacent_find(sorted_positions), sorted_positions.end());
+}
+
+TEST(MeshSimplifierTest, SimplifyWithInvalidRateThrowsAnException) {
+  const auto sphere = gfx::test::CreateSphereMesh(1);
+  EXPECT_THROW((void)gfx::mesh::Simplify(gfx::test::Device::Get(), sphere, -0.1f), std::invalid_argument);
+  EXPECT_THROW((void)gfx::mesh::Simplify(gfx::test::Device::Get(), sphere, 1.1f), std::invalid_argument);
+}
+
+TEST(MeshSimplifierTest, SimplifyWithPartitionsProducesAClosedManifoldMeshWithTheTargetFaceCount) {
+  static constexpr auto kInitialFaceCount = 32 * 1024;  // the face count of an octahedron subdivided six times
+  static constexpr auto kRate = 0.9f;
+  static constexpr auto kTargetFaceCount = static_cast<std::size_t>((1.0f - kRate) * kInitialFaceCount);
+  const auto sphere = gfx::test::CreateSphereMesh(6);
+
+  for (const auto partition_count : {2u, 4u, 0u}) {
+    const auto simplified_mesh =
+        gfx::mesh::Simplify(gfx::test::Device::Get(), sphere, kRate, {.partition_count = partition_count});
+
+    const auto face_count = simplified_mesh.indices().size() / 3;
+    EXPECT_LE(face_count, kTargetFaceCount);
+    EXPECT_GE(face_count + 2, kTargetFaceCount);  // each edge contraction removes two faces
+    VerifyClosedManifoldSphere(simplified_mesh);
+  }
+}
+
+TEST(MeshSimplifierTest, SimplifyWithPartitionsKeepsVerticesNearTheSurface) {
+  const auto sphere = gfx::test::CreateSphereMesh(6);
+  const auto partitioned_mesh = gfx::mesh::Simplify(gfx::test::Device::Get(), sphere, 0.9f, {.partition_count = 4});
+
+  // locked seam vertices only constrain the order of edge contractions so the result remains close to the surface
+  for (const auto& vertex : partitioned_mesh.vertices()) {
+    EXPECT_NEAR(glm::length(vertex.position), 1.0f, 0.01f);  // NOLINT(*-magic-numbers)
+  }
+}
+
+TEST(MeshSimplifierTest, SimplifyWithEachOptionProducesAClosedManifoldMesh) {
+  const auto sphere = gfx::test::CreateSphereMesh(4);
+
+  for (const auto& options : {gfx::mesh::SimplifyOptions{.contract_independent_edges = true},
+                              gfx::mesh::SimplifyOptions{.cluster_vertices = true},
+                              gfx::mesh::SimplifyOptions{.placement = gfx::VertexPlacement::kMidpoint},
+                              gfx::mesh::SimplifyOptions{.optimize = true}}) {
+    const auto simplified_mesh = gfx::mesh::Simplify(gfx::test::Device::Get(), sphere, 0.9f, options);
+    EXPECT_LE(simplified_mesh.indices().size() / 3, 205);
+    VerifyClosedManifoldSphere(simplified_mesh);
+  }
+}
+
+TEST(MeshSimplifierTest, SimplifyWithOptimizationReordersTheSimplifiedMeshForTheVertexCache) {
+  const auto sphere = gfx::test::CreateSphereMesh(5);
+  const auto simplified_mesh = gfx::mesh::Simplify(gfx::test::Device::Get(), sphere, 0.9f);
+  const auto optimized_mesh = gfx::mesh::Simplify(gfx::test::Device::Get(), sphere, 0.9f, {.optimize = true});
+
+  EXPECT_EQ(optimized_mesh.indices().size(), simplified_mesh.indices().size());
+  EXPECT_EQ(optimized_mesh.vertices().size(), simplified_mesh.vertices().size());
+  EXPECT_LT(gfx::AnalyzeVertexCache(optimized_mesh.indices(), optimized_mesh.vertices().size()).acmr,
+            gfx::AnalyzeVertexCache(simplified_mesh.indices(), simplified_mesh.vertices().size()).acmr);
+  VerifyClosedManifoldSphere(optimized_mesh);
+}
+
+}  // namespace
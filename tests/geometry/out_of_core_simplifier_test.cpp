@@ -0,0 +1,105 @@
+#include "geometry/out_of_core_simplifier.h"
+
+#include <array>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <glm/glm.hpp>
+#include <gtest/gtest.h>
+
+#include "geometry/half_edge_mesh.h"
+#include "tests/geometry/sphere.h"
+
+namespace {
+
+struct ObjMesh {
+  std::vector<glm::vec3> positions;
+  std::vector<std::uint32_t> indices;
+};
+
+void WriteObj(const std::filesystem::path& filepath, const ObjMesh& mesh) {
+  std::ofstream file{filepath};
+  for (const auto& position : mesh.positions) {
+    file << "v " << position.x << ' ' << position.y << ' ' << position.z << '\n';
+  }
+  for (std::size_t i = 0; i < mesh.indices.size(); i += 3) {
+    file << "f " << mesh.indices[i] + 1 << ' ' << mesh.indices[i + 1] + 1 << ' ' << mesh.indices[i + 2] + 1 << '\n';
+  }
+}
+
+ObjMesh ReadObj(const std::filesystem::path& filepath) {
+  ObjMesh mesh;
+  std::ifstream file{filepath};
+  for (std::string line; std::getline(file, line);) {
+    std::istringstream line_stream{line};
+    std::string prefix;
+    line_stream >> prefix;
+    if (prefix == "v") {
+      auto& position = mesh.positions.emplace_back();
+      line_stream >> position.x >> position.y >> position.z;
+    } else if (prefix == "f") {
+      std::array<std::uint32_t, 3> face{};
+      line_stream >> face[0] >> face[1] >> face[2];
+      for (const auto index : face) mesh.indices.push_back(index - 1);
+    }
+  }
+  return mesh;
+}
+
+class OutOfCoreSimplifierTest : public testing::Test {
+protected:
+  void SetUp() override {
+    directory_ = std::filesystem::temp_directory_path() / "out_of_core_simplifier_test";
+    std::filesystem::create_directories(directory_);
+    input_filepath_ = directory_ / "input.obj";
+    output_filepath_ = directory_ / "output.obj";
+    auto sphere = gfx::test::CreateSphere(5);
+    WriteObj(input_filepath_, {.positions = std::move(sphere.positions), .indices = std::move(sphere.indices)});
+  }
+
+  void TearDown() override { std::filesystem::remove_all(directory_); }
+
+  std::filesystem::path directory_;
+  std::filesystem::path input_filepath_;
+  std::filesystem::path output_filepath_;
+};
+
+TEST_F(OutOfCoreSimplifierTest, SimplifyWithInvalidRateThrowsAnException) {
+  EXPECT_THROW(gfx::mesh::SimplifyOutOfCore(input_filepath_, output_filepath_, -0.1f), std::invalid_argument);
+  EXPECT_THROW(gfx::mesh::SimplifyOutOfCore(input_filepath_, output_filepath_, 1.1f), std::invalid_argument);
+}
+
+TEST_F(OutOfCoreSimplifierTest, SimplifyMeshLargerThanTheMemoryBudgetReturnsAClosedManifoldMesh) {
+  static constexpr auto kInitialFaceCount = 8 * 1024;  // the face count of an octahedron subdivided five times
+  static constexpr auto kRate = 0.75f;
+
+  // the memory budget is small enough that the mesh must be split into chunks but large enough for a final pass
+  gfx::mesh::SimplifyOutOfCore(input_filepath_,
+                               output_filepath_,
+                               kRate,
+                               {.memory_budget = std::size_t{1} << 20u, .temporary_directory = directory_});
+
+  const auto simplified_mesh = ReadObj(output_filepath_);
+  const auto face_count = simplified_mesh.indices.size() / 3;
+  static constexpr auto kTargetFaceCount = static_cast<std::size_t>((1.0f - kRate) * kInitialFaceCount);
+  EXPECT_LE(face_count, kTargetFaceCount);
+  EXPECT_GE(face_count + 2, kTargetFaceCount);  // each edge contraction removes two faces
+
+  // each edge of a closed manifold mesh is shared by two faces and the Euler characteristic of a sphere is two
+  const gfx::HalfEdgeMesh half_edge_mesh{simplified_mesh.positions, simplified_mesh.indices};
+  const auto vertex_count = static_cast<std::ptrdiff_t>(simplified_mesh.positions.size());
+  const auto edge_count = static_cast<std::ptrdiff_t>(half_edge_mesh.edges().size() / 2);
+  EXPECT_EQ(half_edge_mesh.edges().size(), 3 * face_count);
+  EXPECT_EQ(vertex_count - edge_count + static_cast<std::ptrdiff_t>(face_count), 2);
+
+  // intermediate files are removed from the temporary directory
+  EXPECT_EQ(std::distance(std::filesystem::directory_iterator{directory_}, std::filesystem::directory_iterator{}), 2);
+}
+
+}  // namespace
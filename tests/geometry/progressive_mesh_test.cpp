@@ -0,0 +1,113 @@
+#include "geometry/progressive_mesh.h"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include <glm/glm.hpp>
+#include <gtest/gtest.h>
+
+#include "geometry/simplification_session.h"
+#include "graphics/mesh.h"
+#include "tests/device.h"
+#include "tests/geometry/sphere.h"
+
+namespace {
+
+using Triangle = std::array<float, 9>;
+
+/** \brief Creates a unit sphere whose vertex normals are equal to their positions. */
+gfx::Mesh CreateSphere(const int subdivision_count) {
+  return gfx::test::CreateSphereMesh(subdivision_count, [](const glm::vec3& position) {
+    return gfx::Mesh::Vertex{.position = position, .normal = position};
+  });
+}
+
+/** \brief Gets the non-degenerate triangles of a mesh by vertex position in a canonical order. */
+std::vector<Triangle> GetTriangles(const std::span<const gfx::Mesh::Vertex> vertices,
+                                   const std::span<const std::uint32_t> indices) {
+  std::vector<Triangle> triangles;
+  for (std::size_t i = 0; i < indices.size(); i += 3) {
+    std::array positions{vertices[indices[i]].position,
+                         vertices[indices[i + 1]].position,
+                         vertices[indices[i + 2]].position};
+    if (positions[0] == positions[1] || positions[1] == positions[2] || positions[2] == positions[0]) continue;
+
+    // rotate the triangle to start at its minimum position without changing its winding order
+    const auto less = [](const glm::vec3& lhs, const glm::vec3& rhs) {
+      return std::array{lhs.x, lhs.y, lhs.z} < std::array{rhs.x, rhs.y, rhs.z};
+    };
+    std::ranges::rotate(positions, std::ranges::min_element(positions, less));
+
+    auto& triangle = triangles.emplace_back();
+    for (std::size_t j = 0; j < 3; ++j) {
+      for (glm::length_t k = 0; k < 3; ++k) triangle[3 * j + k] = positions[j][k];
+    }
+  }
+  std::ranges::sort(triangles);
+  return triangles;
+}
+
+std::vector<Triangle> GetTriangles(const gfx::Mesh& mesh) { return GetTriangles(mesh.vertices(), mesh.indices()); }
+
+std::vector<Triangle> GetTriangles(const gfx::ProgressiveMesh& progressive_mesh) {
+  return GetTriangles(progressive_mesh.vertices(), progressive_mesh.indices());
+}
+
+TEST(ProgressiveMeshTest, CreateProgressiveMeshStartsAtTheFinestLevelOfDetail) {
+  const auto sphere = CreateSphere(3);
+  const gfx::ProgressiveMesh progressive_mesh{sphere, 64};
+
+  EXPECT_EQ(progressive_mesh.face_count(), 512);
+  EXPECT_EQ(progressive_mesh.max_face_count(), 512);
+  EXPECT_LE(progressive_mesh.min_face_count(), 64);
+  EXPECT_EQ(GetTriangles(progressive_mesh), GetTriangles(sphere));
+}
+
+TEST(ProgressiveMeshTest, SetFaceCountMatchesSimplifyingToTheSameFaceCount) {
+  const auto sphere = CreateSphere(4);
+  gfx::ProgressiveMesh progressive_mesh{sphere, 100};
+  gfx::mesh::SimplificationSession simplification_session{sphere};
+
+  for (const std::size_t face_count : {1500, 700, 100}) {
+    progressive_mesh.SetFaceCount(face_count);
+    simplification_session.SimplifyTo(face_count);
+    EXPECT_EQ(progressive_mesh.face_count(), simplification_session.face_count());
+    EXPECT_EQ(GetTriangles(progressive_mesh), GetTriangles(simplification_session.ToMesh(gfx::test::Device::Get())));
+  }
+}
+
+TEST(ProgressiveMeshTest, RefineCoarsenedMeshRestoresTheOriginalMesh) {
+  const auto sphere = CreateSphere(4);
+  gfx::ProgressiveMesh progressive_mesh{sphere, 32};
+  const auto indices = std::vector(progressive_mesh.indices().begin(), progressive_mesh.indices().end());
+
+  progressive_mesh.SetFaceCount(1000);
+  const auto coarse_indices = std::vector(progressive_mesh.indices().begin(), progressive_mesh.indices().end());
+  progressive_mesh.SetFaceCount(0);
+  EXPECT_EQ(progressive_mesh.face_count(), progressive_mesh.min_face_count());
+  progressive_mesh.SetFaceCount(1000);
+  EXPECT_EQ(std::vector(progressive_mesh.indices().begin(), progressive_mesh.indices().end()), coarse_indices);
+  progressive_mesh.SetFaceCount(progressive_mesh.max_face_count());
+  EXPECT_EQ(std::vector(progressive_mesh.indices().begin(), progressive_mesh.indices().end()), indices);
+}
+
+TEST(ProgressiveMeshTest, GeomorphInterpolatesBetweenLevelsOfDetail) {
+  gfx::ProgressiveMesh progressive_mesh{CreateSphere(3), 64};
+  progressive_mesh.SetFaceCount(100);
+  const auto coarse_triangles = GetTriangles(progressive_mesh);
+  progressive_mesh.SetFaceCount(300);
+  const auto triangles = GetTriangles(progressive_mesh);
+
+  auto vertices = progressive_mesh.vertices();
+  progressive_mesh.Geomorph(100, 0.0f, vertices);
+  EXPECT_EQ(GetTriangles(vertices, progressive_mesh.indices()), coarse_triangles);
+
+  progressive_mesh.Geomorph(100, 1.0f, vertices);
+  EXPECT_EQ(GetTriangles(vertices, progressive_mesh.indices()), triangles);
+}
+
+}  // namespace
@@ -0,0 +1,179 @@
+#include "geometry/quadric.h"
+
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace {
+
+constexpr auto kEpsilon = 1.0e-5f;
+
+TEST(QuadricTest, ErrorIsTheSquaredDistanceToTheTrianglePlane) {
+  const gfx::Quadric<3> quadric{{0.0f, 0.0f, 0.0f}, {1.0f, 0.0f, 0.0f}, {0.0f, 1.0f, 0.0f}};
+
+  // NOLINTBEGIN(*-magic-numbers)
+  EXPECT_NEAR(quadric.Error({0.0f, 0.0f, 0.0f}), 0.0f, kEpsilon);
+  EXPECT_NEAR(quadric.Error({5.0f, -3.0f, 0.0f}), 0.0f, kEpsilon);
+  EXPECT_NEAR(quadric.Error({0.25f, 0.25f, 2.0f}), 4.0f, kEpsilon);
+  EXPECT_NEAR(quadric.Error({1.0f, 1.0f, -0.5f}), 0.25f, kEpsilon);
+  // NOLINTEND(*-magic-numbers)
+}
+
+TEST(QuadricTest, PositionQuadricStoresOnlyUniqueCoefficients) {
+  // the upper triangle of the symmetric 3x3 matrix, the linear term and the constant term
+  EXPECT_EQ(sizeof(gfx::Quadric<3>), 10 * sizeof(float));
+}
+
+TEST(QuadricTest, PlaneQuadricEqualsTheQuadricOfATriangleInThePlane) {
+  // NOLINTBEGIN(*-magic-numbers)
+  const gfx::Quadric<3> triangle_quadric{{0.0f, 0.0f, 2.0f}, {1.0f, 0.0f, 2.0f}, {0.0f, 1.0f, 2.0f}};
+  const auto plane_quadric = gfx::Quadric<3>::FromPlane({0.0f, 0.0f, 1.0f}, -2.0f);
+
+  for (const auto& point : {gfx::Quadric<3>::Vector{0.0f, 0.0f, 0.0f},
+                            gfx::Quadric<3>::Vector{1.0f, -2.0f, 2.0f},
+                            gfx::Quadric<3>::Vector{3.0f, 4.0f, 5.0f}}) {
+    EXPECT_NEAR(plane_quadric.Error(point), triangle_quadric.Error(point), kEpsilon);
+  }
+  // NOLINTEND(*-magic-numbers)
+}
+
+TEST(QuadricTest, DegenerateTriangleHasZeroError) {
+  const gfx::Quadric<3> quadric{{0.0f, 0.0f, 0.0f}, {1.0f, 1.0f, 1.0f}, {2.0f, 2.0f, 2.0f}};
+  EXPECT_EQ(quadric.Error({1.0f, 2.0f, 3.0f}), 0.0f);  // NOLINT(*-magic-numbers)
+}
+
+TEST(QuadricTest, MinimizeReturnsTheIntersectionOfThreePlanes) {
+  // NOLINTBEGIN(*-magic-numbers)
+  const gfx::Quadric<3> x_plane{{1.0f, 0.0f, 0.0f}, {1.0f, 1.0f, 0.0f}, {1.0f, 0.0f, 1.0f}};
+  const gfx::Quadric<3> y_plane{{0.0f, 2.0f, 0.0f}, {0.0f, 2.0f, 1.0f}, {1.0f, 2.0f, 0.0f}};
+  const gfx::Quadric<3> z_plane{{0.0f, 0.0f, 3.0f}, {1.0f, 0.0f, 3.0f}, {0.0f, 1.0f, 3.0f}};
+  const auto quadric = x_plane + y_plane + z_plane;
+
+  const auto point = quadric.Minimize();
+  ASSERT_TRUE(point.has_value());
+  EXPECT_NEAR((*point)[0], 1.0f, kEpsilon);
+  EXPECT_NEAR((*point)[1], 2.0f, kEpsilon);
+  EXPECT_NEAR((*point)[2], 3.0f, kEpsilon);
+  EXPECT_NEAR(quadric.Error(*point), 0.0f, kEpsilon);
+  // NOLINTEND(*-magic-numbers)
+}
+
+TEST(QuadricTest, MinimizeSingularQuadricReturnsNullopt) {
+  const gfx::Quadric<3> quadric{{0.0f, 0.0f, 0.0f}, {1.0f, 0.0f, 0.0f}, {0.0f, 1.0f, 0.0f}};
+  EXPECT_FALSE(quadric.Minimize().has_value());
+  EXPECT_FALSE(gfx::Quadric<3>{}.Minimize().has_value());
+}
+
+TEST(QuadricTest, MinimizeIsAccurateFarFromTheOrigin) {
+  // NOLINTBEGIN(*-magic-numbers)
+  const auto quadric = gfx::Quadric<3>::FromPlane({1.0f, 0.0f, 0.0f}, -1000.0f)
+                       + gfx::Quadric<3>::FromPlane({0.0f, 0.6f, 0.8f}, -2000.0f)
+                       + gfx::Quadric<3>::FromPlane({0.0f, 0.8f, -0.6f}, -500.0f);
+
+  const auto point = quadric.Minimize();
+  ASSERT_TRUE(point.has_value());
+  EXPECT_NEAR((*point)[0], 1000.0f, 1.0e-2f);
+  EXPECT_NEAR(0.6f * (*point)[1] + 0.8f * (*point)[2], 2000.0f, 1.0e-2f);
+  EXPECT_NEAR(0.8f * (*point)[1] - 0.6f * (*point)[2], 500.0f, 1.0e-2f);
+  // NOLINTEND(*-magic-numbers)
+}
+
+TEST(QuadricTest, MinimizeNearlyCoplanarQuadricReturnsNullopt) {
+  // planes whose normals differ by less than the precision of the quadric coefficients do not determine a point
+  // NOLINTBEGIN(*-magic-numbers)
+  const auto quadric = gfx::Quadric<3>::FromPlane({0.0f, 0.0f, 1.0f}, -1.0f)
+                       + gfx::Quadric<3>::FromPlane({1.0e-5f, 0.0f, 1.0f}, -1.0f)
+                       + gfx::Quadric<3>::FromPlane({0.0f, 1.0e-5f, 1.0f}, -1.0f);
+  // NOLINTEND(*-magic-numbers)
+  EXPECT_FALSE(quadric.Minimize().has_value());
+}
+
+TEST(QuadricTest, MinimizeErrorsReturnsTheErrorAtTheMinimizerOfEachQuadric) {
+  // NOLINTBEGIN(*-magic-numbers)
+  const auto x_plane = gfx::Quadric<3>::FromPlane({1.0f, 0.0f, 0.0f}, -1.0f);
+  const auto y_plane = gfx::Quadric<3>::FromPlane({0.0f, 1.0f, 0.0f}, -2.0f);
+  const auto z_plane = gfx::Quadric<3>::FromPlane({0.0f, 0.0f, 1.0f}, -3.0f);
+  const auto tilted_plane = gfx::Quadric<3>::FromPlane({0.0f, 0.6f, 0.8f}, 1.0f);
+
+  // the batch exceeds a vector register on every target and includes singular quadrics
+  std::vector<gfx::Quadric<3>> quadrics;
+  for (auto i = 0; i < 5; ++i) {
+    quadrics.push_back(x_plane + y_plane + z_plane + tilted_plane);
+    quadrics.push_back(x_plane + y_plane + z_plane);
+    quadrics.push_back(x_plane + y_plane);
+  }
+  std::vector<float> errors(quadrics.size());
+  gfx::Quadric<3>::MinimizeErrors(quadrics, errors);
+
+  for (std::size_t i = 0; i < quadrics.size(); ++i) {
+    if (const auto point = quadrics[i].Minimize()) {
+      EXPECT_EQ(errors[i], quadrics[i].Error(*point));
+    } else {
+      EXPECT_TRUE(std::isnan(errors[i]));
+    }
+  }
+  EXPECT_GT(errors[0], 0.0f);
+  EXPECT_NEAR(errors[1], 0.0f, kEpsilon);
+  // NOLINTEND(*-magic-numbers)
+}
+
+TEST(QuadricTest, QuadricAccumulatedInDoublePrecisionConvertsToSinglePrecision) {
+  // NOLINTBEGIN(*-magic-numbers)
+  gfx::Quadric<3, double> accumulated_quadric;
+  gfx::Quadric<3> quadric;
+  for (const auto distance : {-1.0f, -2.0f, -3.0f}) {
+    accumulated_quadric += gfx::Quadric<3, double>::FromPlane({0.0f, 0.6f, 0.8f}, distance);
+    quadric += gfx::Quadric<3>::FromPlane({0.0f, 0.6f, 0.8f}, distance);
+  }
+
+  const gfx::Quadric<3> converted_quadric{accumulated_quadric};
+  for (const auto& point : {gfx::Quadric<3>::Vector{0.0f, 0.0f, 0.0f}, gfx::Quadric<3>::Vector{1.0f, 2.0f, 3.0f}}) {
+    EXPECT_NEAR(converted_quadric.Error(point), accumulated_quadric.Error(point), kEpsilon);
+    EXPECT_NEAR(converted_quadric.Error(point), quadric.Error(point), kEpsilon);
+  }
+  // NOLINTEND(*-magic-numbers)
+}
+
+TEST(QuadricTest, MinimizeOnSegmentReturnsThePointOfMinimumErrorAlongTheSegment) {
+  // NOLINTBEGIN(*-magic-numbers)
+  const auto quadric = gfx::Quadric<3>::FromPlane({1.0f, 0.0f, 0.0f}, -0.25f);
+  EXPECT_NEAR(quadric.MinimizeOnSegment({0.0f, 0.0f, 0.0f}, {1.0f, 1.0f, 0.0f}), 0.25f, kEpsilon);
+  EXPECT_NEAR(quadric.MinimizeOnSegment({1.0f, 0.0f, 0.0f}, {2.0f, 0.0f, 0.0f}), 0.0f, kEpsilon);
+  EXPECT_NEAR(quadric.MinimizeOnSegment({-2.0f, 0.0f, 0.0f}, {-1.0f, 0.0f, 0.0f}), 1.0f, kEpsilon);
+  EXPECT_EQ(quadric.MinimizeOnSegment({0.0f, 0.0f, 0.0f}, {0.0f, 1.0f, 0.0f}), 0.0f);
+  // NOLINTEND(*-magic-numbers)
+}
+
+TEST(QuadricTest, AttributeErrorMeasuresTheDistanceToInterpolatedAttributes) {
+  // the texture coordinates of each vertex are appended to its position
+  // NOLINTBEGIN(*-magic-numbers)
+  const gfx::Quadric<5> quadric{{0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+                                {1.0f, 0.0f, 0.0f, 1.0f, 0.0f},
+                                {0.0f, 1.0f, 0.0f, 0.0f, 1.0f}};
+
+  EXPECT_NEAR(quadric.Error({0.5f, 0.25f, 0.0f, 0.5f, 0.25f}), 0.0f, kEpsilon);
+  EXPECT_NEAR(quadric.Error({0.5f, 0.25f, 0.0f, 0.5f, 0.75f}), 0.125f, kEpsilon);
+  EXPECT_NEAR(quadric.Error({0.5f, 0.25f, 1.0f, 0.5f, 0.25f}), 1.0f, kEpsilon);
+  // NOLINTEND(*-magic-numbers)
+}
+
+TEST(QuadricTest, MinimizeWithFixedPositionReturnsTheInterpolatedAttributes) {
+  // NOLINTBEGIN(*-magic-numbers)
+  const gfx::Quadric<5> quadric{{0.0f, 0.0f, 0.0f, 0.0f, 0.0f},
+                                {1.0f, 0.0f, 0.0f, 1.0f, 0.0f},
+                                {0.0f, 1.0f, 0.0f, 0.0f, 1.0f}};
+
+  // a position above the triangle keeps its height while the attributes are those of its projection onto the triangle
+  const auto point = quadric.Minimize<3>({0.5f, 0.25f, 1.0f, 0.0f, 0.0f});
+  ASSERT_TRUE(point.has_value());
+  EXPECT_EQ((*point)[0], 0.5f);
+  EXPECT_EQ((*point)[1], 0.25f);
+  EXPECT_EQ((*point)[2], 1.0f);
+  EXPECT_NEAR((*point)[3], 0.5f, kEpsilon);
+  EXPECT_NEAR((*point)[4], 0.25f, kEpsilon);
+  // NOLINTEND(*-magic-numbers)
+}
+
+}  // namespace
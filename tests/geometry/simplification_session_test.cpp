@@ -0,0 +1,56 @@
+#include "geometry/simplification_session.h"
+
+#include <cstddef>
+
+#include <gtest/gtest.h>
+
+#include "graphics/mesh.h"
+#include "tests/device.h"
+#include "tests/geometry/sphere.h"
+
+namespace {
+
+void ExpectEqual(const gfx::Mesh& actual_mesh, const gfx::Mesh& expected_mesh) {
+  ASSERT_EQ(actual_mesh.vertices().size(), expected_mesh.vertices().size());
+  for (std::size_t i = 0; i < expected_mesh.vertices().size(); ++i) {
+    EXPECT_EQ(actual_mesh.vertices()[i].position, expected_mesh.vertices()[i].position);
+  }
+  EXPECT_EQ(actual_mesh.indices(), expected_mesh.indices());
+}
+
+TEST(SimplificationSessionTest, SimplifyToReducesTheFaceCountToTheTarget) {
+  gfx::mesh::SimplificationSession simplification_session{gfx::test::CreateSphereMesh(4)};
+  EXPECT_EQ(simplification_session.face_count(), 2048);
+
+  for (const std::size_t face_count : {1024, 512, 100}) {
+    simplification_session.SimplifyTo(face_count);
+    // each edge contraction removes two faces
+    EXPECT_LE(simplification_session.face_count(), face_count);
+    EXPECT_GE(simplification_session.face_count() + 2, face_count);
+    EXPECT_EQ(simplification_session.ToMesh(gfx::test::Device::Get()).indices().size(),
+              3 * simplification_session.face_count());
+  }
+}
+
+TEST(SimplificationSessionTest, SimplifyToHigherFaceCountDoesNotModifyTheMesh) {
+  gfx::mesh::SimplificationSession simplification_session{gfx::test::CreateSphereMesh(3)};
+  simplification_session.SimplifyTo(256);
+  const auto mesh = simplification_session.ToMesh(gfx::test::Device::Get());
+
+  simplification_session.SimplifyTo(400);
+  ExpectEqual(simplification_session.ToMesh(gfx::test::Device::Get()), mesh);
+}
+
+TEST(SimplificationSessionTest, ResumedSimplificationMatchesSimplifyingInOnePass) {
+  const auto sphere = gfx::test::CreateSphereMesh(4);
+
+  gfx::mesh::SimplificationSession resumed_session{sphere};
+  for (const std::size_t face_count : {1500, 1000, 600, 300}) resumed_session.SimplifyTo(face_count);
+
+  gfx::mesh::SimplificationSession one_pass_session{sphere};
+  one_pass_session.SimplifyTo(300);
+
+  ExpectEqual(resumed_session.ToMesh(gfx::test::Device::Get()), one_pass_session.ToMesh(gfx::test::Device::Get()));
+}
+
+}  // namespace
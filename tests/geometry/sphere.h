@@ -0,0 +1,80 @@
+#ifndef TESTS_GEOMETRY_SPHERE_H_
+#define TESTS_GEOMETRY_SPHERE_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <utility>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include "graphics/mesh.h"
+#include "tests/device.h"
+
+namespace gfx::test {
+
+struct Sphere {
+  std::vector<glm::vec3> positions;
+  std::vector<std::uint32_t> indices;
+};
+
+/** \brief Creates a closed unit sphere by repeatedly subdividing the faces of an octahedron. */
+inline Sphere CreateSphere(const int subdivision_count) {
+  Sphere sphere{.positions = {{1.0f, 0.0f, 0.0f},
+                              {-1.0f, 0.0f, 0.0f},
+                              {0.0f, 1.0f, 0.0f},
+                              {0.0f, -1.0f, 0.0f},
+                              {0.0f, 0.0f, 1.0f},
+                              {0.0f, 0.0f, -1.0f}},
+                .indices = {0, 2, 4, 2, 1, 4, 1, 3, 4, 3, 0, 4, 2, 0, 5, 1, 2, 5, 3, 1, 5, 0, 3, 5}};
+
+  for (auto subdivision = 0; subdivision < subdivision_count; ++subdivision) {
+    std::map<std::pair<std::uint32_t, std::uint32_t>, std::uint32_t> midpoints;
+    const auto get_midpoint = [&](const std::uint32_t v0, const std::uint32_t v1) {
+      const auto [iterator, inserted] =
+          midpoints.try_emplace(std::minmax(v0, v1), static_cast<std::uint32_t>(sphere.positions.size()));
+      if (inserted) sphere.positions.push_back(glm::normalize(sphere.positions[v0] + sphere.positions[v1]));
+      return iterator->second;
+    };
+
+    std::vector<std::uint32_t> indices;
+    for (std::size_t i = 0; i < sphere.indices.size(); i += 3) {
+      const auto v0 = sphere.indices[i];
+      const auto v1 = sphere.indices[i + 1];
+      const auto v2 = sphere.indices[i + 2];
+      const auto v01 = get_midpoint(v0, v1);
+      const auto v12 = get_midpoint(v1, v2);
+      const auto v20 = get_midpoint(v2, v0);
+      indices.insert(indices.end(), {v0, v01, v20, v1, v12, v01, v2, v20, v12, v01, v12, v20});
+    }
+    sphere.indices = std::move(indices);
+  }
+
+  return sphere;
+}
+
+/**
+ * \brief Creates a mesh of a closed unit sphere.
+ * \param subdivision_count The number of times to subdivide the faces of the initial octahedron.
+ * \param create_vertex Creates the vertex at each position on the sphere.
+ */
+template <typename CreateVertex>
+gfx::Mesh CreateSphereMesh(const int subdivision_count, CreateVertex create_vertex) {
+  auto [positions, indices] = CreateSphere(subdivision_count);
+  std::vector<gfx::Mesh::Vertex> vertices;
+  vertices.reserve(positions.size());
+  for (const auto& position : positions) vertices.push_back(create_vertex(position));
+  return gfx::Mesh{Device::Get(), std::move(vertices), std::move(indices)};
+}
+
+/** \brief Creates a mesh of a closed unit sphere whose vertices only have a position. */
+inline gfx::Mesh CreateSphereMesh(const int subdivision_count) {
+  return CreateSphereMesh(subdivision_count,
+                          [](const glm::vec3& position) { return gfx::Mesh::Vertex{.position = position}; });
+}
+
+}  // namespace gfx::test
+
+#endif  // TESTS_GEOMETRY_SPHERE_H_
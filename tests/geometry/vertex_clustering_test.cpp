@@ -0,0 +1,63 @@
+#include "geometry/vertex_clustering.h"
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+#include <glm/glm.hpp>
+#include <gtest/gtest.h>
+
+#include "geometry/half_edge_mesh.h"
+#include "tests/geometry/sphere.h"
+
+namespace {
+
+/** \brief Verifies a mesh is a closed manifold with the expected Euler characteristic. */
+void VerifyClosedManifold(const gfx::ClusteredMesh& mesh, const std::ptrdiff_t euler_characteristic) {
+  // each half-edge of a closed manifold mesh is paired with a flip edge from an adjacent face
+  const gfx::HalfEdgeMesh half_edge_mesh{mesh.positions, mesh.indices};
+  const auto face_count = static_cast<std::ptrdiff_t>(mesh.indices.size() / 3);
+  const auto edge_count = static_cast<std::ptrdiff_t>(half_edge_mesh.edges().size() / 2);
+  const auto vertex_count = static_cast<std::ptrdiff_t>(mesh.positions.size());
+  EXPECT_EQ(half_edge_mesh.edges().size(), mesh.indices.size());
+  EXPECT_EQ(vertex_count - edge_count + face_count, euler_characteristic);
+}
+
+TEST(VertexClusteringTest, ClusterMeshWithFewerFacesThanTheTargetReturnsTheOriginalMesh) {
+  const auto sphere = gfx::test::CreateSphere(2);
+  const auto clustered_mesh = gfx::ClusterVertices(sphere.positions, sphere.indices, sphere.indices.size() / 3);
+  EXPECT_EQ(clustered_mesh.positions, sphere.positions);
+  EXPECT_EQ(clustered_mesh.indices, sphere.indices);
+}
+
+TEST(VertexClusteringTest, ClusterSphereReducesTheNumberOfFacesAndPreservesTheSurface) {
+  static constexpr std::size_t kTargetFaceCount = 1024;
+  const auto sphere = gfx::test::CreateSphere(6);
+  const auto clustered_mesh = gfx::ClusterVertices(sphere.positions, sphere.indices, kTargetFaceCount);
+
+  const auto face_count = clustered_mesh.indices.size() / 3;
+  EXPECT_LT(face_count, sphere.indices.size() / 3 / 8);
+  EXPECT_GT(face_count, kTargetFaceCount / 2);
+  VerifyClosedManifold(clustered_mesh, 2);
+
+  for (const auto& position : clustered_mesh.positions) {
+    EXPECT_NEAR(glm::length(position), 1.0f, 0.05f);
+  }
+}
+
+TEST(VertexClusteringTest, ClusterAdjacentSpheresDoesNotMergeTheirSurfaces) {
+  // the gap between spheres is smaller than a grid cell so some cells contain vertices from both spheres
+  static constexpr glm::vec3 kCenter{1.01f, 0.0f, 0.0f};
+  auto spheres = gfx::test::CreateSphere(5);
+  const auto sphere = gfx::test::CreateSphere(5);
+  const auto vertex_offset = static_cast<std::uint32_t>(spheres.positions.size());
+  for (auto& position : spheres.positions) position -= kCenter;
+  for (const auto& position : sphere.positions) spheres.positions.push_back(position + kCenter);
+  for (const auto index : sphere.indices) spheres.indices.push_back(vertex_offset + index);
+
+  const auto clustered_mesh = gfx::ClusterVertices(spheres.positions, spheres.indices, 512);
+  EXPECT_LT(clustered_mesh.indices.size(), spheres.indices.size());
+  VerifyClosedManifold(clustered_mesh, 4);
+}
+
+}  // namespace
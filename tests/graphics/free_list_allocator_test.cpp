@@ -0,0 +1,83 @@
+#include "graphics/free_list_allocator.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace {
+
+TEST(FreeListAllocatorTest, AllocateReturnsAlignedNonOverlappingRanges) {
+  gfx::FreeListAllocator free_list_allocator{1024};
+
+  const auto offset0 = free_list_allocator.Allocate(10);
+  const auto offset1 = free_list_allocator.Allocate(100, 64);
+  const auto offset2 = free_list_allocator.Allocate(1, 256);
+
+  ASSERT_TRUE(offset0.has_value() && offset1.has_value() && offset2.has_value());
+  EXPECT_EQ(*offset0, 0);
+  EXPECT_EQ(*offset1 % 64, 0);
+  EXPECT_EQ(*offset2 % 256, 0);
+  EXPECT_GE(*offset1, *offset0 + 10);
+  EXPECT_TRUE(*offset2 >= *offset1 + 100 || *offset2 + 1 <= *offset1);
+  EXPECT_EQ(free_list_allocator.allocation_count(), 3);
+  EXPECT_EQ(free_list_allocator.allocated_size(), 111);
+}
+
+TEST(FreeListAllocatorTest, AllocateReturnsNulloptIfNoFreeRangeFits) {
+  gfx::FreeListAllocator free_list_allocator{256};
+  ASSERT_TRUE(free_list_allocator.Allocate(200).has_value());
+
+  EXPECT_FALSE(free_list_allocator.Allocate(100).has_value());
+  EXPECT_FALSE(free_list_allocator.Allocate(56, 128).has_value());
+  EXPECT_TRUE(free_list_allocator.Allocate(56).has_value());
+}
+
+TEST(FreeListAllocatorTest, AllocatePrefersTheSmallestFreeRangeThatFits) {
+  gfx::FreeListAllocator free_list_allocator{1024};
+  const auto offset0 = free_list_allocator.Allocate(512);
+  const auto offset1 = free_list_allocator.Allocate(16);
+  const auto offset2 = free_list_allocator.Allocate(32);
+  ASSERT_TRUE(offset0.has_value() && offset1.has_value() && offset2.has_value());
+
+  // free a large range followed by a small range that is not adjacent to it
+  free_list_allocator.Free(*offset0);
+  free_list_allocator.Free(*offset2);
+
+  EXPECT_EQ(free_list_allocator.Allocate(16), *offset2);
+}
+
+TEST(FreeListAllocatorTest, FreeCoalescesAdjacentFreeRanges) {
+  gfx::FreeListAllocator free_list_allocator{1024};
+  std::vector<std::uint64_t> offsets;
+  for (auto i = 0; i < 8; ++i) offsets.push_back(*free_list_allocator.Allocate(128));
+  EXPECT_FALSE(free_list_allocator.Allocate(1).has_value());
+
+  std::mt19937 random_engine{0};  // NOLINT(cert-msc32-c, cert-msc51-cpp): deterministic test input
+  std::ranges::shuffle(offsets, random_engine);
+  for (const auto offset : offsets) free_list_allocator.Free(offset);
+
+  EXPECT_TRUE(free_list_allocator.empty());
+  EXPECT_EQ(free_list_allocator.allocated_size(), 0);
+  EXPECT_EQ(free_list_allocator.free_range_count(), 1);
+  EXPECT_EQ(free_list_allocator.largest_free_range_size(), 1024);
+  EXPECT_EQ(free_list_allocator.Allocate(1024), std::optional<std::uint64_t>{0});
+}
+
+TEST(FreeListAllocatorTest, StatisticsReflectFragmentation) {
+  gfx::FreeListAllocator free_list_allocator{1024};
+  std::vector<std::uint64_t> offsets;
+  for (auto i = 0; i < 8; ++i) offsets.push_back(*free_list_allocator.Allocate(128));
+  for (std::size_t i = 0; i < offsets.size(); i += 2) free_list_allocator.Free(offsets[i]);
+
+  EXPECT_EQ(free_list_allocator.allocated_size(), 512);
+  EXPECT_EQ(free_list_allocator.free_range_count(), 4);
+  EXPECT_EQ(free_list_allocator.largest_free_range_size(), 128);
+  EXPECT_FALSE(free_list_allocator.Allocate(256).has_value());
+}
+
+}  // namespace
@@ -0,0 +1,68 @@
+#include "graphics/lod_selector.h"
+
+#include <cstddef>
+#include <vector>
+
+#include <glm/glm.hpp>
+#include <gtest/gtest.h>
+
+namespace {
+
+// each level of detail doubles the geometric error of the previous level
+const std::vector<float> kGeometricErrors{0.0f, 0.01f, 0.02f, 0.04f, 0.08f};
+
+TEST(LodSelectorTest, GetPixelsPerUnitIsInverselyProportionalToDistance) {
+  const gfx::ViewFrustum view_frustum{.field_of_view_y = glm::radians(90.0f),
+                                      .aspect_ratio = 1.0f,
+                                      .z_near = 0.1f,
+                                      .z_far = 100.0f};
+
+  // a 90 degree field of view spans 2 units vertically at a distance of 1
+  EXPECT_FLOAT_EQ(gfx::GetPixelsPerUnit(1.0f, view_frustum, 1000.0f), 500.0f);
+  EXPECT_FLOAT_EQ(gfx::GetPixelsPerUnit(2.0f, view_frustum, 1000.0f), 250.0f);
+}
+
+TEST(LodSelectorTest, GetPixelsPerUnitClampsDistanceToTheNearPlane) {
+  const gfx::ViewFrustum view_frustum{.field_of_view_y = glm::radians(90.0f),
+                                      .aspect_ratio = 1.0f,
+                                      .z_near = 0.1f,
+                                      .z_far = 100.0f};
+
+  EXPECT_FLOAT_EQ(gfx::GetPixelsPerUnit(-1.0f, view_frustum, 1000.0f),
+                  gfx::GetPixelsPerUnit(0.1f, view_frustum, 1000.0f));
+}
+
+TEST(LodSelectorTest, SelectReturnsTheCoarsestLodBelowTheThreshold) {
+  gfx::LodSelector lod_selector{kGeometricErrors, {.max_pixel_error = 1.0f, .hysteresis = 0.0f}};
+
+  EXPECT_EQ(lod_selector.Select(1000.0f), 0);
+  EXPECT_EQ(lod_selector.Select(60.0f), 1);
+  EXPECT_EQ(lod_selector.Select(30.0f), 2);
+  EXPECT_EQ(lod_selector.Select(1.0f), kGeometricErrors.size() - 1);
+  EXPECT_EQ(lod_selector.Select(1000.0f), 0);
+}
+
+TEST(LodSelectorTest, SelectRequiresTheHysteresisMarginToCoarsen) {
+  gfx::LodSelector lod_selector{kGeometricErrors, {.max_pixel_error = 1.0f, .hysteresis = 0.25f}};
+
+  // the second level of detail projects to 0.9 pixels which is below the threshold but not the hysteresis margin
+  EXPECT_EQ(lod_selector.Select(90.0f), 0);
+  EXPECT_EQ(lod_selector.Select(70.0f), 1);
+
+  // the selected level of detail is retained until its projected error exceeds the threshold
+  EXPECT_EQ(lod_selector.Select(90.0f), 1);
+  EXPECT_EQ(lod_selector.Select(110.0f), 0);
+}
+
+TEST(LodSelectorTest, SelectDoesNotOscillateAtTheThreshold) {
+  gfx::LodSelector lod_selector{kGeometricErrors, {.max_pixel_error = 1.0f, .hysteresis = 0.25f}};
+  ASSERT_EQ(lod_selector.Select(70.0f), 1);
+
+  // without hysteresis the third level of detail would be selected at 45 pixels per unit and refined again at 99
+  for (auto i = 0; i < 8; ++i) {
+    EXPECT_EQ(lod_selector.Select(i % 2 == 0 ? 99.0f : 45.0f), 1);
+  }
+  EXPECT_EQ(lod_selector.lod_index(), 1);
+}
+
+}  // namespace
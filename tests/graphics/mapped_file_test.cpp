@@ -0,0 +1,81 @@
+#include "graphics/mapped_file.h"
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace {
+
+std::filesystem::path WriteFile(const std::string& filename, const std::vector<std::uint32_t>& values) {
+  const auto filepath = std::filesystem::temp_directory_path() / filename;
+  std::ofstream file{filepath, std::ios::binary | std::ios::trunc};
+  file.write(reinterpret_cast<const char*>(values.data()),  // NOLINT(*-reinterpret-cast)
+             static_cast<std::streamsize>(values.size() * sizeof(std::uint32_t)));
+  return filepath;
+}
+
+TEST(MappedFileTest, MapFileReturnsTheFileContents) {
+  const std::vector<std::uint32_t> values{4, 8, 15, 16, 23, 42};
+  const auto filepath = WriteFile("mapped_file_test_contents.bin", values);
+  {
+    const gfx::MappedFile mapped_file{filepath};
+    EXPECT_EQ(mapped_file.data().size(), values.size() * sizeof(std::uint32_t));
+    const auto data = mapped_file.data_as<std::uint32_t>();
+    EXPECT_EQ(std::vector(data.begin(), data.end()), values);
+  }
+  std::filesystem::remove(filepath);
+}
+
+TEST(MappedFileTest, MapEmptyFileReturnsAnEmptySpan) {
+  const auto filepath = WriteFile("mapped_file_test_empty.bin", {});
+  {
+    const gfx::MappedFile mapped_file{filepath};
+    EXPECT_TRUE(mapped_file.data().empty());
+  }
+  std::filesystem::remove(filepath);
+}
+
+TEST(MappedFileTest, CreateFileMapsZeroInitializedContentsThatAreWrittenToTheFile) {
+  const auto filepath = std::filesystem::temp_directory_path() / "mapped_file_test_create.bin";
+  const std::vector<std::uint32_t> values{0, 7, 0, 9};
+  {
+    gfx::MappedFile mapped_file{filepath, values.size() * sizeof(std::uint32_t)};
+    const auto data = mapped_file.writable_data_as<std::uint32_t>();
+    ASSERT_EQ(data.size(), values.size());
+    EXPECT_EQ(std::vector(data.begin(), data.end()), std::vector<std::uint32_t>(values.size(), 0));
+    data[1] = values[1];
+    data[3] = values[3];
+  }
+  {
+    const gfx::MappedFile mapped_file{filepath};
+    const auto data = mapped_file.data_as<std::uint32_t>();
+    EXPECT_EQ(std::vector(data.begin(), data.end()), values);
+  }
+  std::filesystem::remove(filepath);
+}
+
+TEST(MappedFileTest, MoveMappedFileTransfersOwnershipOfTheMapping) {
+  const std::vector<std::uint32_t> values{1, 2, 3};
+  const auto filepath = WriteFile("mapped_file_test_move.bin", values);
+  {
+    gfx::MappedFile mapped_file{filepath};
+    const auto data = mapped_file.data();
+    const auto moved_mapped_file = std::move(mapped_file);
+    EXPECT_EQ(moved_mapped_file.data().data(), data.data());
+    EXPECT_TRUE(mapped_file.data().empty());  // NOLINT(bugprone-use-after-move)
+  }
+  std::filesystem::remove(filepath);
+}
+
+TEST(MappedFileTest, MapFileThatDoesNotExistThrowsAnException) {
+  EXPECT_THROW(gfx::MappedFile{std::filesystem::temp_directory_path() / "mapped_file_test_missing.bin"},
+               std::runtime_error);
+}
+
+}  // namespace
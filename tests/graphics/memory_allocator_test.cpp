@@ -0,0 +1,84 @@
+#include "graphics/memory_allocator.h"
+
+#include <stdexcept>
+#include <tuple>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <vulkan/vulkan.hpp>
+
+#include "tests/device.h"
+
+namespace {
+
+constexpr vk::DeviceSize kBlockSize = vk::DeviceSize{1} << 20U;
+constexpr auto kLinear = gfx::MemoryAllocator::ResourceTiling::kLinear;
+constexpr auto kOptimal = gfx::MemoryAllocator::ResourceTiling::kOptimal;
+
+gfx::MemoryAllocator CreateMemoryAllocator() {
+  const auto& device = gfx::test::Device::Get();
+  return gfx::MemoryAllocator{*device.physical_device(), *device, kBlockSize};
+}
+
+vk::MemoryRequirements GetMemoryRequirements(const vk::DeviceSize size) {
+  return vk::MemoryRequirements{.size = size, .alignment = 256, .memoryTypeBits = ~0u};
+}
+
+TEST(MemoryAllocatorTest, AllocationsShareADeviceMemoryBlock) {
+  auto memory_allocator = CreateMemoryAllocator();
+  std::vector<gfx::MemoryAllocator::Allocation> allocations;
+  for (auto i = 0; i < 16; ++i) {
+    allocations.push_back(
+        memory_allocator.Allocate(GetMemoryRequirements(1024), vk::MemoryPropertyFlagBits::eHostVisible, kLinear));
+  }
+
+  const auto memory_statistics = memory_allocator.GetStatistics();
+  EXPECT_EQ(memory_statistics.block_count, 1);
+  EXPECT_EQ(memory_statistics.allocation_count, allocations.size());
+  EXPECT_EQ(memory_statistics.block_size, kBlockSize);
+  for (const auto& allocation : allocations) {
+    EXPECT_EQ(allocation.memory, allocations.front().memory);
+    EXPECT_EQ(allocation.offset % 256, 0);
+    EXPECT_NE(memory_allocator.Map(allocation), nullptr);
+  }
+
+  for (const auto& allocation : allocations) memory_allocator.Free(allocation);
+  EXPECT_EQ(memory_allocator.GetStatistics().allocation_count, 0);
+}
+
+TEST(MemoryAllocatorTest, LinearAndOptimalAllocationsUseSeparateBlocksWithoutGranularityPadding) {
+  auto memory_allocator = CreateMemoryAllocator();
+  const std::vector allocations{
+      memory_allocator.Allocate(GetMemoryRequirements(1024), vk::MemoryPropertyFlagBits::eDeviceLocal, kLinear),
+      memory_allocator.Allocate(GetMemoryRequirements(1024), vk::MemoryPropertyFlagBits::eDeviceLocal, kOptimal),
+      memory_allocator.Allocate(GetMemoryRequirements(1024), vk::MemoryPropertyFlagBits::eDeviceLocal, kLinear)};
+
+  EXPECT_EQ(memory_allocator.GetStatistics().block_count, 2);
+  EXPECT_NE(allocations[0].memory, allocations[1].memory);
+  EXPECT_EQ(allocations[0].memory, allocations[2].memory);
+  EXPECT_EQ(allocations[2].size, 1024);
+
+  for (const auto& allocation : allocations) memory_allocator.Free(allocation);
+}
+
+TEST(MemoryAllocatorTest, LargeAllocationsReceiveADedicatedBlockThatIsReleasedWhenFreed) {
+  auto memory_allocator = CreateMemoryAllocator();
+  const auto allocation =
+      memory_allocator.Allocate(GetMemoryRequirements(kBlockSize), vk::MemoryPropertyFlagBits::eDeviceLocal, kLinear);
+
+  EXPECT_EQ(memory_allocator.GetStatistics().block_count, 1);
+  EXPECT_EQ(allocation.offset, 0);
+
+  memory_allocator.Free(allocation);
+  EXPECT_EQ(memory_allocator.GetStatistics().block_count, 0);
+}
+
+TEST(MemoryAllocatorTest, AllocateWithUnsupportedMemoryTypeThrowsAnException) {
+  auto memory_allocator = CreateMemoryAllocator();
+  const vk::MemoryRequirements memory_requirements{.size = 1024, .alignment = 256, .memoryTypeBits = 0};
+  EXPECT_THROW(
+      std::ignore = memory_allocator.Allocate(memory_requirements, vk::MemoryPropertyFlagBits::eDeviceLocal, kLinear),
+      std::runtime_error);
+}
+
+}  // namespace
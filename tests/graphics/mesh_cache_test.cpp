@@ -0,0 +1,108 @@
+#include "graphics/mesh_cache.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <glm/glm.hpp>
+#include <gtest/gtest.h>
+
+#include "graphics/mesh.h"
+#include "tests/device.h"
+
+namespace {
+
+gfx::Mesh CreateMesh() {
+  // NOLINTBEGIN(*-magic-numbers)
+  std::vector<gfx::Mesh::Vertex> vertices{
+      gfx::Mesh::Vertex{.position{0.0f, 0.1f, 0.2f}, .texture_coordinates{0.3f, 0.4f}, .normal{1.0f, 0.0f, 0.0f}},
+      gfx::Mesh::Vertex{.position{1.0f, 1.1f, 1.2f}, .texture_coordinates{1.3f, 1.4f}, .normal{0.0f, 1.0f, 0.0f}},
+      gfx::Mesh::Vertex{.position{2.0f, 2.1f, 2.2f}, .texture_coordinates{2.3f, 2.4f}, .normal{0.0f, 0.0f, 1.0f}},
+      gfx::Mesh::Vertex{.position{3.0f, 3.1f, 3.2f}, .texture_coordinates{3.3f, 3.4f}, .normal{0.0f, 0.0f, -1.0f}}};
+  std::vector<std::uint32_t> indices{0, 1, 2, 0, 2, 3};
+  auto mesh = gfx::Mesh{gfx::test::Device::Get(), std::move(vertices), std::move(indices)};
+  mesh.Translate(glm::vec3{1.0f, 2.0f, 3.0f});
+  mesh.Scale(glm::vec3{0.5f});
+  // NOLINTEND(*-magic-numbers)
+  return mesh;
+}
+
+void Truncate(const std::filesystem::path& filepath, const std::uintmax_t size_bytes) {
+  std::filesystem::resize_file(filepath, std::filesystem::file_size(filepath) - size_bytes);
+}
+
+TEST(MeshCacheTest, LoadSavedMeshReturnsTheOriginalMesh) {
+  const auto filepath = std::filesystem::temp_directory_path() / "mesh_cache_test_round_trip.mesh";
+  const auto mesh = CreateMesh();
+  gfx::mesh_cache::SaveMesh(mesh, filepath);
+
+  const auto loaded_mesh = gfx::mesh_cache::LoadMesh(gfx::test::Device::Get(), filepath);
+  ASSERT_EQ(loaded_mesh.vertices().size(), mesh.vertices().size());
+  for (std::size_t i = 0; i < mesh.vertices().size(); ++i) {
+    const auto& loaded_vertex = loaded_mesh.vertices()[i];
+    const auto& vertex = mesh.vertices()[i];
+    EXPECT_EQ(loaded_vertex.position, vertex.position);
+    EXPECT_EQ(loaded_vertex.texture_coordinates, vertex.texture_coordinates);
+    EXPECT_EQ(loaded_vertex.normal, vertex.normal);
+  }
+  EXPECT_EQ(loaded_mesh.indices(), mesh.indices());
+  EXPECT_EQ(loaded_mesh.transform(), mesh.transform());
+
+  std::filesystem::remove(filepath);
+}
+
+TEST(MeshCacheTest, LoadTruncatedMeshCacheFileThrowsAnException) {
+  const auto filepath = std::filesystem::temp_directory_path() / "mesh_cache_test_truncated.mesh";
+  gfx::mesh_cache::SaveMesh(CreateMesh(), filepath);
+  Truncate(filepath, sizeof(std::uint32_t));
+
+  EXPECT_THROW(gfx::mesh_cache::LoadMesh(gfx::test::Device::Get(), filepath), std::runtime_error);
+
+  std::filesystem::remove(filepath);
+}
+
+TEST(MeshCacheTest, LoadFileWithoutMeshCacheHeaderThrowsAnException) {
+  const auto filepath = std::filesystem::temp_directory_path() / "mesh_cache_test_invalid_header.mesh";
+  std::ofstream{filepath} << "v 0.0 0.0 0.0\n";
+
+  EXPECT_THROW(gfx::mesh_cache::LoadMesh(gfx::test::Device::Get(), filepath), std::runtime_error);
+
+  std::filesystem::remove(filepath);
+}
+
+TEST(MeshCacheTest, LoadMeshCacheFileWithDifferentVersionThrowsAnException) {
+  const auto filepath = std::filesystem::temp_directory_path() / "mesh_cache_test_version.mesh";
+  gfx::mesh_cache::SaveMesh(CreateMesh(), filepath);
+  {
+    // the version immediately follows the 4-byte magic number
+    std::fstream file{filepath, std::ios::binary | std::ios::in | std::ios::out};
+    file.seekp(4);
+    file.put(static_cast<char>(0xFF));
+  }
+
+  EXPECT_THROW(gfx::mesh_cache::LoadMesh(gfx::test::Device::Get(), filepath), std::runtime_error);
+
+  std::filesystem::remove(filepath);
+}
+
+TEST(MeshCacheTest, LoadMeshCacheFileWithAnIndexOutOfRangeThrowsAnException) {
+  const auto filepath = std::filesystem::temp_directory_path() / "mesh_cache_test_index_out_of_range.mesh";
+  gfx::mesh_cache::SaveMesh(CreateMesh(), filepath);
+  {
+    // the last index is at the end of the file
+    std::fstream file{filepath, std::ios::binary | std::ios::in | std::ios::out};
+    file.seekp(-static_cast<std::streamoff>(sizeof(std::uint32_t)), std::ios::end);
+    file.put(static_cast<char>(0xFF));
+  }
+
+  EXPECT_THROW(gfx::mesh_cache::LoadMesh(gfx::test::Device::Get(), filepath), std::runtime_error);
+
+  std::filesystem::remove(filepath);
+}
+
+}  // namespace
@@ -0,0 +1,163 @@
+#include "graphics/meshlet.h"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <unordered_set>
+#include <vector>
+
+#include <glm/glm.hpp>
+#include <glm/gtc/constants.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+#include <gtest/gtest.h>
+
+#include "tests/geometry/sphere.h"
+
+namespace {
+
+constexpr std::uint32_t kGridSize = 32;
+
+std::vector<glm::vec3> CreateGridPositions() {
+  std::vector<glm::vec3> positions;
+  for (std::uint32_t y = 0; y < kGridSize; ++y) {
+    for (std::uint32_t x = 0; x < kGridSize; ++x) {
+      positions.emplace_back(static_cast<float>(x), static_cast<float>(y), 0.0f);
+    }
+  }
+  return positions;
+}
+
+/** \brief Creates the indices of a square grid of triangles in the xy-plane whose normals face the positive z-axis. */
+std::vector<std::uint32_t> CreateGridIndices() {
+  std::vector<std::uint32_t> indices;
+  for (std::uint32_t y = 0; y < kGridSize - 1; ++y) {
+    for (std::uint32_t x = 0; x < kGridSize - 1; ++x) {
+      const auto v00 = y * kGridSize + x;
+      const auto v10 = v00 + 1;
+      const auto v01 = v00 + kGridSize;
+      const auto v11 = v01 + 1;
+      indices.insert(indices.end(), {v00, v10, v11, v00, v11, v01});
+    }
+  }
+  return indices;
+}
+
+/** \brief Creates a meshlet culler for a camera at (0, 0, 5) looking at the origin. */
+gfx::MeshletCuller CreateMeshletCuller() {
+  const auto view_transform = glm::lookAt(glm::vec3{0.0f, 0.0f, 5.0f}, glm::vec3{0.0f}, glm::vec3{0.0f, 1.0f, 0.0f});
+  const auto projection_transform = glm::perspective(glm::half_pi<float>(), 1.0f, 0.1f, 100.0f);
+  return gfx::MeshletCuller{view_transform, projection_transform};
+}
+
+TEST(MeshletTest, CreateMeshletsCoversTheIndexBufferInOrderWithinTheMeshletBounds) {
+  const auto positions = CreateGridPositions();
+  const auto indices = CreateGridIndices();
+  const auto meshlets = gfx::CreateMeshlets(positions, indices);
+
+  ASSERT_GT(meshlets.size(), 1);
+  std::uint32_t next_index = 0;
+  for (const auto& meshlet : meshlets) {
+    ASSERT_EQ(meshlet.first_index, next_index);
+    next_index += meshlet.index_count;
+
+    const auto meshlet_indices = std::span{indices}.subspan(meshlet.first_index, meshlet.index_count);
+    const std::unordered_set<std::uint32_t> meshlet_vertices{meshlet_indices.begin(), meshlet_indices.end()};
+    EXPECT_EQ(meshlet.index_count % 3, 0);
+    EXPECT_LE(meshlet.index_count / 3, gfx::kMaxMeshletTriangleCount);
+    EXPECT_LE(meshlet_vertices.size(), gfx::kMaxMeshletVertexCount);
+  }
+  EXPECT_EQ(next_index, indices.size());
+}
+
+TEST(MeshletTest, CreateMeshletsBoundsEachMeshletWithASphereAndNormalCone) {
+  const auto positions = CreateGridPositions();
+  const auto indices = CreateGridIndices();
+
+  for (const auto& meshlet : gfx::CreateMeshlets(positions, indices)) {
+    for (std::size_t i = meshlet.first_index; i < meshlet.first_index + meshlet.index_count; ++i) {
+      EXPECT_LE(glm::distance(meshlet.center, positions[indices[i]]), meshlet.radius * (1.0f + 1.0e-6f));
+    }
+    // triangles in a plane share a normal so the normal cone degenerates to a ray
+    EXPECT_NEAR(meshlet.cone_axis.z, 1.0f, 1.0e-6f);
+    EXPECT_NEAR(meshlet.cone_cutoff, 0.0f, 1.0e-3f);
+  }
+}
+
+TEST(MeshletTest, CreateMeshletsOfAClosedMeshIsNeverBackfaceCulled) {
+  const std::vector<glm::vec3> positions{glm::vec3{0.0f, 0.0f, 0.0f},
+                                         glm::vec3{1.0f, 0.0f, 0.0f},
+                                         glm::vec3{0.0f, 1.0f, 0.0f},
+                                         glm::vec3{0.0f, 0.0f, 1.0f}};
+  const std::vector<std::uint32_t> indices{0, 2, 1, 0, 1, 3, 0, 3, 2, 1, 2, 3};
+  const auto meshlets = gfx::CreateMeshlets(positions, indices);
+
+  ASSERT_EQ(meshlets.size(), 1);
+  EXPECT_EQ(meshlets[0].cone_cutoff, 1.0f);
+  EXPECT_TRUE(CreateMeshletCuller().IsVisible(meshlets[0]));
+}
+
+TEST(MeshletTest, MeshletCullerRejectsMeshletsOutsideTheViewFrustum) {
+  const auto meshlet_culler = CreateMeshletCuller();
+  const auto create_meshlet = [](const glm::vec3& center) { return gfx::Meshlet{.center = center, .radius = 1.0f}; };
+
+  EXPECT_TRUE(meshlet_culler.IsVisible(create_meshlet(glm::vec3{0.0f})));
+  EXPECT_TRUE(meshlet_culler.IsVisible(create_meshlet(glm::vec3{5.5f, 0.0f, 0.0f})));  // intersects the right plane
+  EXPECT_FALSE(meshlet_culler.IsVisible(create_meshlet(glm::vec3{0.0f, 0.0f, 10.0f})));
+  EXPECT_FALSE(meshlet_culler.IsVisible(create_meshlet(glm::vec3{0.0f, 0.0f, -200.0f})));
+  EXPECT_FALSE(meshlet_culler.IsVisible(create_meshlet(glm::vec3{50.0f, 0.0f, 0.0f})));
+  EXPECT_FALSE(meshlet_culler.IsVisible(create_meshlet(glm::vec3{0.0f, -50.0f, 0.0f})));
+}
+
+TEST(MeshletTest, MeshletCullerRejectsMeshletsFacingAwayFromTheCamera) {
+  const std::vector<glm::vec3> positions{glm::vec3{-1.0f, -1.0f, 0.0f},
+                                         glm::vec3{1.0f, -1.0f, 0.0f},
+                                         glm::vec3{1.0f, 1.0f, 0.0f},
+                                         glm::vec3{-1.0f, 1.0f, 0.0f}};
+  const std::vector<std::uint32_t> front_facing_indices{0, 1, 2, 0, 2, 3};
+  const std::vector<std::uint32_t> back_facing_indices{0, 2, 1, 0, 3, 2};
+  const auto meshlet_culler = CreateMeshletCuller();
+
+  const auto front_facing_meshlets = gfx::CreateMeshlets(positions, front_facing_indices);
+  const auto back_facing_meshlets = gfx::CreateMeshlets(positions, back_facing_indices);
+
+  ASSERT_EQ(front_facing_meshlets.size(), 1);
+  ASSERT_EQ(back_facing_meshlets.size(), 1);
+  EXPECT_TRUE(meshlet_culler.IsVisible(front_facing_meshlets[0]));
+  EXPECT_FALSE(meshlet_culler.IsVisible(back_facing_meshlets[0]));
+}
+
+TEST(MeshletTest, MeshBuildsMeshletsOverItsIndexBufferOnlyWhenRequested) {
+  auto mesh = gfx::test::CreateSphereMesh(4);
+  EXPECT_TRUE(mesh.meshlets().empty());
+
+  mesh.BuildMeshlets();
+  ASSERT_GT(mesh.meshlets().size(), 1);
+  std::uint32_t next_index = 0;
+  for (const auto& meshlet : mesh.meshlets()) {
+    ASSERT_EQ(meshlet.first_index, next_index);
+    next_index += meshlet.index_count;
+  }
+  EXPECT_EQ(next_index, mesh.indices().size());
+}
+
+TEST(MeshletTest, MeshBuildsMeshletsWithinEachIndexRange) {
+  auto mesh = gfx::test::CreateSphereMesh(4);
+  // the boundary between ranges is not a multiple of the maximum meshlet triangle count
+  const auto index_count = static_cast<std::uint32_t>(mesh.indices().size());
+  static constexpr std::uint32_t kBoundary = 3 * (gfx::kMaxMeshletTriangleCount + 1);
+  const std::array index_ranges{gfx::IndexRange{.first_index = 0, .index_count = kBoundary},
+                                gfx::IndexRange{.first_index = kBoundary, .index_count = index_count - kBoundary}};
+  mesh.BuildMeshlets(index_ranges);
+
+  std::uint32_t next_index = 0;
+  for (const auto& meshlet : mesh.meshlets()) {
+    ASSERT_EQ(meshlet.first_index, next_index);
+    next_index += meshlet.index_count;
+    EXPECT_TRUE(next_index <= kBoundary || meshlet.first_index >= kBoundary);
+  }
+  EXPECT_EQ(next_index, index_count);
+}
+
+}  // namespace
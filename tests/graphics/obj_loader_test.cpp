@@ -1,6 +1,13 @@
 #include "graphics/obj_loader.cpp"  // NOLINT(build/include)
 
+#include <array>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
 #include <ranges>
+#include <sstream>
+#include <string>
+#include <string_view>
 
 #include <gtest/gtest.h>
 
@@ -18,28 +25,40 @@ TEST(ObjLoaderTest, TrimStringRemovesWhitespaceFromBothEndsOfTheString) {
   static_assert(Trim(kLine) == "Hello, World!");
 }
 
-TEST(ObjLoaderTest, SplitEmptyStringReturnsAnEmptyList) {
+TEST(ObjLoaderTest, SplitEmptyStringReturnsNoTokens) {
   static constexpr auto* kLine = "";
   static constexpr auto* kDelimiter = " ";
-  EXPECT_TRUE(Split(kLine, kDelimiter).empty());
+  static_assert(Split<4>(kLine, kDelimiter).second == 0);
 }
 
-TEST(ObjLoaderTest, SplitStringWithOnlyTheDelimiterReturnsAnEmptyList) {
+TEST(ObjLoaderTest, SplitStringWithOnlyTheDelimiterReturnsNoTokens) {
   static constexpr auto* kLine = "   ";
   static constexpr auto* kDelimiter = " ";
-  EXPECT_TRUE(Split(kLine, kDelimiter).empty());
+  static_assert(Split<4>(kLine, kDelimiter).second == 0);
 }
 
-TEST(ObjLoaderTest, SplitStringWithoutDelimiterReturnsListWithTheOriginalString) {
+TEST(ObjLoaderTest, SplitStringWithoutDelimiterReturnsTheOriginalString) {
   static constexpr auto* kLine = "Hello";
   static constexpr auto* kDelimiter = " ";
-  EXPECT_EQ(Split(kLine, kDelimiter), (std::vector<std::string_view>{kLine}));
+  const auto [tokens, token_count] = Split<4>(kLine, kDelimiter);
+  EXPECT_EQ(token_count, 1);
+  EXPECT_EQ(tokens[0], kLine);
 }
 
-TEST(ObjLoaderTest, SplitStringWithDelimiterReturnsListWithSplitStringTokens) {
+TEST(ObjLoaderTest, SplitStringWithDelimiterReturnsSplitStringTokens) {
   static constexpr auto* kLine = " v  0.707 0.395    0.684 ";
   static constexpr auto* kDelimiter = " ";
-  EXPECT_EQ(Split(kLine, kDelimiter), (std::vector<std::string_view>{"v", "0.707", "0.395", "0.684"}));
+  const auto [tokens, token_count] = Split<4>(kLine, kDelimiter);
+  EXPECT_EQ(token_count, 4);
+  EXPECT_EQ(tokens, (std::array<std::string_view, 4>{"v", "0.707", "0.395", "0.684"}));
+}
+
+TEST(ObjLoaderTest, SplitStringWithMoreTokensThanCapacityReturnsTheFirstTokensAndTheTotalTokenCount) {
+  static constexpr auto* kLine = "f 1 2 3 4";
+  static constexpr auto* kDelimiter = " ";
+  const auto [tokens, token_count] = Split<3>(kLine, kDelimiter);
+  EXPECT_EQ(token_count, 5);
+  EXPECT_EQ(tokens, (std::array<std::string_view, 3>{"f", "1", "2"}));
 }
 
 TEST(ObjLoaderTest, ParseEmptyStringThrowsAnException) {  //
@@ -162,4 +181,72 @@ TEST(ObjLoaderTest, LoadIndexMeshGetsTheCorrectVerticesAndIndices) {
   EXPECT_EQ(mesh.indices(), (std::vector{0u, 1u, 2u, 3u, 1u, 4u}));
 }
 
+TEST(ObjLoaderTest, ReadObjInParallelRangesReturnsTheSameDataAsReadingSequentially) {
+  // clang-format off
+  static constexpr std::string_view kContents{R"(# positions
+v 0.0 0.1 0.2
+  v 1.0 1.1 1.2
+v 2.0 2.1 2.2
+
+v 3.0 3.1 3.2
+# texture coordinates
+vt 4.0 4.1
+vt 5.0 5.1
+vt 6.0 6.1
+vt 7.0 7.1
+# normals
+vn 1.0 0.0 0.0
+vn 0.0 1.0 0.0
+vn 0.0 0.0 1.0
+# faces
+f 1/4/2 2/1/3 3/2/1
+f 1/2/2 2/1/3 4/3/1
+f 4/3/1 3/4/2 2/3/3  )"};
+  // clang-format on
+
+  std::istringstream istream{std::string{kContents}};
+  const auto expected_obj_data = ReadObj(istream);
+
+  // ranges boundaries are placed at every position within a line including at line breaks
+  for (std::size_t range_count = 1; range_count <= kContents.size(); ++range_count) {
+    const auto obj_data = ReadObj(kContents, range_count);
+    EXPECT_EQ(obj_data.positions, expected_obj_data.positions);
+    EXPECT_EQ(obj_data.texture_coordinates, expected_obj_data.texture_coordinates);
+    EXPECT_EQ(obj_data.normals, expected_obj_data.normals);
+    EXPECT_EQ(obj_data.faces, expected_obj_data.faces);
+  }
+}
+
+TEST(ObjLoaderTest, ReadObjInParallelRangesWithAnInvalidLineThrowsAnException) {
+  static constexpr std::string_view kContents{"v 0.0 0.1 0.2\nv 1.0 1.1\nv 2.0 2.1 2.2\n"};
+  EXPECT_THROW(ReadObj(kContents, 3), std::invalid_argument);
+}
+
+TEST(ObjLoaderTest, LoadMeshWithCacheWritesACacheFileThatIsLoadedUntilTheObjFileChanges) {
+  const auto obj_filepath = std::filesystem::temp_directory_path() / "obj_loader_test_cache.obj";
+  const auto cache_filepath = std::filesystem::temp_directory_path() / "obj_loader_test_cache.mesh";
+  std::filesystem::remove(cache_filepath);
+  std::ofstream{obj_filepath} << "v 0.0 0.0 0.0\nv 1.0 0.0 0.0\nv 0.0 1.0 0.0\nf 1 2 3\n";
+
+  const auto& device = gfx::test::Device::Get();
+  const auto mesh = gfx::obj_loader::LoadMesh(device, obj_filepath, {.use_cache = true});
+  ASSERT_TRUE(std::filesystem::exists(cache_filepath));
+
+  // replace the cache contents to determine which file subsequent loads read from
+  const gfx::Mesh cached_mesh{device, {mesh.vertices()[0], mesh.vertices()[2], mesh.vertices()[1]}, {0, 1, 2}};
+  gfx::mesh_cache::SaveMesh(cached_mesh, cache_filepath);
+  EXPECT_EQ(gfx::obj_loader::LoadMesh(device, obj_filepath, {.use_cache = true}).vertices()[1].position,
+            cached_mesh.vertices()[1].position);
+
+  // a cache file older than the .obj file is stale and must be rewritten
+  std::filesystem::last_write_time(obj_filepath,
+                                   std::filesystem::last_write_time(cache_filepath) + std::chrono::seconds{1});
+  EXPECT_EQ(gfx::obj_loader::LoadMesh(device, obj_filepath, {.use_cache = true}).vertices()[1].position,
+            mesh.vertices()[1].position);
+  EXPECT_EQ(gfx::mesh_cache::LoadMesh(device, cache_filepath).vertices()[1].position, mesh.vertices()[1].position);
+
+  std::filesystem::remove(obj_filepath);
+  std::filesystem::remove(cache_filepath);
+}
+
 }  // namespace
@@ -0,0 +1,93 @@
+#include "graphics/packed_vertex.h"
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <glm/glm.hpp>
+#include <glm/gtc/constants.hpp>
+#include <glm/gtc/packing.hpp>
+#include <gtest/gtest.h>
+
+namespace {
+
+/** \brief Creates unit vectors evenly distributed on a sphere with a Fibonacci lattice. */
+std::vector<glm::vec3> CreateUnitVectors(const std::uint32_t count) {
+  static const auto kGoldenAngle = glm::pi<float>() * (3.0f - std::sqrt(5.0f));
+  std::vector<glm::vec3> unit_vectors;
+  for (std::uint32_t i = 0; i < count; ++i) {
+    const auto z = 1.0f - 2.0f * (static_cast<float>(i) + 0.5f) / static_cast<float>(count);
+    const auto radius = std::sqrt(1.0f - z * z);
+    const auto theta = kGoldenAngle * static_cast<float>(i);
+    unit_vectors.emplace_back(radius * std::cos(theta), radius * std::sin(theta), z);
+  }
+  for (const auto axis : {glm::vec3{1.0f, 0.0f, 0.0f}, glm::vec3{0.0f, 1.0f, 0.0f}, glm::vec3{0.0f, 0.0f, 1.0f}}) {
+    unit_vectors.push_back(axis);
+    unit_vectors.push_back(-axis);
+  }
+  return unit_vectors;
+}
+
+TEST(PackedVertexTest, DecodeOctahedralInvertsEncodeOctahedral) {
+  for (const auto& normal : CreateUnitVectors(1024)) {
+    const auto encoded_normal = gfx::EncodeOctahedral(normal);
+    EXPECT_LE(std::abs(encoded_normal.x), 1.0f);
+    EXPECT_LE(std::abs(encoded_normal.y), 1.0f);
+
+    const auto decoded_normal = gfx::DecodeOctahedral(encoded_normal);
+    EXPECT_NEAR(decoded_normal.x, normal.x, 1.0e-5f);
+    EXPECT_NEAR(decoded_normal.y, normal.y, 1.0e-5f);
+    EXPECT_NEAR(decoded_normal.z, normal.z, 1.0e-5f);
+  }
+}
+
+TEST(PackedVertexTest, EncodeOctahedralOfTheZeroVectorIsFinite) {
+  EXPECT_EQ(gfx::EncodeOctahedral(glm::vec3{0.0f}), glm::vec2{0.0f});
+}
+
+TEST(PackedVertexTest, CreateQuantizationBoundsCreatesACubeAtTheMinimumPosition) {
+  const std::vector<glm::vec3> positions{glm::vec3{-1.0f, 2.0f, 0.0f}, glm::vec3{3.0f, 1.0f, 0.5f}};
+  const auto quantization_bounds = gfx::CreateQuantizationBounds(positions);
+
+  EXPECT_EQ(quantization_bounds.origin, (glm::vec3{-1.0f, 1.0f, 0.0f}));
+  EXPECT_EQ(quantization_bounds.extent, 4.0f);
+}
+
+TEST(PackedVertexTest, CreateQuantizationBoundsOfASinglePositionHasAUnitExtent) {
+  const std::vector<glm::vec3> positions{glm::vec3{1.0f, 2.0f, 3.0f}};
+  const auto quantization_bounds = gfx::CreateQuantizationBounds(positions);
+
+  EXPECT_EQ(quantization_bounds.origin, (glm::vec3{1.0f, 2.0f, 3.0f}));
+  EXPECT_EQ(quantization_bounds.extent, 1.0f);
+}
+
+TEST(PackedVertexTest, PackVertexPreservesAttributesWithinQuantizationError) {
+  const auto unit_vectors = CreateUnitVectors(256);
+  std::vector<glm::vec3> positions;
+  for (const auto& unit_vector : unit_vectors) positions.push_back(glm::vec3{10.0f, -5.0f, 2.0f} + 3.0f * unit_vector);
+  const auto quantization_bounds = gfx::CreateQuantizationBounds(positions);
+  const auto dequantization_transform = quantization_bounds.GetDequantizationTransform();
+
+  for (std::size_t i = 0; i < positions.size(); ++i) {
+    const auto texture_coordinates = glm::vec2{unit_vectors[i].x, unit_vectors[i].y + 1.0f};
+    const auto packed_vertex = gfx::PackVertex(positions[i], texture_coordinates, unit_vectors[i], quantization_bounds);
+
+    const auto quantized_position = glm::vec4{glm::unpackUnorm1x16(packed_vertex.position[0]),
+                                              glm::unpackUnorm1x16(packed_vertex.position[1]),
+                                              glm::unpackUnorm1x16(packed_vertex.position[2]),
+                                              1.0f};
+    const auto position = glm::vec3{dequantization_transform * quantized_position};
+    EXPECT_LE(glm::distance(position, positions[i]), quantization_bounds.extent / 65535.0f);
+
+    const auto normal = gfx::DecodeOctahedral(
+        glm::vec2{glm::unpackSnorm1x16(static_cast<std::uint16_t>(packed_vertex.normal[0])),
+                  glm::unpackSnorm1x16(static_cast<std::uint16_t>(packed_vertex.normal[1]))});
+    EXPECT_GT(glm::dot(normal, unit_vectors[i]), std::cos(1.0e-3f));
+
+    EXPECT_NEAR(glm::unpackHalf1x16(packed_vertex.texture_coordinates[0]), texture_coordinates.x, 1.0e-3f);
+    EXPECT_NEAR(glm::unpackHalf1x16(packed_vertex.texture_coordinates[1]), texture_coordinates.y, 1.0e-3f);
+  }
+}
+
+}  // namespace
@@ -0,0 +1,87 @@
+#include "graphics/pipeline_cache.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <span>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <vulkan/vulkan.hpp>
+
+#include "tests/device.h"
+
+namespace {
+
+vk::PhysicalDeviceProperties CreatePhysicalDeviceProperties() {
+  vk::PhysicalDeviceProperties physical_device_properties{.vendorID = 0x10de, .deviceID = 0x2684};
+  for (std::uint8_t i = 0; i < VK_UUID_SIZE; ++i) physical_device_properties.pipelineCacheUUID[i] = i;
+  return physical_device_properties;
+}
+
+std::vector<std::byte> CreatePipelineCacheData(const vk::PhysicalDeviceProperties& physical_device_properties) {
+  const vk::PipelineCacheHeaderVersionOne header{.headerSize = sizeof(vk::PipelineCacheHeaderVersionOne),
+                                                 .headerVersion = vk::PipelineCacheHeaderVersion::eOne,
+                                                 .vendorID = physical_device_properties.vendorID,
+                                                 .deviceID = physical_device_properties.deviceID,
+                                                 .pipelineCacheUUID = physical_device_properties.pipelineCacheUUID};
+  std::vector<std::byte> data(sizeof(header) + 64);
+  std::memcpy(data.data(), &header, sizeof(header));
+  return data;
+}
+
+std::filesystem::path CreatePipelineCacheFilepath(const char* const name) {
+  const auto filepath = std::filesystem::temp_directory_path() / name;
+  std::filesystem::remove(filepath);
+  return filepath;
+}
+
+TEST(PipelineCacheTest, DataWithAMatchingHeaderIsCompatible) {
+  const auto physical_device_properties = CreatePhysicalDeviceProperties();
+  const auto data = CreatePipelineCacheData(physical_device_properties);
+
+  EXPECT_TRUE(gfx::PipelineCache::IsCompatible(data, physical_device_properties));
+}
+
+TEST(PipelineCacheTest, DataWithADifferentVendorIsNotCompatible) {
+  const auto physical_device_properties = CreatePhysicalDeviceProperties();
+  auto other_physical_device_properties = physical_device_properties;
+  other_physical_device_properties.vendorID = 0x1002;
+  const auto data = CreatePipelineCacheData(other_physical_device_properties);
+
+  EXPECT_FALSE(gfx::PipelineCache::IsCompatible(data, physical_device_properties));
+}
+
+TEST(PipelineCacheTest, DataWithADifferentPipelineCacheUuidIsNotCompatible) {
+  const auto physical_device_properties = CreatePhysicalDeviceProperties();
+  auto other_physical_device_properties = physical_device_properties;
+  other_physical_device_properties.pipelineCacheUUID[VK_UUID_SIZE - 1] ^= 1;
+  const auto data = CreatePipelineCacheData(other_physical_device_properties);
+
+  EXPECT_FALSE(gfx::PipelineCache::IsCompatible(data, physical_device_properties));
+}
+
+TEST(PipelineCacheTest, DataWithATruncatedHeaderIsNotCompatible) {
+  const auto physical_device_properties = CreatePhysicalDeviceProperties();
+  auto data = CreatePipelineCacheData(physical_device_properties);
+  data.resize(sizeof(vk::PipelineCacheHeaderVersionOne) - 1);
+
+  EXPECT_FALSE(gfx::PipelineCache::IsCompatible(data, physical_device_properties));
+}
+
+TEST(PipelineCacheTest, LoadTruncatedPipelineCacheFileStartsWithAnEmptyPipelineCache) {
+  const auto& device = gfx::test::Device::Get();
+  const auto filepath = CreatePipelineCacheFilepath("pipeline_cache_test_truncated.bin");
+  gfx::PipelineCache{device, filepath}.Save();
+  ASSERT_GE(std::filesystem::file_size(filepath), sizeof(vk::PipelineCacheHeaderVersionOne));
+
+  std::filesystem::resize_file(filepath, sizeof(vk::PipelineCacheHeaderVersionOne) / 2);
+
+  const gfx::PipelineCache pipeline_cache{device, filepath};
+  const auto data = device->getPipelineCacheData(*pipeline_cache);
+  EXPECT_TRUE(gfx::PipelineCache::IsCompatible(std::as_bytes(std::span{data}),
+                                               device.physical_device()->getProperties()));
+}
+
+}  // namespace
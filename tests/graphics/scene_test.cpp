@@ -0,0 +1,58 @@
+#include "graphics/scene.h"
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+#include <glm/glm.hpp>
+#include <gtest/gtest.h>
+
+#include "graphics/mesh.h"
+#include "tests/device.h"
+
+namespace {
+
+const std::vector<gfx::Mesh::Vertex> kQuadVertices{gfx::Mesh::Vertex{.position = glm::vec3{0.0f, 0.0f, 0.0f}},
+                                                   gfx::Mesh::Vertex{.position = glm::vec3{1.0f, 0.0f, 0.0f}},
+                                                   gfx::Mesh::Vertex{.position = glm::vec3{1.0f, 1.0f, 0.0f}},
+                                                   gfx::Mesh::Vertex{.position = glm::vec3{0.0f, 1.0f, 0.0f}}};
+
+// the first level of detail is the quad and the second level of detail is its first triangle
+const std::vector<std::uint32_t> kQuadIndices{0, 1, 2, 0, 2, 3, 0, 1, 2};
+
+gfx::SceneMesh CreateQuadSceneMesh() {
+  return gfx::SceneMesh{.vertices = kQuadVertices,
+                        .indices = kQuadIndices,
+                        .lods = {gfx::IndexRange{.first_index = 0, .index_count = 6},
+                                 gfx::IndexRange{.first_index = 6, .index_count = 3}}};
+}
+
+TEST(SceneTest, InstancesOfTheSameMeshAndLevelOfDetailShareADrawCommand) {
+  const std::array meshes{CreateQuadSceneMesh()};
+  const std::vector<gfx::SceneInstance> instances{gfx::SceneInstance{.mesh_index = 0, .lod_index = 0},
+                                                  gfx::SceneInstance{.mesh_index = 0, .lod_index = 1},
+                                                  gfx::SceneInstance{.mesh_index = 0, .lod_index = 0},
+                                                  gfx::SceneInstance{.mesh_index = 0, .lod_index = 1},
+                                                  gfx::SceneInstance{.mesh_index = 0, .lod_index = 0}};
+
+  const gfx::Scene scene{gfx::test::Device::Get(), meshes, instances};
+
+  EXPECT_EQ(scene.instance_count(), instances.size());
+  EXPECT_EQ(scene.draw_count(), 2);
+}
+
+TEST(SceneTest, DrawCountIsIndependentOfTheInstanceCount) {
+  const std::array meshes{CreateQuadSceneMesh(),
+                          gfx::SceneMesh{.vertices = kQuadVertices, .indices = kQuadIndices}};
+  std::vector<gfx::SceneInstance> instances;
+  for (std::uint32_t i = 0; i < 4096; ++i) {
+    instances.push_back(gfx::SceneInstance{.mesh_index = i % 2, .lod_index = 0});
+  }
+
+  const gfx::Scene scene{gfx::test::Device::Get(), meshes, instances};
+
+  EXPECT_EQ(scene.instance_count(), instances.size());
+  EXPECT_EQ(scene.draw_count(), meshes.size());
+}
+
+}  // namespace
@@ -0,0 +1,66 @@
+#include "graphics/spirv_cache.h"
+
+#include <cstdint>
+#include <filesystem>
+#include <format>
+#include <iterator>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace {
+
+const std::vector<std::uint32_t> kSpirv{0x07230203, 0x00010600, 0x00080001, 0x0000002a, 0x00000000};
+
+std::filesystem::path CreateCacheDirectory(const char* const name) {
+  const auto cache_directory = std::filesystem::temp_directory_path() / name;
+  std::filesystem::remove_all(cache_directory);
+  return cache_directory;
+}
+
+TEST(SpirvCacheTest, GetKeyDependsOnTheSourceAndCompileOptions) {
+  const auto key = gfx::spirv_cache::GetKey("void main() {}", "vertex");
+
+  EXPECT_EQ(gfx::spirv_cache::GetKey("void main() {}", "vertex"), key);
+  EXPECT_NE(gfx::spirv_cache::GetKey("void main() { }", "vertex"), key);
+  EXPECT_NE(gfx::spirv_cache::GetKey("void main() {}", "fragment"), key);
+  EXPECT_NE(gfx::spirv_cache::GetKey("xvoid main() {}", "verte"), key);
+}
+
+TEST(SpirvCacheTest, LoadSavedSpirvReturnsTheOriginalSpirv) {
+  const auto cache_directory = CreateCacheDirectory("spirv_cache_test_round_trip");
+  const auto key = gfx::spirv_cache::GetKey("void main() {}", "vertex");
+  gfx::spirv_cache::SaveSpirv(cache_directory, key, kSpirv);
+
+  EXPECT_EQ(gfx::spirv_cache::LoadSpirv(cache_directory, key), kSpirv);
+}
+
+TEST(SpirvCacheTest, LoadSpirvWithoutACacheFileReturnsNullopt) {
+  const auto cache_directory = CreateCacheDirectory("spirv_cache_test_missing");
+  const auto key = gfx::spirv_cache::GetKey("void main() {}", "vertex");
+
+  EXPECT_FALSE(gfx::spirv_cache::LoadSpirv(cache_directory, key).has_value());
+}
+
+TEST(SpirvCacheTest, LoadTruncatedSpirvReturnsNullopt) {
+  const auto cache_directory = CreateCacheDirectory("spirv_cache_test_truncated");
+  const auto key = gfx::spirv_cache::GetKey("void main() {}", "vertex");
+  gfx::spirv_cache::SaveSpirv(cache_directory, key, kSpirv);
+
+  const auto cache_filepath = cache_directory / std::format("{:016x}.spv", key);
+  std::filesystem::resize_file(cache_filepath, std::filesystem::file_size(cache_filepath) - sizeof(std::uint32_t));
+
+  EXPECT_FALSE(gfx::spirv_cache::LoadSpirv(cache_directory, key).has_value());
+}
+
+TEST(SpirvCacheTest, SaveSpirvReplacesAnExistingCacheFile) {
+  const auto cache_directory = CreateCacheDirectory("spirv_cache_test_replace");
+  const auto key = gfx::spirv_cache::GetKey("void main() {}", "vertex");
+  gfx::spirv_cache::SaveSpirv(cache_directory, key, std::vector<std::uint32_t>{1, 2, 3});
+  gfx::spirv_cache::SaveSpirv(cache_directory, key, kSpirv);
+
+  EXPECT_EQ(gfx::spirv_cache::LoadSpirv(cache_directory, key), kSpirv);
+  EXPECT_EQ(std::distance(std::filesystem::directory_iterator{cache_directory}, {}), 1);
+}
+
+}  // namespace
@@ -0,0 +1,113 @@
+#include "graphics/upload_queue.h"
+
+#include <cstddef>
+#include <span>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <vulkan/vulkan.hpp>
+
+#include "graphics/buffer.h"
+#include "tests/device.h"
+
+namespace {
+
+constexpr vk::DeviceSize kStagingBufferSize = 1024;
+
+gfx::Buffer CreateDeviceLocalBuffer(const gfx::UploadQueue& upload_queue, const vk::DeviceSize size) {
+  return gfx::Buffer{gfx::test::Device::Get(),
+                     size,
+                     vk::BufferUsageFlagBits::eTransferDst,
+                     vk::MemoryPropertyFlagBits::eDeviceLocal,
+                     upload_queue.queue_family_indices()};
+}
+
+TEST(UploadQueueTest, SubmitWithoutCopiesReturnsACompletedBatch) {
+  gfx::UploadQueue upload_queue{gfx::test::Device::Get(), kStagingBufferSize};
+  const auto batch_id = upload_queue.Submit();
+  EXPECT_TRUE(upload_queue.IsComplete(batch_id));
+}
+
+TEST(UploadQueueTest, UploadIsNotCompleteUntilSubmitted) {
+  gfx::UploadQueue upload_queue{gfx::test::Device::Get(), kStagingBufferSize};
+  const auto buffer = CreateDeviceLocalBuffer(upload_queue, kStagingBufferSize);
+  const std::vector<std::byte> data(kStagingBufferSize, std::byte{1});
+
+  const auto batch_id = upload_queue.Upload(data, *buffer);
+  EXPECT_FALSE(upload_queue.IsComplete(batch_id));
+
+  EXPECT_EQ(upload_queue.Submit(), batch_id);
+  upload_queue.Wait(batch_id);
+  EXPECT_TRUE(upload_queue.IsComplete(batch_id));
+}
+
+TEST(UploadQueueTest, UploadsLargerThanTheStagingBufferCompleteAfterWaiting) {
+  gfx::UploadQueue upload_queue{gfx::test::Device::Get(), kStagingBufferSize};
+  const auto buffer = CreateDeviceLocalBuffer(upload_queue, 4 * kStagingBufferSize + 1);
+  const std::vector<std::byte> data(4 * kStagingBufferSize + 1, std::byte{1});
+
+  const auto first_batch_id = upload_queue.Upload(std::span{data}.first(kStagingBufferSize / 2), *buffer);
+  const auto last_batch_id = upload_queue.Upload(data, *buffer);
+  EXPECT_GT(last_batch_id, first_batch_id);
+
+  upload_queue.Wait(last_batch_id);
+  EXPECT_TRUE(upload_queue.IsComplete(first_batch_id));
+  EXPECT_TRUE(upload_queue.IsComplete(last_batch_id));
+}
+
+TEST(UploadQueueTest, UploadLargerThanTheStagingBufferThatWrapsAroundItWritesTheDestinationBuffer) {
+  const auto& device = gfx::test::Device::Get();
+  gfx::UploadQueue upload_queue{device, kStagingBufferSize};
+  static constexpr auto kSize = 4 * kStagingBufferSize + 3;
+  const gfx::Buffer buffer{device,
+                           kSize,
+                           vk::BufferUsageFlagBits::eTransferDst | vk::BufferUsageFlagBits::eTransferSrc,
+                           vk::MemoryPropertyFlagBits::eDeviceLocal,
+                           upload_queue.queue_family_indices()};
+
+  std::vector<std::byte> data(kSize);
+  for (std::size_t i = 0; i < data.size(); ++i) data[i] = static_cast<std::byte>(i % 251);  // NOLINT(*-magic-numbers)
+
+  // a partial upload first offsets the ring buffer so the following copies wrap around its end
+  static constexpr vk::DeviceSize kDstOffset = kStagingBufferSize / 3;
+  (void)upload_queue.Upload(std::span{data}.subspan(kDstOffset, kStagingBufferSize / 2), *buffer, kDstOffset);
+  const auto batch_id = upload_queue.Upload(data, *buffer);
+  upload_queue.Wait(batch_id);
+
+  // copy the device-local buffer to a host-visible buffer on the graphics queue to read it back
+  gfx::Buffer host_buffer{device,
+                          kSize,
+                          vk::BufferUsageFlagBits::eTransferDst,
+                          vk::MemoryPropertyFlagBits::eHostVisible | vk::MemoryPropertyFlagBits::eHostCoherent};
+  const auto command_pool = device->createCommandPoolUnique(
+      vk::CommandPoolCreateInfo{.flags = vk::CommandPoolCreateFlagBits::eTransient,
+                                .queueFamilyIndex = device.physical_device().queue_family_indices().graphics_index});
+  const auto command_buffers = device->allocateCommandBuffersUnique(
+      vk::CommandBufferAllocateInfo{.commandPool = *command_pool,
+                                    .level = vk::CommandBufferLevel::ePrimary,
+                                    .commandBufferCount = 1});
+  const auto command_buffer = *command_buffers.front();
+  command_buffer.begin(vk::CommandBufferBeginInfo{.flags = vk::CommandBufferUsageFlagBits::eOneTimeSubmit});
+  command_buffer.copyBuffer(*buffer, *host_buffer, vk::BufferCopy{.srcOffset = 0, .dstOffset = 0, .size = kSize});
+  command_buffer.end();
+  device.graphics_queue().submit(vk::SubmitInfo{.commandBufferCount = 1, .pCommandBuffers = &command_buffer});
+  device.graphics_queue().waitIdle();
+
+  std::vector<std::byte> buffer_data(kSize);
+  host_buffer.Read(std::span{buffer_data});
+  EXPECT_EQ(buffer_data, data);
+}
+
+TEST(UploadQueueTest, PendingUploadWaitsForItsBatchWhenDestroyed) {
+  gfx::UploadQueue upload_queue{gfx::test::Device::Get(), kStagingBufferSize};
+  const auto buffer = CreateDeviceLocalBuffer(upload_queue, kStagingBufferSize);
+  const std::vector<std::byte> data(kStagingBufferSize, std::byte{1});
+  const auto batch_id = upload_queue.Upload(data, *buffer);
+
+  {
+    const gfx::PendingUpload pending_upload{upload_queue, batch_id};
+  }
+  EXPECT_TRUE(upload_queue.IsComplete(batch_id));
+}
+
+}  // namespace